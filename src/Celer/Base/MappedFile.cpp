@@ -0,0 +1,171 @@
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Celer
+{
+        MappedFile::MappedFile ( ) : data_ ( 0 ) , size_ ( 0 )
+        {
+        }
+
+        MappedFile::~MappedFile ( )
+        {
+                close ( );
+        }
+
+        bool MappedFile::open ( const std::string& path )
+        {
+                close ( );
+
+#ifdef _WIN32
+                HANDLE file = CreateFileA ( path.c_str ( ) , GENERIC_READ , FILE_SHARE_READ , 0 , OPEN_EXISTING , FILE_FLAG_RANDOM_ACCESS , 0 );
+                if ( file == INVALID_HANDLE_VALUE )
+                {
+                        return false;
+                }
+
+                LARGE_INTEGER length;
+                if ( !GetFileSizeEx ( file , &length ) || length.QuadPart == 0 )
+                {
+                        CloseHandle ( file );
+                        return false;
+                }
+
+                HANDLE mapping = CreateFileMappingA ( file , 0 , PAGE_READONLY , 0 , 0 , 0 );
+                CloseHandle ( file );
+                if ( mapping == 0 )
+                {
+                        return false;
+                }
+
+                void* view = MapViewOfFile ( mapping , FILE_MAP_READ , 0 , 0 , 0 );
+                // The view keeps the mapping alive.
+                CloseHandle ( mapping );
+                if ( view == 0 )
+                {
+                        return false;
+                }
+
+                data_ = static_cast<const unsigned char*> ( view );
+                size_ = static_cast<std::size_t> ( length.QuadPart );
+#else
+                int file = ::open ( path.c_str ( ) , O_RDONLY );
+                if ( file < 0 )
+                {
+                        return false;
+                }
+
+                struct stat status;
+                if ( fstat ( file , &status ) != 0 || status.st_size <= 0 )
+                {
+                        ::close ( file );
+                        return false;
+                }
+
+                std::size_t length = static_cast<std::size_t> ( status.st_size );
+                void* view = mmap ( 0 , length , PROT_READ , MAP_PRIVATE , file , 0 );
+                // The mapping keeps the file alive.
+                ::close ( file );
+                if ( view == MAP_FAILED )
+                {
+                        return false;
+                }
+
+                madvise ( view , length , MADV_RANDOM );
+
+                data_ = static_cast<const unsigned char*> ( view );
+                size_ = length;
+#endif
+                return true;
+        }
+
+        void MappedFile::close ( )
+        {
+                if ( data_ == 0 )
+                {
+                        return;
+                }
+
+#ifdef _WIN32
+                UnmapViewOfFile ( data_ );
+#else
+                munmap ( const_cast<unsigned char*> ( data_ ) , size_ );
+#endif
+                data_ = 0;
+                size_ = 0;
+        }
+
+        bool MappedFile::isOpen ( ) const
+        {
+                return data_ != 0;
+        }
+
+        const unsigned char* MappedFile::data ( ) const
+        {
+                return data_;
+        }
+
+        std::size_t MappedFile::size ( ) const
+        {
+                return size_;
+        }
+
+        void MappedFile::prefetch ( std::size_t offset , std::size_t size ) const
+        {
+                if ( data_ == 0 || offset >= size_ || size == 0 )
+                {
+                        return;
+                }
+
+                // madvise wants a page aligned start.
+                std::size_t first = offset - offset % pageSize ( );
+                std::size_t last = ( size > size_ - offset ) ? size_ : offset + size;
+
+#ifdef _WIN32
+                // PrefetchVirtualMemory needs Windows 8 , touching a byte per page works everywhere.
+                volatile unsigned char sink = 0;
+                for ( std::size_t page = first; page < last; page += pageSize ( ) )
+                {
+                        sink ^= data_[page];
+                }
+#else
+                madvise ( const_cast<unsigned char*> ( data_ ) + first , last - first , MADV_WILLNEED );
+#endif
+        }
+
+        void MappedFile::evict ( std::size_t offset , std::size_t size ) const
+        {
+                if ( data_ == 0 || offset >= size_ || size == 0 )
+                {
+                        return;
+                }
+
+                std::size_t first = offset - offset % pageSize ( );
+                std::size_t last = ( size > size_ - offset ) ? size_ : offset + size;
+
+#ifdef _WIN32
+                VirtualUnlock ( const_cast<unsigned char*> ( data_ ) + first , last - first );
+#else
+                // Safe on a private read only mapping , the pages come back from the file.
+                madvise ( const_cast<unsigned char*> ( data_ ) + first , last - first , MADV_DONTNEED );
+#endif
+        }
+
+        std::size_t MappedFile::pageSize ( )
+        {
+#ifdef _WIN32
+                SYSTEM_INFO system;
+                GetSystemInfo ( &system );
+                return static_cast<std::size_t> ( system.dwPageSize );
+#else
+                return static_cast<std::size_t> ( sysconf ( _SC_PAGESIZE ) );
+#endif
+        }
+}
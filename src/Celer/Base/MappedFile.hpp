@@ -0,0 +1,68 @@
+#ifndef CELER_MAPPEDFILE_HPP_
+#define CELER_MAPPEDFILE_HPP_
+
+//- Celer/Base/MappedFile.hpp - MappedFile.hpp Module definition ------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Base Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the MappedFile class, a read
+//        only view of a whole file through the virtual memory system.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstddef>
+#include <string>
+/// Base			- This class can't be copied.
+#include "Celer/Base/Base.hpp"
+
+namespace Celer
+{
+        /*!
+         *@class MappedFile.
+         *@brief Read only memory mapping of a file.
+         *@details Nothing is read by open ( ), a page is loaded the first time
+         * it is touched. The mapping is opened for random access so the kernel
+         * does not read ahead into parts nobody asked for, prefetch ( ) asks
+         * for a range before it is needed and evict ( ) lets its pages go.
+         * Pointers returned by data ( ) stay valid until close ( ).
+         */
+        class MappedFile : public Celer::NonCopyable
+        {
+                private:
+
+                        const unsigned char*    data_;  ///< first byte of the mapping, 0 when closed
+                        std::size_t             size_;  ///< length of the file in bytes
+
+                public:
+
+                        MappedFile ( );
+                        ~MappedFile ( );
+
+                        /// Maps path, false if it can't be opened or is empty.
+                        bool                    open            ( const std::string& path );
+                        void                    close           ( );
+
+                        bool                    isOpen          ( ) const;
+                        const unsigned char*    data            ( ) const;
+                        std::size_t             size            ( ) const;
+
+                        /// Starts reading [offset , offset + size) in the background.
+                        void                    prefetch        ( std::size_t offset , std::size_t size ) const;
+                        /// Drops the pages of [offset , offset + size) , they are read again if touched.
+                        void                    evict           ( std::size_t offset , std::size_t size ) const;
+
+                        /// Size of the pages a range is rounded to.
+                        static std::size_t      pageSize        ( );
+        };
+}
+
+#endif /* CELER_MAPPEDFILE_HPP_ */
@@ -0,0 +1,62 @@
+#ifndef CELER_PARALLEL_HPP_
+#define CELER_PARALLEL_HPP_
+
+//- Celer/Base/Parallel.hpp - Parallel.hpp Module definition ----------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Base Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the thread helpers used by the parallel kernels.
+//        The kernels are written with OpenMP pragmas, so a build without
+//        OpenMP runs them serially and these helpers report one thread.
+//
+//---------------------------------------------------------------------------//
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Celer
+{
+        namespace Parallel
+        {
+                /// Number of threads a parallel region will be given.
+                inline int maxThreads ( )
+                {
+#ifdef _OPENMP
+                        return omp_get_max_threads ( );
+#else
+                        return 1;
+#endif
+                }
+
+                /// Index of the calling thread inside a parallel region, 0 outside.
+                inline int threadIndex ( )
+                {
+#ifdef _OPENMP
+                        return omp_get_thread_num ( );
+#else
+                        return 0;
+#endif
+                }
+
+                /// Number of threads of the current parallel region, 1 outside.
+                inline int threadCount ( )
+                {
+#ifdef _OPENMP
+                        return omp_get_num_threads ( );
+#else
+                        return 1;
+#endif
+                }
+        }
+}
+
+#endif /* CELER_PARALLEL_HPP_ */
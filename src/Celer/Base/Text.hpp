@@ -0,0 +1,283 @@
+#ifndef CELER_TEXT_HPP_
+#define CELER_TEXT_HPP_
+
+//- Celer/Base/Text.hpp - Text.hpp Module definition ------------------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Base Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the number parsers used by the text importers.
+//        They read a range that needs no terminating zero and return the
+//        first character after the number, or 0 when there is no number.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstdlib>
+#include <cstring>
+#include <cfloat>
+#include <stdint.h>
+
+namespace Celer
+{
+        namespace Text
+        {
+                inline bool isSpace ( char c )
+                {
+                        return c == ' ' || c == '\t' || c == '\r';
+                }
+
+                /// Skips blanks, not line ends.
+                inline const char* skipSpaces ( const char* first , const char* last )
+                {
+                        while ( first != last && isSpace ( *first ) )
+                        {
+                                ++first;
+                        }
+                        return first;
+                }
+
+                /// First character of the next line, or last.
+                inline const char* nextLine ( const char* first , const char* last )
+                {
+                        const char* end = static_cast<const char*> ( std::memchr ( first , '\n' , last - first ) );
+                        return end ? end + 1 : last;
+                }
+
+                namespace Detail
+                {
+                        /// Eight ASCII digits in one word, fast_float's SWAR test and conversion.
+                        inline bool isEightDigits ( uint64_t word )
+                        {
+                                return ( ( ( word + 0x4646464646464646ULL ) | ( word - 0x3030303030303030ULL ) ) & 0x8080808080808080ULL ) == 0;
+                        }
+
+                        inline uint32_t eightDigits ( uint64_t word )
+                        {
+                                word -= 0x3030303030303030ULL;
+                                word = ( word * 10 ) + ( word >> 8 );
+                                word = ( ( ( word & 0x000000FF000000FFULL ) * 0x000F424000000064ULL ) +
+                                         ( ( ( word >> 16 ) & 0x000000FF000000FFULL ) * 0x0000271000000001ULL ) ) >> 32;
+                                return static_cast<uint32_t> ( word );
+                        }
+
+                        inline bool littleEndian ( )
+                        {
+                                const uint16_t probe = 1;
+                                unsigned char first;
+                                std::memcpy ( &first , &probe , 1 );
+                                return first == 1;
+                        }
+
+                        /// Accumulates digits into mantissa, eight at a time while it can. Returns the digits read.
+                        inline int digits ( const char*& p , const char* last , uint64_t& mantissa )
+                        {
+                                const char* start = p;
+
+                                if ( littleEndian ( ) )
+                                {
+                                        uint64_t word;
+                                        while ( last - p >= 8 && ( std::memcpy ( &word , p , 8 ) , isEightDigits ( word ) ) )
+                                        {
+                                                mantissa = mantissa * 100000000ULL + eightDigits ( word );
+                                                p += 8;
+                                        }
+                                }
+
+                                while ( p != last && static_cast<unsigned char> ( *p - '0' ) < 10 )
+                                {
+                                        mantissa = mantissa * 10 + static_cast<uint64_t> ( *p - '0' );
+                                        ++p;
+                                }
+
+                                return static_cast<int> ( p - start );
+                        }
+
+                        /// Decimal scan shared by the float and double parsers.
+                        struct Decimal
+                        {
+                                uint64_t        mantissa;
+                                int             exponent;       ///< value = mantissa * 10^exponent
+                                bool            negative;
+                                bool            exact;          ///< mantissa kept every digit and fits 2^53
+                        };
+
+                        inline const char* scan ( const char* first , const char* last , Decimal& decimal )
+                        {
+                                const char* p = first;
+
+                                decimal.mantissa = 0;
+                                decimal.exponent = 0;
+                                decimal.negative = ( p != last && *p == '-' );
+                                if ( p != last && ( *p == '-' || *p == '+' ) )
+                                {
+                                        ++p;
+                                }
+
+                                const char* start = p;
+                                int count = digits ( p , last , decimal.mantissa );
+
+                                if ( p != last && *p == '.' )
+                                {
+                                        ++p;
+                                        int fraction = digits ( p , last , decimal.mantissa );
+                                        decimal.exponent = -fraction;
+                                        count += fraction;
+                                }
+
+                                if ( count == 0 )
+                                {
+                                        return 0;
+                                }
+
+                                // Leading zeros do not count against the 19 digits a mantissa holds.
+                                for ( const char* q = start; q != p && ( *q == '0' || *q == '.' ); ++q )
+                                {
+                                        count -= ( *q == '0' );
+                                }
+
+                                if ( p != last && ( *p == 'e' || *p == 'E' ) )
+                                {
+                                        const char* e = p + 1;
+                                        bool negative = ( e != last && *e == '-' );
+                                        if ( e != last && ( *e == '-' || *e == '+' ) )
+                                        {
+                                                ++e;
+                                        }
+
+                                        int power = 0;
+                                        const char* digitsStart = e;
+                                        while ( e != last && static_cast<unsigned char> ( *e - '0' ) < 10 )
+                                        {
+                                                power = ( power < 100000 ) ? power * 10 + ( *e - '0' ) : power;
+                                                ++e;
+                                        }
+
+                                        if ( e != digitsStart )
+                                        {
+                                                decimal.exponent += negative ? -power : power;
+                                                p = e;
+                                        }
+                                }
+
+                                decimal.exact = count <= 19 && decimal.mantissa <= ( 1ULL << 53 );
+
+                                return p;
+                        }
+
+                        /// Clinger's fast path, exact when the mantissa and the power of ten are both exact doubles.
+                        inline bool fastPath ( const Decimal& decimal , double& value )
+                        {
+                                static const double powers[23] = { 1e0 , 1e1 , 1e2 , 1e3 , 1e4 , 1e5 , 1e6 , 1e7 , 1e8 , 1e9 , 1e10 , 1e11 ,
+                                                                   1e12 , 1e13 , 1e14 , 1e15 , 1e16 , 1e17 , 1e18 , 1e19 , 1e20 , 1e21 , 1e22 };
+
+                                if ( !decimal.exact || decimal.exponent < -22 || decimal.exponent > 22 )
+                                {
+                                        return false;
+                                }
+
+                                value = static_cast<double> ( decimal.mantissa );
+                                value = ( decimal.exponent < 0 ) ? value / powers[-decimal.exponent] : value * powers[decimal.exponent];
+                                value = decimal.negative ? -value : value;
+
+                                return true;
+                        }
+
+                        /// The C library for the rare numbers off the fast path, through a terminated copy.
+                        inline const char* slowPath ( const char* first , const char* last , double& value )
+                        {
+                                char buffer[128];
+                                std::size_t length = static_cast<std::size_t> ( last - first );
+                                length = ( length < sizeof ( buffer ) - 1 ) ? length : sizeof ( buffer ) - 1;
+                                std::memcpy ( buffer , first , length );
+                                buffer[length] = 0;
+
+                                char* end = 0;
+                                value = std::strtod ( buffer , &end );
+
+                                return ( end == buffer ) ? 0 : first + ( end - buffer );
+                        }
+                }
+
+                /// Correctly rounded, as strtod.
+                inline const char* parse ( const char* first , const char* last , double& value )
+                {
+                        Detail::Decimal decimal;
+                        const char* end = Detail::scan ( first , last , decimal );
+
+                        if ( end == 0 || !Detail::fastPath ( decimal , value ) )
+                        {
+                                // Also inf and nan, which scan does not know.
+                                return Detail::slowPath ( first , last , value );
+                        }
+
+                        return end;
+                }
+
+                /*!@brief Correctly rounded, as strtof.
+                 * @details The double fast path is rounded once more to float. That
+                 * second rounding only goes wrong when the double lands exactly
+                 * halfway between two floats, those few go to the slow path.
+                 */
+                inline const char* parse ( const char* first , const char* last , float& value )
+                {
+                        Detail::Decimal decimal;
+                        const char* end = Detail::scan ( first , last , decimal );
+
+                        double wide;
+                        if ( end != 0 && Detail::fastPath ( decimal , wide ) )
+                        {
+                                uint64_t bits;
+                                std::memcpy ( &bits , &wide , 8 );
+
+                                double magnitude = wide < 0.0 ? -wide : wide;
+                                if ( ( bits & 0x1FFFFFFFULL ) != 0x10000000ULL && ( ( magnitude >= FLT_MIN && magnitude <= FLT_MAX ) || magnitude == 0.0 ) )
+                                {
+                                        value = static_cast<float> ( wide );
+                                        return end;
+                                }
+                        }
+
+                        char buffer[128];
+                        std::size_t length = static_cast<std::size_t> ( last - first );
+                        length = ( length < sizeof ( buffer ) - 1 ) ? length : sizeof ( buffer ) - 1;
+                        std::memcpy ( buffer , first , length );
+                        buffer[length] = 0;
+
+                        char* stop = 0;
+                        value = std::strtof ( buffer , &stop );
+
+                        return ( stop == buffer ) ? 0 : first + ( stop - buffer );
+                }
+
+                /// Optional sign and decimal digits.
+                inline const char* parse ( const char* first , const char* last , long& value )
+                {
+                        const char* p = first;
+                        bool negative = ( p != last && *p == '-' );
+                        if ( p != last && ( *p == '-' || *p == '+' ) )
+                        {
+                                ++p;
+                        }
+
+                        uint64_t magnitude = 0;
+                        if ( Detail::digits ( p , last , magnitude ) == 0 )
+                        {
+                                return 0;
+                        }
+
+                        value = negative ? -static_cast<long> ( magnitude ) : static_cast<long> ( magnitude );
+
+                        return p;
+                }
+        }
+}
+
+#endif /* CELER_TEXT_HPP_ */
@@ -0,0 +1,61 @@
+#ifndef CELER_TIMER_HPP_
+#define CELER_TIMER_HPP_
+
+//- Celer/Base/Timer.hpp - Timer.hpp Module definition ----------------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Base Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the Timer class, a wall clock
+//        stopwatch used to report the throughput of the geometry kernels.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <chrono>
+
+namespace Celer
+{
+        class Timer
+        {
+                private:
+                        typedef std::chrono::steady_clock Clock;
+
+                        Clock::time_point       start_; ///< when the watch was (re)started
+
+                public:
+                        Timer ( )
+                        {
+                                start ( );
+                        }
+
+                        void start ( )
+                        {
+                                start_ = Clock::now ( );
+                        }
+
+                        /// Seconds since the last start ( ).
+                        double elapsed ( ) const
+                        {
+                                return std::chrono::duration<double> ( Clock::now ( ) - start_ ).count ( );
+                        }
+
+                        /// Seconds since the last start ( ), restarting the watch.
+                        double lap ( )
+                        {
+                                Clock::time_point now = Clock::now ( );
+                                double seconds = std::chrono::duration<double> ( now - start_ ).count ( );
+                                start_ = now;
+                                return seconds;
+                        }
+        };
+}
+
+#endif /* CELER_TIMER_HPP_ */
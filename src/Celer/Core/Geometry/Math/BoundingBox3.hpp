@@ -1,146 +1,314 @@
 #ifndef CELER_BOUNDINGBOX3_HPP_
 #define CELER_BOUNDINGBOX3_HPP_
 
-#include <Celer/Core/Geometry/Math/Point3.hpp>
+// from Standard Library
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Vector4.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
 
 namespace Celer
 {
 
-/*!
-*@class BoundingBox3.
-*@brief Class that represent a Box in 3D.
-*@details coming soon , but ... coming soon  ... wait ¬¬.
-*@author Felipe Moura.
-*@version 1.0.
-*@date 25-Feb-2008.
-*@todo Give a model, polygon, ellipse ... and so one, with it coords point creat a Box.
-*/
-
-template < class Real>
-class BoundingBox3
-{
-private:
-
-	Point3<Real> mMin;
-	Point3<Real> mMax;
-
-public:
-
-
-	BoundingBox3 ( )
-	{
-		this->mMin = Point3<Real> ();
-		this->mMax = Point3<Real> ();
-	};
-
-	BoundingBox3 ( const BoundingBox3<Real>& box )
-	{
-		this->mMin = Point3<Real> ( box.Min() );
-		this->mMax = Point3<Real> ( box.Max() );
-	};
-
-	BoundingBox3 ( const Point3<Real>& pointMin, const Point3<Real>& pointMax )
-	{
-		this->mMin = Point3<Real> ( pointMin );
-		this->mMax = Point3<Real> ( pointMax );
-	};
-
-	BoundingBox3 ( const Real& xMin, const Real& yMin, const Real& zMin,
-				   const Real& xMax, const Real& yMax, const Real& zMax )
-	{
-		this->mMin = Point3<Real> ( xMin,yMin,zMin );
-		this->mMax = Point3<Real> ( xMax,yMax,zMax );
-	};
-
-	Real Center() const
-	{
-		Vector3<Real>( 0.5*(mMax.x - mMin.x) , 0.5*(mMax.y - mMin.y), 0.5*(mMax.z - mMin.z)  );
-	}
-
-	inline const Real& xMin() const
-	{
-		return ( this->mMin.x );
-	};
-
-	inline const Real& yMin() const
-	{
-		return ( this->mMin.y );
-	};
-
-	inline const Real& zMin() const
-	{
-		return ( this->mMin.z );
-	};
-
-	inline const Real& xMax() const
-	{
-		return ( this->mMax.x );
-	};
-
-	inline const Real& yMax() const
-	{
-		return ( this->mMax.y );
-	};
-
-	inline const Real& zMax() const
-	{
-		return ( this->mMax.z );
-	};
-
-	inline const Point3<Real>& Min() const
-	{
-		return ( this->mMin);
-	};
-
-	inline const Point3<Real>& Max() const
-	{
-		return ( this->mMax );
-	};
-
-
-	inline bool operator==(const BoundingBox3<Real>& box) const
-	{
-	  return ( xMin() == box.xMin() and xMax() == box.xMax() and
-	      	   yMin() == box.yMin() and yMax() == box.yMax() and
-	           zMin() == box.zMin() and zMax() == box.zMax() );
-	};
-
-	inline bool operator!=(const BoundingBox3<Real>& box) const
-	{
-	  return  ! (box == *this);
-	};
-
-	inline BoundingBox3<Real>& operator= (const BoundingBox3<Real>& box)
+	/*!
+	 *@class BoundingBox3.
+	 *@brief Class that represent an axis aligned Box in 3D.
+	 *@details The corners are two four lane registers , x y z and a zero pad
+	 * lane: SIMD::Float4 for float , 16 byte aligned , and SIMD::Lanes4 for
+	 * the other types. A float box takes 32 bytes. Union , intersection , the
+	 * overlap tests and expand are a few lane-wise min , max and compares.
+	 *
+	 * A box with min above max is empty. The default box is empty and takes
+	 * the value of whatever is added to it first.
+	 *@author Felipe Moura.
+	 *@version 1.0.
+	 *@date 25-Feb-2008.
+	 */
+
+	// Box ///////////////////////////////////////////////////////////////////////
+	//    * ------*
+	//   /|      /|
+	//  *-----max
+	//  | |     | |
+	//  | min ----*
+	//  |/      |/
+	//  * ------*
+
+	template < class Real >
+	class BoundingBox3
 	{
-		this->mMin = box.Min();
-		this->mMax = box.Max();
-
-		return ( *this );
+		public:
+
+			typedef typename SIMD::Lanes<Real>::Type Lanes;
+
+		private:
+
+			Lanes min_;
+			Lanes max_;
+
+			/// Lanes x , y and z , the pad lane is left out of every test.
+			enum
+			{
+				kXYZ = 7
+			};
+
+			static Lanes lanes ( const Real& x , const Real& y , const Real& z )
+			{
+				return Lanes ( x , y , z , static_cast<Real> ( 0 ) );
+			}
+
+			static BoundingBox3<Real> fromLanes ( const Lanes& lower , const Lanes& upper )
+			{
+				BoundingBox3<Real> box;
+				box.min_ = lower;
+				box.max_ = upper;
+				return box;
+			}
+
+		public:
+
+			BoundingBox3 ( )
+			{
+				this->reset ( );
+			}
+
+			BoundingBox3 ( const Celer::Vector3<Real>& point_min , const Celer::Vector3<Real>& point_max )
+			{
+				this->min_ = lanes ( point_min.x , point_min.y , point_min.z );
+				this->max_ = lanes ( point_max.x , point_max.y , point_max.z );
+			}
+
+			BoundingBox3 ( const Real& xMin , const Real& yMin , const Real& zMin , const Real& xMax , const Real& yMax , const Real& zMax )
+			{
+				this->min_ = lanes ( xMin , yMin , zMin );
+				this->max_ = lanes ( xMax , yMax , zMax );
+			}
+
+			void reset ( )
+			{
+				Real big = std::numeric_limits<Real>::max ( );
+
+				this->min_ = lanes ( big , big , big );
+				this->max_ = lanes ( -big , -big , -big );
+			}
+
+			void fromPointCloud ( typename std::vector<Celer::Vector3<Real> >::const_iterator new_point_begin , typename std::vector<Celer::Vector3<Real> >::const_iterator new_point_end )
+			{
+				for ( typename std::vector<Celer::Vector3<Real> >::const_iterator new_point = new_point_begin; new_point != new_point_end; ++new_point )
+				{
+					*this += *new_point;
+				}
+			}
+
+			void fromPointCloud ( typename std::vector<Celer::Vector4<Real> >::const_iterator new_point_begin , typename std::vector<Celer::Vector4<Real> >::const_iterator new_point_end )
+			{
+				for ( typename std::vector<Celer::Vector4<Real> >::const_iterator new_point = new_point_begin; new_point != new_point_end; ++new_point )
+				{
+					*this += *new_point;
+				}
+			}
+
+			Real diagonal ( ) const
+			{
+				return ( this->box_min ( ).length ( this->box_max ( ) ) );
+			}
+
+			Celer::Vector3<Real> center ( ) const
+			{
+				Real c[4];
+				( ( max_ + min_ ) * Lanes ( static_cast<Real> ( 0.5 ) ) ).store ( c );
+				return Celer::Vector3<Real> ( c[0] , c[1] , c[2] );
+			}
+
+			/// max - min.
+			Celer::Vector3<Real> extent ( ) const
+			{
+				Real e[4];
+				( max_ - min_ ).store ( e );
+				return Celer::Vector3<Real> ( e[0] , e[1] , e[2] );
+			}
+
+			inline Celer::Vector3<Real> box_min ( ) const
+			{
+				Real p[4];
+				min_.store ( p );
+				return Celer::Vector3<Real> ( p[0] , p[1] , p[2] );
+			}
+
+			inline Celer::Vector3<Real> box_max ( ) const
+			{
+				Real p[4];
+				max_.store ( p );
+				return Celer::Vector3<Real> ( p[0] , p[1] , p[2] );
+			}
+
+			/// The corners as registers , x y z 0.
+			inline const Lanes& lower ( ) const
+			{
+				return ( this->min_ );
+			}
+
+			inline const Lanes& upper ( ) const
+			{
+				return ( this->max_ );
+			}
+
+			bool empty ( ) const
+			{
+				return ( ( min_ > max_ ).bits ( ) & kXYZ ) != 0;
+			}
+
+			inline bool operator== ( const BoundingBox3<Real>& box ) const
+			{
+				return ( ( ( min_ <= box.min_ ) & ( min_ >= box.min_ ) & ( max_ <= box.max_ ) & ( max_ >= box.max_ ) ).bits ( ) & kXYZ ) == kXYZ;
+			}
+
+			inline bool operator!= ( const BoundingBox3<Real>& box ) const
+			{
+				return ! ( box == *this );
+			}
+
+			/// Union.
+			inline BoundingBox3<Real> operator+ ( const BoundingBox3<Real>& box ) const
+			{
+				return fromLanes ( SIMD::min ( min_ , box.min_ ) , SIMD::max ( max_ , box.max_ ) );
+			}
+
+			inline BoundingBox3<Real> operator+ ( const Celer::Vector3<Real>& new_point ) const
+			{
+				Lanes p = lanes ( new_point.x , new_point.y , new_point.z );
+				return fromLanes ( SIMD::min ( min_ , p ) , SIMD::max ( max_ , p ) );
+			}
+
+			inline BoundingBox3<Real> operator+ ( const Celer::Vector4<Real>& new_point ) const
+			{
+				Lanes p = lanes ( new_point.x , new_point.y , new_point.z );
+				return fromLanes ( SIMD::min ( min_ , p ) , SIMD::max ( max_ , p ) );
+			}
+
+			inline BoundingBox3<Real>& operator+= ( const BoundingBox3<Real>& box )
+			{
+				return ( *this = *this + box );
+			}
+
+			inline BoundingBox3<Real>& operator+= ( const Celer::Vector3<Real>& new_point )
+			{
+				return ( *this = *this + new_point );
+			}
+
+			inline BoundingBox3<Real>& operator+= ( const Celer::Vector4<Real>& new_point )
+			{
+				return ( *this = *this + new_point );
+			}
+
+			/// The common part of two boxes , empty when they are apart.
+			inline BoundingBox3<Real> intersection ( const BoundingBox3<Real>& box ) const
+			{
+				return fromLanes ( SIMD::max ( min_ , box.min_ ) , SIMD::min ( max_ , box.max_ ) );
+			}
+
+			/// Half open , min <= p < max on each axis.
+			bool intersect ( const Celer::Vector3<Real>& p ) const
+			{
+				Lanes q = lanes ( p.x , p.y , p.z );
+				return ( ( ( q >= min_ ) & ( q < max_ ) ).bits ( ) & kXYZ ) == kXYZ;
+			}
+
+			/// True when the interiors overlap , touching faces do not count.
+			bool intersect ( const Celer::BoundingBox3<Real>& box ) const
+			{
+				return ( ( ( box.max_ > min_ ) & ( box.min_ < max_ ) ).bits ( ) & kXYZ ) == kXYZ;
+			}
+
+			bool contains ( const Celer::BoundingBox3<Real>& box ) const
+			{
+				return ( ( ( box.min_ >= min_ ) & ( box.max_ <= max_ ) ).bits ( ) & kXYZ ) == kXYZ;
+			}
+
+			/// Zero for an empty box.
+			Real surfaceArea ( ) const
+			{
+				Real e[4];
+				SIMD::max ( max_ - min_ , Lanes ( static_cast<Real> ( 0 ) ) ).store ( e );
+				return static_cast<Real> ( 2 ) * ( e[0] * e[1] + e[1] * e[2] + e[2] * e[0] );
+			}
+
+			Real volume ( ) const
+			{
+				Real e[4];
+				SIMD::max ( max_ - min_ , Lanes ( static_cast<Real> ( 0 ) ) ).store ( e );
+				return e[0] * e[1] * e[2];
+			}
+
+			/// Grown by margin on every side.
+			BoundingBox3<Real> expand ( const Real& margin ) const
+			{
+				Lanes m = lanes ( margin , margin , margin );
+				return fromLanes ( min_ - m , max_ + m );
+			}
+
+			BoundingBox3<Real> expand ( const Celer::Vector3<Real>& margin ) const
+			{
+				Lanes m = lanes ( margin.x , margin.y , margin.z );
+				return fromLanes ( min_ - m , max_ + m );
+			}
+
+			/// Union of count boxes , empty for none.
+			static BoundingBox3<Real> merge ( const BoundingBox3<Real>* boxes , std::size_t count )
+			{
+				BoundingBox3<Real> box;
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					box.min_ = SIMD::min ( box.min_ , boxes[i].min_ );
+					box.max_ = SIMD::max ( box.max_ , boxes[i].max_ );
+				}
+				return box;
+			}
+
+			/// Box around count points.
+			static BoundingBox3<Real> fromPoints ( const Celer::Vector3<Real>* points , std::size_t count )
+			{
+				BoundingBox3<Real> box;
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					Lanes p = lanes ( points[i].x , points[i].y , points[i].z );
+					box.min_ = SIMD::min ( box.min_ , p );
+					box.max_ = SIMD::max ( box.max_ , p );
+				}
+				return box;
+			}
+
+			/// Appends to hits the index of every box overlapping query , returns how many.
+			static std::size_t overlaps ( const BoundingBox3<Real>& query , const BoundingBox3<Real>* boxes , std::size_t count , std::vector<unsigned int>& hits )
+			{
+				std::size_t before = hits.size ( );
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					if ( query.intersect ( boxes[i] ) )
+					{
+						hits.push_back ( static_cast<unsigned int> ( i ) );
+					}
+				}
+				return hits.size ( ) - before;
+			}
+
+			/// Each box grown by margin on every side.
+			static void expand ( BoundingBox3<Real>* boxes , std::size_t count , const Real& margin )
+			{
+				Lanes m = lanes ( margin , margin , margin );
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					boxes[i].min_ -= m;
+					boxes[i].max_ += m;
+				}
+			}
 	};
 
-	inline BoundingBox3<Real> operator+(const BoundingBox3<Real>& box) const
-	{
-	  return BoundingBox3<Real>((std::min)(xMin(), box.xMin()),
-	                	  		(std::min)(yMin(), box.yMin()),
-	                	  		(std::min)(zMin(), box.zMin()),
-	                	  		(std::max)(xMax(), box.xMax()),
-	                	  		(std::max)(yMax(), box.yMax()),
-	                	  		(std::max)(zMax(), box.zMax()));
-	};
-
-
-	bool Intersect (const Point3<Real>& p) const
-	{
-	    return ( ( p.x() >= this->xMin() ) and ( p.x() < this->xMax() ) and
-	             ( p.y() >= this->yMin() ) and ( p.y() < this->yMax() ) and
-	             ( p.z() >= this->zMin() ) and ( p.z() < this->zMax() )   );
-	}
-
-
-
-	virtual ~BoundingBox3(){};
-};
-
 }/* Celer :: NAMESPACE */
 
 #endif /*BOUNDINGBOX3_HPP_*/
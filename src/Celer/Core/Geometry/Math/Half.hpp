@@ -0,0 +1,218 @@
+#ifndef CELER_HALF_HPP_
+#define CELER_HALF_HPP_
+
+//- Celer/Core/Geometry/Math/Half.hpp - IEEE half precision floats ----------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Math Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the float to half and half to float conversions
+//        , one value or four SIMD::Float4 lanes at a time.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@brief Conversions between float and the 16 bit IEEE 754 half.
+	 *@details Both directions are exact where the value exists: float to
+	 * half rounds to nearest even , overflows to infinity and keeps
+	 * subnormals. A NaN keeps its sign and the top of its payload and comes
+	 * out quiet , both ways , which are the bits F16C gives. The lane
+	 * versions use SSE2 integer operations and give the same bits as the
+	 * scalar ones , the code is Fabian Giesen's branch free conversion.
+	 *
+	 * \code
+	 * uint16_t h = Celer::Half::fromFloat ( 0.1f );	// 0x2E66
+	 * Celer::Half::fromFloats ( &uvs[0] , &packed[0] , uvs.size ( ) );
+	 * \endcode
+	 */
+	namespace Half
+	{
+		inline uint16_t fromFloat ( float value )
+		{
+			const uint32_t infinity = 255u << 23;
+			const uint32_t overflow = ( 127u + 16u ) << 23;
+			const uint32_t denormalMagic = ( ( 127u - 15u ) + ( 23u - 10u ) + 1u ) << 23;
+
+			uint32_t bits;
+			std::memcpy ( &bits , &value , 4 );
+
+			uint32_t sign = bits & 0x80000000u;
+			bits ^= sign;
+
+			uint32_t half;
+			if ( bits >= overflow )
+			{
+				half = ( bits > infinity ) ? 0x7E00u | ( ( bits >> 13 ) & 0x3FFu ) : 0x7C00u;
+			}
+			else if ( bits < ( 113u << 23 ) )
+			{
+				// Below the smallest normal half , the float adder does the rounding.
+				float magic;
+				std::memcpy ( &magic , &denormalMagic , 4 );
+				float f;
+				std::memcpy ( &f , &bits , 4 );
+				f += magic;
+				std::memcpy ( &bits , &f , 4 );
+				half = bits - denormalMagic;
+			}
+			else
+			{
+				uint32_t odd = ( bits >> 13 ) & 1u;
+				bits += ( ( 15u - 127u ) << 23 ) + 0xFFFu + odd;
+				half = bits >> 13;
+			}
+
+			return static_cast<uint16_t> ( half | ( sign >> 16 ) );
+		}
+
+		inline float toFloat ( uint16_t half )
+		{
+			const uint32_t shiftedExponent = 0x7C00u << 13;
+
+			uint32_t bits = ( half & 0x7FFFu ) << 13;
+			uint32_t exponent = bits & shiftedExponent;
+			bits += ( 127u - 15u ) << 23;
+
+			if ( exponent == shiftedExponent )
+			{
+				bits += ( 128u - 16u ) << 23;
+				bits |= ( half & 0x3FFu ) ? 0x00400000u : 0u;
+			}
+			else if ( exponent == 0 )
+			{
+				// Subnormal half , renormalized by one float subtraction.
+				const uint32_t magicBits = 113u << 23;
+				float magic;
+				std::memcpy ( &magic , &magicBits , 4 );
+				bits += 1u << 23;
+				float f;
+				std::memcpy ( &f , &bits , 4 );
+				f -= magic;
+				std::memcpy ( &bits , &f , 4 );
+			}
+
+			bits |= static_cast<uint32_t> ( half & 0x8000u ) << 16;
+
+			float value;
+			std::memcpy ( &value , &bits , 4 );
+			return value;
+		}
+
+#if defined(CELER_SIMD_SSE)
+		/// Four lanes to four halves , the same bits as fromFloat ( ).
+		inline void fromFloat4 ( const SIMD::Float4& value , uint16_t* half )
+		{
+			const __m128i infinity = _mm_set1_epi32 ( 255 << 23 );
+			const __m128i overflow = _mm_set1_epi32 ( ( ( 127 + 16 ) << 23 ) - 1 );
+			const __m128i denormalMagic = _mm_set1_epi32 ( ( ( 127 - 15 ) + ( 23 - 10 ) + 1 ) << 23 );
+			const __m128i smallest = _mm_set1_epi32 ( 113 << 23 );
+
+			__m128i bits = _mm_castps_si128 ( value.v );
+			__m128i sign = _mm_and_si128 ( bits , _mm_set1_epi32 ( static_cast<int> ( 0x80000000u ) ) );
+			bits = _mm_xor_si128 ( bits , sign );
+
+			__m128i special = _mm_cmpgt_epi32 ( bits , overflow );
+			__m128i payload = _mm_or_si128 ( _mm_set1_epi32 ( 0x0200 ) , _mm_and_si128 ( _mm_srli_epi32 ( bits , 13 ) , _mm_set1_epi32 ( 0x03FF ) ) );
+			__m128i nan = _mm_and_si128 ( _mm_cmpgt_epi32 ( bits , infinity ) , payload );
+			__m128i specialHalf = _mm_or_si128 ( _mm_set1_epi32 ( 0x7C00 ) , nan );
+
+			__m128i subnormal = _mm_cmplt_epi32 ( bits , smallest );
+			__m128i subnormalHalf = _mm_sub_epi32 ( _mm_castps_si128 ( _mm_add_ps ( _mm_castsi128_ps ( bits ) , _mm_castsi128_ps ( denormalMagic ) ) ) , denormalMagic );
+
+			__m128i odd = _mm_and_si128 ( _mm_srli_epi32 ( bits , 13 ) , _mm_set1_epi32 ( 1 ) );
+			__m128i normalHalf = _mm_add_epi32 ( bits , _mm_set1_epi32 ( static_cast<int> ( ( ( 15u - 127u ) << 23 ) + 0xFFFu ) ) );
+			normalHalf = _mm_srli_epi32 ( _mm_add_epi32 ( normalHalf , odd ) , 13 );
+
+			__m128i result = _mm_or_si128 ( _mm_and_si128 ( subnormal , subnormalHalf ) , _mm_andnot_si128 ( subnormal , normalHalf ) );
+			result = _mm_or_si128 ( _mm_and_si128 ( special , specialHalf ) , _mm_andnot_si128 ( special , result ) );
+			result = _mm_or_si128 ( result , _mm_srli_epi32 ( sign , 16 ) );
+
+			// Sign extend from 16 bits so the saturating pack keeps the values.
+			result = _mm_srai_epi32 ( _mm_slli_epi32 ( result , 16 ) , 16 );
+			_mm_storel_epi64 ( reinterpret_cast<__m128i*> ( half ) , _mm_packs_epi32 ( result , result ) );
+		}
+
+		/// Four halves to four lanes , the same bits as toFloat ( ).
+		inline SIMD::Float4 toFloat4 ( const uint16_t* half )
+		{
+			const __m128i shiftedExponent = _mm_set1_epi32 ( 0x7C00 << 13 );
+			const __m128i magic = _mm_set1_epi32 ( 113 << 23 );
+
+			__m128i h = _mm_unpacklo_epi16 ( _mm_loadl_epi64 ( reinterpret_cast<const __m128i*> ( half ) ) , _mm_setzero_si128 ( ) );
+			__m128i bits = _mm_slli_epi32 ( _mm_and_si128 ( h , _mm_set1_epi32 ( 0x7FFF ) ) , 13 );
+			__m128i exponent = _mm_and_si128 ( bits , shiftedExponent );
+			bits = _mm_add_epi32 ( bits , _mm_set1_epi32 ( ( 127 - 15 ) << 23 ) );
+
+			__m128i special = _mm_cmpeq_epi32 ( exponent , shiftedExponent );
+			__m128i subnormal = _mm_cmpeq_epi32 ( exponent , _mm_setzero_si128 ( ) );
+
+			__m128i quiet = _mm_andnot_si128 ( _mm_cmpeq_epi32 ( _mm_and_si128 ( h , _mm_set1_epi32 ( 0x03FF ) ) , _mm_setzero_si128 ( ) ) , _mm_set1_epi32 ( 0x00400000 ) );
+			__m128i specialBits = _mm_or_si128 ( _mm_add_epi32 ( bits , _mm_set1_epi32 ( ( 128 - 16 ) << 23 ) ) , quiet );
+			__m128i subnormalBits = _mm_castps_si128 ( _mm_sub_ps ( _mm_castsi128_ps ( _mm_add_epi32 ( bits , _mm_set1_epi32 ( 1 << 23 ) ) ) , _mm_castsi128_ps ( magic ) ) );
+
+			bits = _mm_or_si128 ( _mm_and_si128 ( special , specialBits ) , _mm_andnot_si128 ( special , bits ) );
+			bits = _mm_or_si128 ( _mm_and_si128 ( subnormal , subnormalBits ) , _mm_andnot_si128 ( subnormal , bits ) );
+			bits = _mm_or_si128 ( bits , _mm_slli_epi32 ( _mm_and_si128 ( h , _mm_set1_epi32 ( 0x8000 ) ) , 16 ) );
+
+			return SIMD::Float4 ( _mm_castsi128_ps ( bits ) );
+		}
+#else
+		inline void fromFloat4 ( const SIMD::Float4& value , uint16_t* half )
+		{
+			for ( int i = 0; i < 4; ++i ) half[i] = fromFloat ( value.v[i] );
+		}
+
+		inline SIMD::Float4 toFloat4 ( const uint16_t* half )
+		{
+			return SIMD::Float4 ( toFloat ( half[0] ) , toFloat ( half[1] ) , toFloat ( half[2] ) , toFloat ( half[3] ) );
+		}
+#endif
+
+		/// count floats to count halves.
+		inline void fromFloats ( const float* values , uint16_t* halves , std::size_t count )
+		{
+			std::size_t i = 0;
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				fromFloat4 ( SIMD::Float4::load ( values + i ) , halves + i );
+			}
+			for ( ; i < count; ++i )
+			{
+				halves[i] = fromFloat ( values[i] );
+			}
+		}
+
+		/// count halves to count floats.
+		inline void toFloats ( const uint16_t* halves , float* values , std::size_t count )
+		{
+			std::size_t i = 0;
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				toFloat4 ( halves + i ).store ( values + i );
+			}
+			for ( ; i < count; ++i )
+			{
+				values[i] = toFloat ( halves[i] );
+			}
+		}
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_HALF_HPP_ */
@@ -0,0 +1,805 @@
+/*
+ * PixelFormat.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Math/PixelFormat.hpp>
+
+/// Standard C++ library
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Half.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#define CELER_PIXELFORMAT_AVX2 1
+#define CELER_TARGET_AVX2
+#elif defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define CELER_PIXELFORMAT_AVX2 1
+// No fma: a fused multiply add would round x * max + 0.5 once instead of twice.
+#define CELER_TARGET_AVX2 __attribute__ ( ( target ( "avx2,f16c" ) ) )
+#endif
+#endif
+
+namespace Celer
+{
+
+	namespace PixelFormat
+	{
+
+		namespace
+		{
+			enum
+			{
+				kBlock = 1 << 16 ,	///< Values per thread task.
+				kStage = 256 		///< Colors staged per kernel call.
+			};
+
+			/// Floats from 2^-13 up , 128 buckets per octave , hold at most one sRGB threshold each.
+			enum
+			{
+				kBucketLow = ( 127 - 13 ) << 23 ,
+				kBucketShift = 23 - 7 ,
+				kBuckets = ( ( ( 127 << 23 ) - kBucketLow ) >> kBucketShift ) + 1
+			};
+
+			double srgbCurve ( double linear )
+			{
+				return ( linear <= 0.0031308 ) ? 12.92 * linear : 1.055 * std::pow ( linear , 1.0 / 2.4 ) - 0.055;
+			}
+
+			double linearCurve ( double srgb )
+			{
+				return ( srgb <= 0.04045 ) ? srgb / 12.92 : std::pow ( ( srgb + 0.055 ) / 1.055 , 2.4 );
+			}
+
+			float clamp ( float value )
+			{
+				// NaN fails both tests and ends at 0 , as max then min do in the kernels.
+				value = ( value > 0.0f ) ? value : 0.0f;
+				return ( value < 1.0f ) ? value : 1.0f;
+			}
+
+			uint32_t bitsOf ( float value )
+			{
+				uint32_t bits;
+				std::memcpy ( &bits , &value , 4 );
+				return bits;
+			}
+
+			float floatOf ( uint32_t bits )
+			{
+				float value;
+				std::memcpy ( &value , &bits , 4 );
+				return value;
+			}
+
+			/*!
+			 * threshold [k] is the smallest float the curve takes to byte k or
+			 * above , base [b] the byte of the first float in bucket b. A value
+			 * is base plus one if it reaches the next threshold.
+			 */
+			struct SrgbTables
+			{
+				int32_t 	base[kBuckets];
+				float 		threshold[257];
+				float 		linear[256];
+
+				SrgbTables ( )
+				{
+					threshold[0] = 0.0f;
+					for ( int k = 1; k < 256; ++k )
+					{
+						uint32_t low = 0;
+						uint32_t high = bitsOf ( 1.0f );
+						while ( low < high )
+						{
+							uint32_t middle = low + ( high - low ) / 2;
+							if ( toSrgb8 ( floatOf ( middle ) ) >= k )
+							{
+								high = middle;
+							}
+							else
+							{
+								low = middle + 1;
+							}
+						}
+						threshold[k] = floatOf ( low );
+					}
+					threshold[256] = 2.0f;
+
+					for ( int b = 0; b < kBuckets; ++b )
+					{
+						base[b] = toSrgb8 ( floatOf ( static_cast<uint32_t> ( kBucketLow ) + ( static_cast<uint32_t> ( b ) << kBucketShift ) ) );
+					}
+
+					for ( int k = 0; k < 256; ++k )
+					{
+						linear[k] = static_cast<float> ( linearCurve ( k / 255.0 ) );
+					}
+				}
+			};
+
+			const SrgbTables& srgbTables ( )
+			{
+				static const SrgbTables tables;
+				return tables;
+			}
+
+			Path detect ( )
+			{
+#if defined(CELER_PIXELFORMAT_AVX2)
+				unsigned int info[4] = { 0 , 0 , 0 , 0 };
+				unsigned int extended[4] = { 0 , 0 , 0 , 0 };
+#if defined(_MSC_VER)
+				int registers[4];
+				__cpuid ( registers , 0 );
+				int leaves = registers[0];
+				__cpuid ( registers , 1 );
+				std::memcpy ( info , registers , sizeof ( info ) );
+				if ( leaves >= 7 )
+				{
+					__cpuidex ( registers , 7 , 0 );
+					std::memcpy ( extended , registers , sizeof ( extended ) );
+				}
+#else
+				unsigned int leaves = __get_cpuid_max ( 0 , 0 );
+				__get_cpuid ( 1 , &info[0] , &info[1] , &info[2] , &info[3] );
+				if ( leaves >= 7 )
+				{
+					__cpuid_count ( 7 , 0 , extended[0] , extended[1] , extended[2] , extended[3] );
+				}
+#endif
+				bool osxsave = ( info[2] & ( 1u << 27 ) ) != 0;
+				bool avx = ( info[2] & ( 1u << 28 ) ) != 0;
+				bool f16c = ( info[2] & ( 1u << 29 ) ) != 0;
+				bool avx2 = ( extended[1] & ( 1u << 5 ) ) != 0;
+
+				// The OS must save the ymm registers too.
+				bool ymm = false;
+				if ( osxsave )
+				{
+#if defined(_MSC_VER)
+					ymm = ( _xgetbv ( 0 ) & 6 ) == 6;
+#else
+					unsigned int low , high;
+					__asm__ ( "xgetbv" : "=a" ( low ) , "=d" ( high ) : "c" ( 0 ) );
+					ymm = ( low & 6 ) == 6;
+#endif
+				}
+
+				if ( avx && avx2 && f16c && ymm )
+				{
+					return AVX2;
+				}
+#if defined(CELER_SIMD_SSE)
+				if ( info[3] & ( 1u << 26 ) )
+				{
+					return SSE2;
+				}
+#endif
+				return SCALAR;
+#elif defined(CELER_SIMD_SSE)
+				return SSE2;
+#else
+				return SCALAR;
+#endif
+			}
+
+			Path& selected ( )
+			{
+				static Path current = best ( );
+				return current;
+			}
+
+			/// Plain C++ kernels , the arrays of the references.
+			namespace Scalar
+			{
+				void toHalf ( const float* in , std::size_t count , uint16_t* out )
+				{
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = Half::fromFloat ( in[i] );
+				}
+
+				void fromHalf ( const uint16_t* in , std::size_t count , float* out )
+				{
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = Half::toFloat ( in[i] );
+				}
+
+				void toUnorm8 ( const float* in , std::size_t count , uint8_t* out )
+				{
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = PixelFormat::toUnorm8 ( in[i] );
+				}
+
+				void fromUnorm8 ( const uint8_t* in , std::size_t count , float* out )
+				{
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = PixelFormat::fromUnorm8 ( in[i] );
+				}
+
+				void toUnorm16 ( const float* in , std::size_t count , uint16_t* out )
+				{
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = PixelFormat::toUnorm16 ( in[i] );
+				}
+
+				void fromUnorm16 ( const uint16_t* in , std::size_t count , float* out )
+				{
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = PixelFormat::fromUnorm16 ( in[i] );
+				}
+
+				uint8_t srgb ( const SrgbTables& tables , float value )
+				{
+					uint32_t bits = std::max<uint32_t> ( bitsOf ( value ) , kBucketLow );
+					int32_t k = tables.base[( bits - kBucketLow ) >> kBucketShift];
+					return static_cast<uint8_t> ( k + ( value >= tables.threshold[k + 1] ) );
+				}
+
+				void toSrgb8 ( const float* in , std::size_t count , uint8_t* out )
+				{
+					const SrgbTables& tables = srgbTables ( );
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = srgb ( tables , clamp ( in[i] ) );
+				}
+
+				void fromSrgb8 ( const uint8_t* in , std::size_t count , float* out )
+				{
+					const SrgbTables& tables = srgbTables ( );
+					for ( std::size_t i = 0; i < count; ++i ) out[i] = tables.linear[in[i]];
+				}
+
+				void toSrgba8 ( const float* in , std::size_t count , uint8_t* out )
+				{
+					const SrgbTables& tables = srgbTables ( );
+					for ( std::size_t i = 0; i < count; ++i )
+					{
+						out[i * 4] = srgb ( tables , clamp ( in[i * 4] ) );
+						out[i * 4 + 1] = srgb ( tables , clamp ( in[i * 4 + 1] ) );
+						out[i * 4 + 2] = srgb ( tables , clamp ( in[i * 4 + 2] ) );
+						out[i * 4 + 3] = PixelFormat::toUnorm8 ( in[i * 4 + 3] );
+					}
+				}
+
+				void fromSrgba8 ( const uint8_t* in , std::size_t count , float* out )
+				{
+					const SrgbTables& tables = srgbTables ( );
+					for ( std::size_t i = 0; i < count; ++i )
+					{
+						out[i * 4] = tables.linear[in[i * 4]];
+						out[i * 4 + 1] = tables.linear[in[i * 4 + 1]];
+						out[i * 4 + 2] = tables.linear[in[i * 4 + 2]];
+						out[i * 4 + 3] = PixelFormat::fromUnorm8 ( in[i * 4 + 3] );
+					}
+				}
+			}
+
+#if defined(CELER_SIMD_SSE)
+			/// Four lanes , the sRGB lookups stay scalar without a gather.
+			namespace Sse2
+			{
+				void toHalf ( const float* in , std::size_t count , uint16_t* out )
+				{
+					Half::fromFloats ( in , out , count );
+				}
+
+				void fromHalf ( const uint16_t* in , std::size_t count , float* out )
+				{
+					Half::toFloats ( in , out , count );
+				}
+
+				/// Clamped , scaled and truncated after adding 0.5 , as the reference.
+				__m128i unorm ( const float* in , float top )
+				{
+					__m128 x = _mm_min_ps ( _mm_max_ps ( _mm_loadu_ps ( in ) , _mm_setzero_ps ( ) ) , _mm_set1_ps ( 1.0f ) );
+					return _mm_cvttps_epi32 ( _mm_add_ps ( _mm_mul_ps ( x , _mm_set1_ps ( top ) ) , _mm_set1_ps ( 0.5f ) ) );
+				}
+
+				void toUnorm8 ( const float* in , std::size_t count , uint8_t* out )
+				{
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						__m128i words = _mm_packs_epi32 ( unorm ( in + i , 255.0f ) , unorm ( in + i + 4 , 255.0f ) );
+						_mm_storel_epi64 ( reinterpret_cast<__m128i*> ( out + i ) , _mm_packus_epi16 ( words , words ) );
+					}
+					Scalar::toUnorm8 ( in + i , count - i , out + i );
+				}
+
+				void fromUnorm8 ( const uint8_t* in , std::size_t count , float* out )
+				{
+					const __m128 top = _mm_set1_ps ( 255.0f );
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						__m128i words = _mm_unpacklo_epi8 ( _mm_loadl_epi64 ( reinterpret_cast<const __m128i*> ( in + i ) ) , _mm_setzero_si128 ( ) );
+						_mm_storeu_ps ( out + i , _mm_div_ps ( _mm_cvtepi32_ps ( _mm_unpacklo_epi16 ( words , _mm_setzero_si128 ( ) ) ) , top ) );
+						_mm_storeu_ps ( out + i + 4 , _mm_div_ps ( _mm_cvtepi32_ps ( _mm_unpackhi_epi16 ( words , _mm_setzero_si128 ( ) ) ) , top ) );
+					}
+					Scalar::fromUnorm8 ( in + i , count - i , out + i );
+				}
+
+				void toUnorm16 ( const float* in , std::size_t count , uint16_t* out )
+				{
+					// No unsigned pack before SSE4.1: shift to signed , pack , shift back.
+					const __m128i bias = _mm_set1_epi32 ( 32768 );
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						__m128i low = _mm_sub_epi32 ( unorm ( in + i , 65535.0f ) , bias );
+						__m128i high = _mm_sub_epi32 ( unorm ( in + i + 4 , 65535.0f ) , bias );
+						__m128i words = _mm_xor_si128 ( _mm_packs_epi32 ( low , high ) , _mm_set1_epi16 ( static_cast<short> ( 0x8000 ) ) );
+						_mm_storeu_si128 ( reinterpret_cast<__m128i*> ( out + i ) , words );
+					}
+					Scalar::toUnorm16 ( in + i , count - i , out + i );
+				}
+
+				void fromUnorm16 ( const uint16_t* in , std::size_t count , float* out )
+				{
+					const __m128 top = _mm_set1_ps ( 65535.0f );
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						__m128i words = _mm_loadu_si128 ( reinterpret_cast<const __m128i*> ( in + i ) );
+						_mm_storeu_ps ( out + i , _mm_div_ps ( _mm_cvtepi32_ps ( _mm_unpacklo_epi16 ( words , _mm_setzero_si128 ( ) ) ) , top ) );
+						_mm_storeu_ps ( out + i + 4 , _mm_div_ps ( _mm_cvtepi32_ps ( _mm_unpackhi_epi16 ( words , _mm_setzero_si128 ( ) ) ) , top ) );
+					}
+					Scalar::fromUnorm16 ( in + i , count - i , out + i );
+				}
+			}
+#endif
+
+#if defined(CELER_PIXELFORMAT_AVX2)
+			/// Eight lanes , F16C for the halves and gathers for the sRGB tables.
+			namespace Avx2
+			{
+				CELER_TARGET_AVX2 void toHalf ( const float* in , std::size_t count , uint16_t* out )
+				{
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						_mm_storeu_si128 ( reinterpret_cast<__m128i*> ( out + i ) , _mm256_cvtps_ph ( _mm256_loadu_ps ( in + i ) , _MM_FROUND_TO_NEAREST_INT ) );
+					}
+					Scalar::toHalf ( in + i , count - i , out + i );
+				}
+
+				CELER_TARGET_AVX2 void fromHalf ( const uint16_t* in , std::size_t count , float* out )
+				{
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						_mm256_storeu_ps ( out + i , _mm256_cvtph_ps ( _mm_loadu_si128 ( reinterpret_cast<const __m128i*> ( in + i ) ) ) );
+					}
+					Scalar::fromHalf ( in + i , count - i , out + i );
+				}
+
+				CELER_TARGET_AVX2 inline __m256 clamp ( __m256 x )
+				{
+					return _mm256_min_ps ( _mm256_max_ps ( x , _mm256_setzero_ps ( ) ) , _mm256_set1_ps ( 1.0f ) );
+				}
+
+				CELER_TARGET_AVX2 inline __m256i unorm ( __m256 x , float top )
+				{
+					return _mm256_cvttps_epi32 ( _mm256_add_ps ( _mm256_mul_ps ( clamp ( x ) , _mm256_set1_ps ( top ) ) , _mm256_set1_ps ( 0.5f ) ) );
+				}
+
+				/// Eight values below 256 to eight bytes.
+				CELER_TARGET_AVX2 inline void storeBytes ( __m256i values , uint8_t* out )
+				{
+					__m128i words = _mm_packs_epi32 ( _mm256_castsi256_si128 ( values ) , _mm256_extracti128_si256 ( values , 1 ) );
+					_mm_storel_epi64 ( reinterpret_cast<__m128i*> ( out ) , _mm_packus_epi16 ( words , words ) );
+				}
+
+				CELER_TARGET_AVX2 inline __m256i loadBytes ( const uint8_t* in )
+				{
+					return _mm256_cvtepu8_epi32 ( _mm_loadl_epi64 ( reinterpret_cast<const __m128i*> ( in ) ) );
+				}
+
+				CELER_TARGET_AVX2 void toUnorm8 ( const float* in , std::size_t count , uint8_t* out )
+				{
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						storeBytes ( unorm ( _mm256_loadu_ps ( in + i ) , 255.0f ) , out + i );
+					}
+					Scalar::toUnorm8 ( in + i , count - i , out + i );
+				}
+
+				CELER_TARGET_AVX2 void fromUnorm8 ( const uint8_t* in , std::size_t count , float* out )
+				{
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						_mm256_storeu_ps ( out + i , _mm256_div_ps ( _mm256_cvtepi32_ps ( loadBytes ( in + i ) ) , _mm256_set1_ps ( 255.0f ) ) );
+					}
+					Scalar::fromUnorm8 ( in + i , count - i , out + i );
+				}
+
+				CELER_TARGET_AVX2 void toUnorm16 ( const float* in , std::size_t count , uint16_t* out )
+				{
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						__m256i values = unorm ( _mm256_loadu_ps ( in + i ) , 65535.0f );
+						__m128i words = _mm_packus_epi32 ( _mm256_castsi256_si128 ( values ) , _mm256_extracti128_si256 ( values , 1 ) );
+						_mm_storeu_si128 ( reinterpret_cast<__m128i*> ( out + i ) , words );
+					}
+					Scalar::toUnorm16 ( in + i , count - i , out + i );
+				}
+
+				CELER_TARGET_AVX2 void fromUnorm16 ( const uint16_t* in , std::size_t count , float* out )
+				{
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						__m256i values = _mm256_cvtepu16_epi32 ( _mm_loadu_si128 ( reinterpret_cast<const __m128i*> ( in + i ) ) );
+						_mm256_storeu_ps ( out + i , _mm256_div_ps ( _mm256_cvtepi32_ps ( values ) , _mm256_set1_ps ( 65535.0f ) ) );
+					}
+					Scalar::fromUnorm16 ( in + i , count - i , out + i );
+				}
+
+				/// The bucket byte and one threshold compare , eight lanes.
+				CELER_TARGET_AVX2 inline __m256i srgb ( const SrgbTables& tables , __m256 x )
+				{
+					const __m256i low = _mm256_set1_epi32 ( kBucketLow );
+
+					__m256i bits = _mm256_max_epi32 ( _mm256_castps_si256 ( x ) , low );
+					__m256i k = _mm256_i32gather_epi32 ( tables.base , _mm256_srli_epi32 ( _mm256_sub_epi32 ( bits , low ) , kBucketShift ) , 4 );
+					__m256 next = _mm256_i32gather_ps ( tables.threshold + 1 , k , 4 );
+
+					// The compare mask is -1 where the value reaches the next byte.
+					return _mm256_sub_epi32 ( k , _mm256_castps_si256 ( _mm256_cmp_ps ( x , next , _CMP_GE_OQ ) ) );
+				}
+
+				CELER_TARGET_AVX2 void toSrgb8 ( const float* in , std::size_t count , uint8_t* out )
+				{
+					const SrgbTables& tables = srgbTables ( );
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						storeBytes ( srgb ( tables , clamp ( _mm256_loadu_ps ( in + i ) ) ) , out + i );
+					}
+					Scalar::toSrgb8 ( in + i , count - i , out + i );
+				}
+
+				CELER_TARGET_AVX2 void fromSrgb8 ( const uint8_t* in , std::size_t count , float* out )
+				{
+					const SrgbTables& tables = srgbTables ( );
+					std::size_t i = 0;
+					for ( ; i + 8 <= count; i += 8 )
+					{
+						_mm256_storeu_ps ( out + i , _mm256_i32gather_ps ( tables.linear , loadBytes ( in + i ) , 4 ) );
+					}
+					Scalar::fromSrgb8 ( in + i , count - i , out + i );
+				}
+
+				CELER_TARGET_AVX2 void toSrgba8 ( const float* in , std::size_t count , uint8_t* out )
+				{
+					// Two texels per register , lanes 3 and 7 are alpha.
+					const SrgbTables& tables = srgbTables ( );
+					const __m256i alpha = _mm256_setr_epi32 ( 0 , 0 , 0 , -1 , 0 , 0 , 0 , -1 );
+					std::size_t i = 0;
+					for ( ; i + 2 <= count; i += 2 )
+					{
+						__m256 x = _mm256_loadu_ps ( in + i * 4 );
+						__m256i color = srgb ( tables , clamp ( x ) );
+						__m256i linear = unorm ( x , 255.0f );
+						storeBytes ( _mm256_blendv_epi8 ( color , linear , alpha ) , out + i * 4 );
+					}
+					Scalar::toSrgba8 ( in + i * 4 , count - i , out + i * 4 );
+				}
+
+				CELER_TARGET_AVX2 void fromSrgba8 ( const uint8_t* in , std::size_t count , float* out )
+				{
+					const SrgbTables& tables = srgbTables ( );
+					const __m256i alpha = _mm256_setr_epi32 ( 0 , 0 , 0 , -1 , 0 , 0 , 0 , -1 );
+					std::size_t i = 0;
+					for ( ; i + 2 <= count; i += 2 )
+					{
+						__m256i bytes = loadBytes ( in + i * 4 );
+						__m256 color = _mm256_i32gather_ps ( tables.linear , bytes , 4 );
+						__m256 linear = _mm256_div_ps ( _mm256_cvtepi32_ps ( bytes ) , _mm256_set1_ps ( 255.0f ) );
+						_mm256_storeu_ps ( out + i * 4 , _mm256_blendv_ps ( color , linear , _mm256_castsi256_ps ( alpha ) ) );
+					}
+					Scalar::fromSrgba8 ( in + i * 4 , count - i , out + i * 4 );
+				}
+			}
+#endif
+
+			typedef void ( *FloatsToHalves ) ( const float* , std::size_t , uint16_t* );
+			typedef void ( *HalvesToFloats ) ( const uint16_t* , std::size_t , float* );
+			typedef void ( *FloatsToBytes ) ( const float* , std::size_t , uint8_t* );
+			typedef void ( *BytesToFloats ) ( const uint8_t* , std::size_t , float* );
+
+			/// One kernel set , the entries a path lacks are taken from the one below it.
+			struct Kernels
+			{
+				FloatsToHalves toHalf;
+				HalvesToFloats fromHalf;
+				FloatsToBytes toUnorm8;
+				BytesToFloats fromUnorm8;
+				FloatsToHalves toUnorm16;
+				HalvesToFloats fromUnorm16;
+				FloatsToBytes toSrgb8;
+				BytesToFloats fromSrgb8;
+				FloatsToBytes toSrgba8;
+				BytesToFloats fromSrgba8;
+			};
+
+			const Kernels& kernels ( )
+			{
+				static const Kernels scalar =
+				{
+					Scalar::toHalf , Scalar::fromHalf , Scalar::toUnorm8 , Scalar::fromUnorm8 , Scalar::toUnorm16 , Scalar::fromUnorm16 ,
+					Scalar::toSrgb8 , Scalar::fromSrgb8 , Scalar::toSrgba8 , Scalar::fromSrgba8
+				};
+#if defined(CELER_SIMD_SSE)
+				static const Kernels sse2 =
+				{
+					Sse2::toHalf , Sse2::fromHalf , Sse2::toUnorm8 , Sse2::fromUnorm8 , Sse2::toUnorm16 , Sse2::fromUnorm16 ,
+					Scalar::toSrgb8 , Scalar::fromSrgb8 , Scalar::toSrgba8 , Scalar::fromSrgba8
+				};
+#else
+				static const Kernels& sse2 = scalar;
+#endif
+#if defined(CELER_PIXELFORMAT_AVX2)
+				static const Kernels avx2 =
+				{
+					Avx2::toHalf , Avx2::fromHalf , Avx2::toUnorm8 , Avx2::fromUnorm8 , Avx2::toUnorm16 , Avx2::fromUnorm16 ,
+					Avx2::toSrgb8 , Avx2::fromSrgb8 , Avx2::toSrgba8 , Avx2::fromSrgba8
+				};
+#else
+				static const Kernels& avx2 = sse2;
+#endif
+				switch ( selected ( ) )
+				{
+					case AVX2:
+						return avx2;
+					case SSE2:
+						return sse2;
+					default:
+						return scalar;
+				}
+			}
+
+			/// Runs kernel over blocks of kBlock items , width values each , across threads.
+			template < class In , class Out >
+			void run ( void ( *kernel ) ( const In* , std::size_t , Out* ) , const In* in , std::size_t count , Out* out , std::size_t width )
+			{
+				long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+				#pragma omp parallel for schedule(static) if(blocks > 1)
+				for ( long b = 0; b < blocks; ++b )
+				{
+					std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+					std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+					kernel ( in + first * width , last - first , out + first * width );
+				}
+			}
+
+			/// Color is not four packed floats , it goes through a staging copy.
+			template < class Out >
+			void fromColors ( void ( *kernel ) ( const float* , std::size_t , Out* ) , const Color* colors , std::size_t count , Out* out , std::size_t width )
+			{
+				long blocks = static_cast<long> ( ( count + kStage - 1 ) / kStage );
+
+				#pragma omp parallel for schedule(static) if(blocks > kBlock / kStage)
+				for ( long b = 0; b < blocks; ++b )
+				{
+					std::size_t first = static_cast<std::size_t> ( b ) * kStage;
+					std::size_t last = std::min<std::size_t> ( first + kStage , count );
+
+					float staged[kStage * 4];
+					for ( std::size_t i = first; i < last; ++i )
+					{
+						float* texel = staged + ( i - first ) * 4;
+						texel[0] = colors[i].Red ( );
+						texel[1] = colors[i].Green ( );
+						texel[2] = colors[i].Blue ( );
+						texel[3] = colors[i].Alfa ( );
+					}
+					kernel ( staged , ( last - first ) * 4 / width , out + first * 4 );
+				}
+			}
+
+			template < class In >
+			void toColors ( void ( *kernel ) ( const In* , std::size_t , float* ) , const In* in , std::size_t count , Color* colors , std::size_t width )
+			{
+				long blocks = static_cast<long> ( ( count + kStage - 1 ) / kStage );
+
+				#pragma omp parallel for schedule(static) if(blocks > kBlock / kStage)
+				for ( long b = 0; b < blocks; ++b )
+				{
+					std::size_t first = static_cast<std::size_t> ( b ) * kStage;
+					std::size_t last = std::min<std::size_t> ( first + kStage , count );
+
+					float staged[kStage * 4];
+					kernel ( in + first * 4 , ( last - first ) * 4 / width , staged );
+					for ( std::size_t i = first; i < last; ++i )
+					{
+						const float* texel = staged + ( i - first ) * 4;
+						colors[i] = Color ( texel[0] , texel[1] , texel[2] , texel[3] );
+					}
+				}
+			}
+		}
+
+		Path path ( )
+		{
+			return selected ( );
+		}
+
+		Path best ( )
+		{
+			static const Path supported = detect ( );
+			return supported;
+		}
+
+		void force ( Path path )
+		{
+			selected ( ) = std::min ( path , best ( ) );
+		}
+
+		const char* name ( Path path )
+		{
+			static const char* names[3] = { "scalar" , "sse2" , "avx2" };
+			return names[path];
+		}
+
+		void toHalf ( const float* values , std::size_t count , uint16_t* halves )
+		{
+			run ( kernels ( ).toHalf , values , count , halves , 1 );
+		}
+
+		void fromHalf ( const uint16_t* halves , std::size_t count , float* values )
+		{
+			run ( kernels ( ).fromHalf , halves , count , values , 1 );
+		}
+
+		void toUnorm8 ( const float* values , std::size_t count , uint8_t* bytes )
+		{
+			run ( kernels ( ).toUnorm8 , values , count , bytes , 1 );
+		}
+
+		void fromUnorm8 ( const uint8_t* bytes , std::size_t count , float* values )
+		{
+			run ( kernels ( ).fromUnorm8 , bytes , count , values , 1 );
+		}
+
+		void toUnorm16 ( const float* values , std::size_t count , uint16_t* words )
+		{
+			run ( kernels ( ).toUnorm16 , values , count , words , 1 );
+		}
+
+		void fromUnorm16 ( const uint16_t* words , std::size_t count , float* values )
+		{
+			run ( kernels ( ).fromUnorm16 , words , count , values , 1 );
+		}
+
+		void toSrgb8 ( const float* values , std::size_t count , uint8_t* bytes )
+		{
+			run ( kernels ( ).toSrgb8 , values , count , bytes , 1 );
+		}
+
+		void fromSrgb8 ( const uint8_t* bytes , std::size_t count , float* values )
+		{
+			run ( kernels ( ).fromSrgb8 , bytes , count , values , 1 );
+		}
+
+		void toSrgba8 ( const float* rgba , std::size_t count , uint8_t* texels )
+		{
+			run ( kernels ( ).toSrgba8 , rgba , count , texels , 4 );
+		}
+
+		void fromSrgba8 ( const uint8_t* texels , std::size_t count , float* rgba )
+		{
+			run ( kernels ( ).fromSrgba8 , texels , count , rgba , 4 );
+		}
+
+		// Vector4 is four packed floats , its arrays are float arrays four times as long.
+
+		void toHalf ( const Vector4<float>* vectors , std::size_t count , uint16_t* halves )
+		{
+			toHalf ( &vectors[0].x , count * 4 , halves );
+		}
+
+		void fromHalf ( const uint16_t* halves , std::size_t count , Vector4<float>* vectors )
+		{
+			fromHalf ( halves , count * 4 , &vectors[0].x );
+		}
+
+		void toUnorm8 ( const Vector4<float>* vectors , std::size_t count , uint8_t* texels )
+		{
+			toUnorm8 ( &vectors[0].x , count * 4 , texels );
+		}
+
+		void fromUnorm8 ( const uint8_t* texels , std::size_t count , Vector4<float>* vectors )
+		{
+			fromUnorm8 ( texels , count * 4 , &vectors[0].x );
+		}
+
+		void toSrgba8 ( const Vector4<float>* vectors , std::size_t count , uint8_t* texels )
+		{
+			toSrgba8 ( &vectors[0].x , count , texels );
+		}
+
+		void fromSrgba8 ( const uint8_t* texels , std::size_t count , Vector4<float>* vectors )
+		{
+			fromSrgba8 ( texels , count , &vectors[0].x );
+		}
+
+		void toHalf ( const Color* colors , std::size_t count , uint16_t* halves )
+		{
+			fromColors ( kernels ( ).toHalf , colors , count , halves , 1 );
+		}
+
+		void fromHalf ( const uint16_t* halves , std::size_t count , Color* colors )
+		{
+			toColors ( kernels ( ).fromHalf , halves , count , colors , 1 );
+		}
+
+		void toUnorm8 ( const Color* colors , std::size_t count , uint8_t* texels )
+		{
+			fromColors ( kernels ( ).toUnorm8 , colors , count , texels , 1 );
+		}
+
+		void fromUnorm8 ( const uint8_t* texels , std::size_t count , Color* colors )
+		{
+			toColors ( kernels ( ).fromUnorm8 , texels , count , colors , 1 );
+		}
+
+		void toSrgba8 ( const Color* colors , std::size_t count , uint8_t* texels )
+		{
+			fromColors ( kernels ( ).toSrgba8 , colors , count , texels , 4 );
+		}
+
+		void fromSrgba8 ( const uint8_t* texels , std::size_t count , Color* colors )
+		{
+			toColors ( kernels ( ).fromSrgba8 , texels , count , colors , 4 );
+		}
+
+		uint16_t toHalf ( float value )
+		{
+			return Half::fromFloat ( value );
+		}
+
+		float fromHalf ( uint16_t half )
+		{
+			return Half::toFloat ( half );
+		}
+
+		uint8_t toUnorm8 ( float value )
+		{
+			return static_cast<uint8_t> ( clamp ( value ) * 255.0f + 0.5f );
+		}
+
+		float fromUnorm8 ( uint8_t byte )
+		{
+			return byte / 255.0f;
+		}
+
+		uint16_t toUnorm16 ( float value )
+		{
+			return static_cast<uint16_t> ( clamp ( value ) * 65535.0f + 0.5f );
+		}
+
+		float fromUnorm16 ( uint16_t word )
+		{
+			return word / 65535.0f;
+		}
+
+		uint8_t toSrgb8 ( float value )
+		{
+			return static_cast<uint8_t> ( std::floor ( srgbCurve ( clamp ( value ) ) * 255.0 + 0.5 ) );
+		}
+
+		float fromSrgb8 ( uint8_t byte )
+		{
+			return static_cast<float> ( linearCurve ( byte / 255.0 ) );
+		}
+	}
+
+}/* Celer :: NAMESPACE */
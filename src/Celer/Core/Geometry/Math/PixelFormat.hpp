@@ -0,0 +1,122 @@
+#ifndef CELER_PIXELFORMAT_HPP_
+#define CELER_PIXELFORMAT_HPP_
+
+//- Celer/Core/Geometry/Math/PixelFormat.hpp - Texel conversions ------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Math Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the conversions between float and the half ,
+//        unorm8 , unorm16 and sRGB texel formats , over raw arrays and over
+//        arrays of Vector4 and Color , with the fastest kernels the CPU runs.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstddef>
+#include <stdint.h>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector4.hpp>
+#include <Celer/Core/Geometry/Math/Color.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@brief Array conversions between float and the packed texel formats.
+	 *@details Every array function picks , on its first call , the best of
+	 * three kernel sets the CPU runs: AVX2 with F16C , eight values at a
+	 * time , SSE2 , four at a time , and plain C++. All three give the same
+	 * bits as the scalar functions at the end of this file , which are the
+	 * reference:
+	 * - half: round to nearest even , as Half::fromFloat ( ) and F16C.
+	 * - unorm: clamp to [0 , 1] , NaN to 0 , then int ( x * max + 0.5 ).
+	 *   Back it is q / max , correctly rounded.
+	 * - sRGB: the IEC 61966-2-1 curve in double , rounded to the nearest
+	 *   byte. The kernels look up the byte in a table of float buckets and
+	 *   fix it with one threshold compare , exact for every float.
+	 *
+	 * Large arrays are split in blocks across threads. RGBA functions run
+	 * the color channels through sRGB and keep alpha linear. A Color is
+	 * red , green , blue and alfa , a Vector4 is x y z w.
+	 *
+	 * \code
+	 * std::vector<GLubyte> texels ( 4 * width * height );
+	 * Celer::PixelFormat::toSrgba8 ( &image[0] , width * height , &texels[0] );
+	 * texture.loadFromRawData ( &texels[0] );
+	 * \endcode
+	 */
+	namespace PixelFormat
+	{
+		enum Path
+		{
+			SCALAR ,	///< Plain C++.
+			SSE2 , 		///< Four lanes.
+			AVX2 		///< Eight lanes , with F16C.
+		};
+
+		/// The kernels in use.
+		Path path ( );
+
+		/// The best kernels this CPU and this build run.
+		Path best ( );
+
+		/// Uses path , or best ( ) when that is lower. For tests and benchmarks.
+		void force ( Path path );
+
+		const char* name ( Path path );
+
+		/// count values each way.
+		void toHalf ( const float* values , std::size_t count , uint16_t* halves );
+		void fromHalf ( const uint16_t* halves , std::size_t count , float* values );
+
+		void toUnorm8 ( const float* values , std::size_t count , uint8_t* bytes );
+		void fromUnorm8 ( const uint8_t* bytes , std::size_t count , float* values );
+
+		void toUnorm16 ( const float* values , std::size_t count , uint16_t* words );
+		void fromUnorm16 ( const uint16_t* words , std::size_t count , float* values );
+
+		/// Every value through the sRGB curve.
+		void toSrgb8 ( const float* values , std::size_t count , uint8_t* bytes );
+		void fromSrgb8 ( const uint8_t* bytes , std::size_t count , float* values );
+
+		/// count RGBA texels , four floats or four bytes each , alpha linear.
+		void toSrgba8 ( const float* rgba , std::size_t count , uint8_t* texels );
+		void fromSrgba8 ( const uint8_t* texels , std::size_t count , float* rgba );
+
+		/// count vectors , four channels each.
+		void toHalf ( const Vector4<float>* vectors , std::size_t count , uint16_t* halves );
+		void fromHalf ( const uint16_t* halves , std::size_t count , Vector4<float>* vectors );
+		void toUnorm8 ( const Vector4<float>* vectors , std::size_t count , uint8_t* texels );
+		void fromUnorm8 ( const uint8_t* texels , std::size_t count , Vector4<float>* vectors );
+		void toSrgba8 ( const Vector4<float>* vectors , std::size_t count , uint8_t* texels );
+		void fromSrgba8 ( const uint8_t* texels , std::size_t count , Vector4<float>* vectors );
+
+		/// count colors , four channels each.
+		void toHalf ( const Color* colors , std::size_t count , uint16_t* halves );
+		void fromHalf ( const uint16_t* halves , std::size_t count , Color* colors );
+		void toUnorm8 ( const Color* colors , std::size_t count , uint8_t* texels );
+		void fromUnorm8 ( const uint8_t* texels , std::size_t count , Color* colors );
+		void toSrgba8 ( const Color* colors , std::size_t count , uint8_t* texels );
+		void fromSrgba8 ( const uint8_t* texels , std::size_t count , Color* colors );
+
+		/// The references , one value.
+		uint16_t toHalf ( float value );
+		float fromHalf ( uint16_t half );
+		uint8_t toUnorm8 ( float value );
+		float fromUnorm8 ( uint8_t byte );
+		uint16_t toUnorm16 ( float value );
+		float fromUnorm16 ( uint16_t word );
+		uint8_t toSrgb8 ( float value );
+		float fromSrgb8 ( uint8_t byte );
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_PIXELFORMAT_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * QuaternionCodec.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Math/QuaternionCodec.hpp>
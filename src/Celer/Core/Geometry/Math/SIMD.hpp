@@ -0,0 +1,336 @@
+#ifndef CELER_SIMD_HPP_
+#define CELER_SIMD_HPP_
+
+//- Celer/Core/Geometry/Math/SIMD.hpp - Four float lanes -----------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Math Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains Float4 and Mask4, four float lanes used by the
+//        batch kernels, on SSE when the compiler targets it and on plain
+//        arrays otherwise.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cmath>
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CELER_SIMD_SSE 1
+#endif
+
+namespace Celer
+{
+	namespace SIMD
+	{
+		/*!
+		 *@brief Four lanes of comparison results, all bits set where true.
+		 */
+		struct Mask4
+		{
+#if defined(CELER_SIMD_SSE)
+			__m128 v;
+
+			Mask4 ( ) { }
+			explicit Mask4 ( __m128 mask ) : v ( mask ) { }
+
+			Mask4 operator& ( const Mask4& o ) const { return Mask4 ( _mm_and_ps ( v , o.v ) ); }
+			Mask4 operator| ( const Mask4& o ) const { return Mask4 ( _mm_or_ps ( v , o.v ) ); }
+			Mask4 operator^ ( const Mask4& o ) const { return Mask4 ( _mm_xor_ps ( v , o.v ) ); }
+
+			/// One bit per lane, lane 0 in bit 0.
+			int bits ( ) const { return _mm_movemask_ps ( v ); }
+#else
+			bool v[4];
+
+			Mask4 ( ) { }
+
+			Mask4 operator& ( const Mask4& o ) const { Mask4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] && o.v[i]; return r; }
+			Mask4 operator| ( const Mask4& o ) const { Mask4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] || o.v[i]; return r; }
+			Mask4 operator^ ( const Mask4& o ) const { Mask4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] != o.v[i]; return r; }
+
+			int bits ( ) const { return v[0] | ( v[1] << 1 ) | ( v[2] << 2 ) | ( v[3] << 3 ); }
+#endif
+		};
+
+		/*!
+		 *@brief Four float lanes with the arithmetic the kernels need.
+		 *@details The operators mirror the scalar ones, so branch-free code
+		 * written with select ( ) compiles both for Real and for Float4.
+		 */
+		struct Float4
+		{
+#if defined(CELER_SIMD_SSE)
+			__m128 v;
+
+			Float4 ( ) { }
+			Float4 ( float s ) : v ( _mm_set1_ps ( s ) ) { }
+			explicit Float4 ( __m128 lanes ) : v ( lanes ) { }
+			Float4 ( float a , float b , float c , float d ) : v ( _mm_setr_ps ( a , b , c , d ) ) { }
+
+			static Float4 load ( const float* p ) { return Float4 ( _mm_loadu_ps ( p ) ); }
+			void store ( float* p ) const { _mm_storeu_ps ( p , v ); }
+
+			float operator[] ( int i ) const { float lanes[4]; store ( lanes ); return lanes[i]; }
+
+			Float4 operator- ( ) const { return Float4 ( _mm_xor_ps ( v , _mm_set1_ps ( -0.0f ) ) ); }
+			Float4 operator+ ( const Float4& o ) const { return Float4 ( _mm_add_ps ( v , o.v ) ); }
+			Float4 operator- ( const Float4& o ) const { return Float4 ( _mm_sub_ps ( v , o.v ) ); }
+			Float4 operator* ( const Float4& o ) const { return Float4 ( _mm_mul_ps ( v , o.v ) ); }
+			Float4 operator/ ( const Float4& o ) const { return Float4 ( _mm_div_ps ( v , o.v ) ); }
+
+			Mask4 operator< ( const Float4& o ) const { return Mask4 ( _mm_cmplt_ps ( v , o.v ) ); }
+			Mask4 operator<= ( const Float4& o ) const { return Mask4 ( _mm_cmple_ps ( v , o.v ) ); }
+			Mask4 operator> ( const Float4& o ) const { return Mask4 ( _mm_cmpgt_ps ( v , o.v ) ); }
+			Mask4 operator>= ( const Float4& o ) const { return Mask4 ( _mm_cmpge_ps ( v , o.v ) ); }
+#else
+			float v[4];
+
+			Float4 ( ) { }
+			Float4 ( float s ) { v[0] = v[1] = v[2] = v[3] = s; }
+			Float4 ( float a , float b , float c , float d ) { v[0] = a; v[1] = b; v[2] = c; v[3] = d; }
+
+			static Float4 load ( const float* p ) { return Float4 ( p[0] , p[1] , p[2] , p[3] ); }
+			void store ( float* p ) const { for ( int i = 0; i < 4; ++i ) p[i] = v[i]; }
+
+			float operator[] ( int i ) const { return v[i]; }
+
+			Float4 operator- ( ) const { return Float4 ( -v[0] , -v[1] , -v[2] , -v[3] ); }
+			Float4 operator+ ( const Float4& o ) const { return Float4 ( v[0] + o.v[0] , v[1] + o.v[1] , v[2] + o.v[2] , v[3] + o.v[3] ); }
+			Float4 operator- ( const Float4& o ) const { return Float4 ( v[0] - o.v[0] , v[1] - o.v[1] , v[2] - o.v[2] , v[3] - o.v[3] ); }
+			Float4 operator* ( const Float4& o ) const { return Float4 ( v[0] * o.v[0] , v[1] * o.v[1] , v[2] * o.v[2] , v[3] * o.v[3] ); }
+			Float4 operator/ ( const Float4& o ) const { return Float4 ( v[0] / o.v[0] , v[1] / o.v[1] , v[2] / o.v[2] , v[3] / o.v[3] ); }
+
+			Mask4 operator< ( const Float4& o ) const { Mask4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] < o.v[i]; return r; }
+			Mask4 operator<= ( const Float4& o ) const { Mask4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] <= o.v[i]; return r; }
+			Mask4 operator> ( const Float4& o ) const { Mask4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] > o.v[i]; return r; }
+			Mask4 operator>= ( const Float4& o ) const { Mask4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] >= o.v[i]; return r; }
+#endif
+
+			Float4& operator+= ( const Float4& o ) { return *this = *this + o; }
+			Float4& operator-= ( const Float4& o ) { return *this = *this - o; }
+			Float4& operator*= ( const Float4& o ) { return *this = *this * o; }
+		};
+
+		inline Float4 operator+ ( float s , const Float4& a ) { return Float4 ( s ) + a; }
+		inline Float4 operator- ( float s , const Float4& a ) { return Float4 ( s ) - a; }
+		inline Float4 operator* ( float s , const Float4& a ) { return Float4 ( s ) * a; }
+
+#if defined(CELER_SIMD_SSE)
+		inline Float4 select ( const Mask4& c , const Float4& a , const Float4& b )
+		{
+			return Float4 ( _mm_or_ps ( _mm_and_ps ( c.v , a.v ) , _mm_andnot_ps ( c.v , b.v ) ) );
+		}
+
+		inline Float4 sqrt ( const Float4& a ) { return Float4 ( _mm_sqrt_ps ( a.v ) ); }
+		inline Float4 min ( const Float4& a , const Float4& b ) { return Float4 ( _mm_min_ps ( a.v , b.v ) ); }
+		inline Float4 max ( const Float4& a , const Float4& b ) { return Float4 ( _mm_max_ps ( a.v , b.v ) ); }
+		inline Float4 abs ( const Float4& a ) { return Float4 ( _mm_andnot_ps ( _mm_set1_ps ( -0.0f ) , a.v ) ); }
+#else
+		inline Float4 select ( const Mask4& c , const Float4& a , const Float4& b )
+		{
+			Float4 r;
+			for ( int i = 0; i < 4; ++i ) r.v[i] = c.v[i] ? a.v[i] : b.v[i];
+			return r;
+		}
+
+		inline Float4 sqrt ( const Float4& a ) { Float4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = std::sqrt ( a.v[i] ); return r; }
+		inline Float4 min ( const Float4& a , const Float4& b ) { Float4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = std::min ( a.v[i] , b.v[i] ); return r; }
+		inline Float4 max ( const Float4& a , const Float4& b ) { Float4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = std::max ( a.v[i] , b.v[i] ); return r; }
+		inline Float4 abs ( const Float4& a ) { Float4 r; for ( int i = 0; i < 4; ++i ) r.v[i] = std::fabs ( a.v[i] ); return r; }
+#endif
+
+#if defined(CELER_SIMD_SSE)
+		/// Estimate refined by one Newton step , about 23 bits. a must be positive.
+		inline Float4 rsqrt ( const Float4& a )
+		{
+			Float4 r ( _mm_rsqrt_ps ( a.v ) );
+			return r * ( Float4 ( 1.5f ) - Float4 ( 0.5f ) * a * r * r );
+		}
+#else
+		inline Float4 rsqrt ( const Float4& a ) { return Float4 ( 1.0f ) / sqrt ( a ); }
+#endif
+
+		/*!
+		 *@brief Rounds half away from zero and stores the four lanes as int.
+		 *@details Lanes must be below 2^31 in magnitude. The scalar roundToInt
+		 * adds the same 0.5 in float , so both give the same integers.
+		 */
+#if defined(CELER_SIMD_SSE)
+		inline void roundToInt ( const Float4& a , int* p )
+		{
+			__m128 half = _mm_or_ps ( _mm_and_ps ( a.v , _mm_set1_ps ( -0.0f ) ) , _mm_set1_ps ( 0.5f ) );
+			_mm_storeu_si128 ( reinterpret_cast<__m128i*> ( p ) , _mm_cvttps_epi32 ( _mm_add_ps ( a.v , half ) ) );
+		}
+#else
+		inline void roundToInt ( const Float4& a , int* p )
+		{
+			for ( int i = 0; i < 4; ++i ) p[i] = static_cast<int> ( a.v[i] + ( a.v[i] < 0.0f ? -0.5f : 0.5f ) );
+		}
+#endif
+
+		/*!
+		 *@brief Loads four packed xyz points , 12 floats , as one Float4 per axis.
+		 */
+#if defined(CELER_SIMD_SSE)
+		inline void loadPoints ( const float* p , Float4& x , Float4& y , Float4& z )
+		{
+			__m128 a = _mm_loadu_ps ( p );		// x0 y0 z0 x1
+			__m128 b = _mm_loadu_ps ( p + 4 );	// y1 z1 x2 y2
+			__m128 c = _mm_loadu_ps ( p + 8 );	// z2 x3 y3 z3
+
+			x = Float4 ( _mm_shuffle_ps ( _mm_shuffle_ps ( a , a , _MM_SHUFFLE ( 3 , 3 , 0 , 0 ) ) ,
+			                              _mm_shuffle_ps ( b , c , _MM_SHUFFLE ( 1 , 1 , 2 , 2 ) ) , _MM_SHUFFLE ( 2 , 0 , 2 , 0 ) ) );
+			y = Float4 ( _mm_shuffle_ps ( _mm_shuffle_ps ( a , b , _MM_SHUFFLE ( 0 , 0 , 1 , 1 ) ) ,
+			                              _mm_shuffle_ps ( b , c , _MM_SHUFFLE ( 2 , 2 , 3 , 3 ) ) , _MM_SHUFFLE ( 2 , 0 , 2 , 0 ) ) );
+			z = Float4 ( _mm_shuffle_ps ( _mm_shuffle_ps ( a , b , _MM_SHUFFLE ( 1 , 1 , 2 , 2 ) ) ,
+			                              _mm_shuffle_ps ( c , c , _MM_SHUFFLE ( 3 , 3 , 0 , 0 ) ) , _MM_SHUFFLE ( 2 , 0 , 2 , 0 ) ) );
+		}
+#else
+		inline void loadPoints ( const float* p , Float4& x , Float4& y , Float4& z )
+		{
+			x = Float4 ( p[0] , p[3] , p[6] , p[9] );
+			y = Float4 ( p[1] , p[4] , p[7] , p[10] );
+			z = Float4 ( p[2] , p[5] , p[8] , p[11] );
+		}
+#endif
+
+		/*!
+		 *@brief Transposes four Float4 , the rows of a 4x4 matrix , in place.
+		 */
+#if defined(CELER_SIMD_SSE)
+		inline void transpose ( Float4& a , Float4& b , Float4& c , Float4& d )
+		{
+			_MM_TRANSPOSE4_PS ( a.v , b.v , c.v , d.v );
+		}
+#else
+		inline void transpose ( Float4& a , Float4& b , Float4& c , Float4& d )
+		{
+			Float4* rows[4] = { &a , &b , &c , &d };
+			for ( int i = 0; i < 4; ++i )
+				for ( int j = i + 1; j < 4; ++j )
+					std::swap ( rows[i]->v[j] , rows[j]->v[i] );
+		}
+#endif
+
+		/*!
+		 *@brief Four lanes of any scalar type on plain arrays.
+		 *@details The interface of Float4 , for the types SSE does not cover , so
+		 * classes written over Lanes<Real>::Type work for float and double.
+		 */
+		template < class Real >
+		struct Lanes4
+		{
+			struct Mask
+			{
+				bool v[4];
+
+				Mask operator& ( const Mask& o ) const { Mask r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] && o.v[i]; return r; }
+				Mask operator| ( const Mask& o ) const { Mask r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] || o.v[i]; return r; }
+
+				int bits ( ) const { return v[0] | ( v[1] << 1 ) | ( v[2] << 2 ) | ( v[3] << 3 ); }
+			};
+
+			Real v[4];
+
+			Lanes4 ( ) { }
+			Lanes4 ( Real s ) { v[0] = v[1] = v[2] = v[3] = s; }
+			Lanes4 ( Real a , Real b , Real c , Real d ) { v[0] = a; v[1] = b; v[2] = c; v[3] = d; }
+
+			static Lanes4 load ( const Real* p ) { return Lanes4 ( p[0] , p[1] , p[2] , p[3] ); }
+			void store ( Real* p ) const { for ( int i = 0; i < 4; ++i ) p[i] = v[i]; }
+
+			Real operator[] ( int i ) const { return v[i]; }
+
+			Lanes4 operator- ( ) const { return Lanes4 ( -v[0] , -v[1] , -v[2] , -v[3] ); }
+			Lanes4 operator+ ( const Lanes4& o ) const { return Lanes4 ( v[0] + o.v[0] , v[1] + o.v[1] , v[2] + o.v[2] , v[3] + o.v[3] ); }
+			Lanes4 operator- ( const Lanes4& o ) const { return Lanes4 ( v[0] - o.v[0] , v[1] - o.v[1] , v[2] - o.v[2] , v[3] - o.v[3] ); }
+			Lanes4 operator* ( const Lanes4& o ) const { return Lanes4 ( v[0] * o.v[0] , v[1] * o.v[1] , v[2] * o.v[2] , v[3] * o.v[3] ); }
+			Lanes4 operator/ ( const Lanes4& o ) const { return Lanes4 ( v[0] / o.v[0] , v[1] / o.v[1] , v[2] / o.v[2] , v[3] / o.v[3] ); }
+
+			Mask operator< ( const Lanes4& o ) const { Mask r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] < o.v[i]; return r; }
+			Mask operator<= ( const Lanes4& o ) const { Mask r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] <= o.v[i]; return r; }
+			Mask operator> ( const Lanes4& o ) const { Mask r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] > o.v[i]; return r; }
+			Mask operator>= ( const Lanes4& o ) const { Mask r; for ( int i = 0; i < 4; ++i ) r.v[i] = v[i] >= o.v[i]; return r; }
+
+			Lanes4& operator+= ( const Lanes4& o ) { return *this = *this + o; }
+			Lanes4& operator-= ( const Lanes4& o ) { return *this = *this - o; }
+			Lanes4& operator*= ( const Lanes4& o ) { return *this = *this * o; }
+		};
+
+		template < class Real >
+		inline Lanes4<Real> min ( const Lanes4<Real>& a , const Lanes4<Real>& b ) { Lanes4<Real> r; for ( int i = 0; i < 4; ++i ) r.v[i] = std::min ( a.v[i] , b.v[i] ); return r; }
+		template < class Real >
+		inline Lanes4<Real> max ( const Lanes4<Real>& a , const Lanes4<Real>& b ) { Lanes4<Real> r; for ( int i = 0; i < 4; ++i ) r.v[i] = std::max ( a.v[i] , b.v[i] ); return r; }
+
+		/// The four lane type of a scalar , Float4 for float.
+		template < class Real >
+		struct Lanes
+		{
+			typedef Lanes4<Real> Type;
+		};
+
+		template < >
+		struct Lanes<float>
+		{
+			typedef Float4 Type;
+		};
+
+		/// The comparison result of a lane type.
+		template < class T >
+		struct Traits
+		{
+			typedef bool Mask;
+			enum { kLanes = 1 };
+		};
+
+		template < >
+		struct Traits<Float4>
+		{
+			typedef Mask4 Mask;
+			enum { kLanes = 4 };
+		};
+
+		/// The type a batch kernel runs on , Float4 for float and the scalar itself otherwise.
+		template < class Real >
+		struct Batch
+		{
+			typedef Real Type;
+		};
+
+		template < >
+		struct Batch<float>
+		{
+			typedef Float4 Type;
+		};
+
+		/// Scalar counterparts, so the same kernel instantiates with float or double.
+		template < class Real >
+		inline Real select ( bool c , const Real& a , const Real& b ) { return c ? a : b; }
+
+		inline float sqrt ( float a ) { return std::sqrt ( a ); }
+		inline double sqrt ( double a ) { return std::sqrt ( a ); }
+		inline float rsqrt ( float a ) { return 1.0f / std::sqrt ( a ); }
+		inline double rsqrt ( double a ) { return 1.0 / std::sqrt ( a ); }
+		inline float abs ( float a ) { return std::fabs ( a ); }
+		inline double abs ( double a ) { return std::fabs ( a ); }
+		inline float min ( float a , float b ) { return std::min ( a , b ); }
+		inline double min ( double a , double b ) { return std::min ( a , b ); }
+		inline float max ( float a , float b ) { return std::max ( a , b ); }
+		inline double max ( double a , double b ) { return std::max ( a , b ); }
+		inline int roundToInt ( float a ) { return static_cast<int> ( a + ( a < 0.0f ? -0.5f : 0.5f ) ); }
+		inline int roundToInt ( double a ) { return static_cast<int> ( a + ( a < 0.0 ? -0.5 : 0.5 ) ); }
+
+	}
+}
+
+#endif /* CELER_SIMD_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * SingularValueDecomposition.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Math/SingularValueDecomposition.hpp>
@@ -0,0 +1,545 @@
+#ifndef CELER_SINGULARVALUEDECOMPOSITION_HPP_
+#define CELER_SINGULARVALUEDECOMPOSITION_HPP_
+
+//- Celer/Core/Geometry/Math/SingularValueDecomposition.hpp - 3x3 SVD -----//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Math Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the SingularValueDecomposition
+//        class, a branch-free 3x3 SVD and the polar decomposition built on it.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstddef>
+/// Celer Library
+#include <Celer/Base/Parallel.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix3x3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class SingularValueDecomposition.
+	 *@brief Singular value decomposition A = U Sigma V^T of 3x3 matrices.
+	 *@details Follows McAdams et al., "Computing the Singular Value
+	 * Decomposition of 3x3 matrices with minimal branching and elementary
+	 * floating point operations" (2011):
+	 *
+	 * - A fixed number of Jacobi sweeps over A^T A, each rotation an
+	 *   approximate Givens quaternion, gives V.
+	 * - The columns of B = A V are sorted by decreasing norm.
+	 * - A Givens QR of B gives U and the singular values on the diagonal of R.
+	 *
+	 * Every choice is a select ( ) instead of a branch, so the kernel is written
+	 * once and instantiated both for Real and for SIMD::Float4, the latter
+	 * decomposing four matrices per call in the batch functions.
+	 *
+	 * U and V are always rotations. For det ( A ) < 0 the sign goes to the
+	 * smallest singular value, which makes rotation ( ) the closest rotation to
+	 * A, as wanted by deformation and shape matching codes, and stretch ( ) a
+	 * symmetric but indefinite matrix.
+	 *
+	 * With float the orthogonality of U and V is near 1e-6 and the residual
+	 * of U Sigma V^T near 1e-6 |A|. Double runs more sweeps and reaches 1e-12.
+	 */
+	template < class Real >
+	class SingularValueDecomposition
+	{
+		public:
+
+			typedef Celer::Vector3<Real>	Vector3;
+			typedef Celer::Matrix3x3<Real>	Matrix3x3;
+
+			SingularValueDecomposition ( );
+			SingularValueDecomposition ( const Matrix3x3& a );
+
+			void decompose ( const Matrix3x3& a );
+
+			const Matrix3x3& u ( ) const { return u_; }
+			const Vector3& sigma ( ) const { return sigma_; }
+			const Matrix3x3& v ( ) const { return v_; }
+
+			/// Rotation R = U V^T of the polar decomposition A = R S.
+			Matrix3x3 rotation ( ) const;
+			/// Symmetric S = V Sigma V^T of the polar decomposition A = R S.
+			Matrix3x3 stretch ( ) const;
+
+			/// Decomposes count matrices. Any of the outputs may be null.
+			static void decompose ( const Matrix3x3* a , std::size_t count , Matrix3x3* u , Vector3* sigma , Matrix3x3* v );
+			/// Polar decomposition of count matrices. Either output may be null.
+			static void polar ( const Matrix3x3* a , std::size_t count , Matrix3x3* rotation , Matrix3x3* stretch );
+
+		private:
+
+			enum { kBlock = 64 };
+
+			/// Givens fallback of McAdams et al. The paper stops after four sweeps,
+			/// six keep the float residual below 1e-5 on random matrices.
+			static Real gamma ( ) { return static_cast<Real> ( 5.828427124746190 ); }
+			static Real cosPi8 ( ) { return static_cast<Real> ( 0.923879532511287 ); }
+			static Real sinPi8 ( ) { return static_cast<Real> ( 0.382683432365090 ); }
+			static Real epsilon ( ) { return static_cast<Real> ( sizeof ( Real ) > 4 ? 1e-15 : 1e-6 ); }
+			static int sweeps ( ) { return sizeof ( Real ) > 4 ? 8 : 6; }
+
+			template < class T >
+			static void condSwap ( const typename SIMD::Traits<T>::Mask& c , T& x , T& y );
+			template < class T >
+			static void condNegSwap ( const typename SIMD::Traits<T>::Mask& c , T& x , T& y );
+
+			template < class T >
+			static void approximateGivens ( const T& a11 , const T& a12 , const T& a22 , T& ch , T& sh );
+			template < class T >
+			static void qrGivens ( const T& a1 , const T& a2 , T& ch , T& sh );
+			template < class T >
+			static void jacobiConjugation ( int x , int y , int z , T s[6] , T q[4] );
+
+			/// Row major a, u and v.
+			template < class T >
+			static void kernel ( const T a[9] , T u[9] , T sigma[3] , T v[9] );
+
+			static void store ( std::size_t i , const Real u[9] , const Real sigma[3] , const Real v[9] ,
+			                    Matrix3x3* us , Vector3* sigmas , Matrix3x3* vs , Matrix3x3* rotations , Matrix3x3* stretches );
+			/// Decomposes a[first, last) , specialized below for four float lanes.
+			static void batch ( const Matrix3x3* a , std::size_t first , std::size_t last ,
+			                    Matrix3x3* u , Vector3* sigma , Matrix3x3* v , Matrix3x3* rotation , Matrix3x3* stretch );
+			static void run ( const Matrix3x3* a , std::size_t count ,
+			                  Matrix3x3* u , Vector3* sigma , Matrix3x3* v , Matrix3x3* rotation , Matrix3x3* stretch );
+
+			Matrix3x3 u_;
+			Vector3 sigma_;
+			Matrix3x3 v_;
+	};
+
+	template < class Real >
+	SingularValueDecomposition<Real>::SingularValueDecomposition ( ) : sigma_ ( 1 , 1 , 1 )
+	{
+	}
+
+	template < class Real >
+	SingularValueDecomposition<Real>::SingularValueDecomposition ( const Matrix3x3& a )
+	{
+		decompose ( a );
+	}
+
+	template < class Real >
+	template < class T >
+	inline void SingularValueDecomposition<Real>::condSwap ( const typename SIMD::Traits<T>::Mask& c , T& x , T& y )
+	{
+		T z = x;
+		x = SIMD::select ( c , y , x );
+		y = SIMD::select ( c , z , y );
+	}
+
+	template < class Real >
+	template < class T >
+	inline void SingularValueDecomposition<Real>::condNegSwap ( const typename SIMD::Traits<T>::Mask& c , T& x , T& y )
+	{
+		T z = -x;
+		x = SIMD::select ( c , y , x );
+		y = SIMD::select ( c , z , y );
+	}
+
+	/// Half-angle quaternion ( ch , sh ) of the rotation annihilating a12 of
+	/// the symmetric [ a11 a12 ; a12 a22 ] , or a pi/8 turn when the exact
+	/// angle would be too large.
+	template < class Real >
+	template < class T >
+	inline void SingularValueDecomposition<Real>::approximateGivens ( const T& a11 , const T& a12 , const T& a22 , T& ch , T& sh )
+	{
+		ch = T ( static_cast<Real> ( 2 ) ) * ( a11 - a22 );
+		sh = a12;
+
+		typename SIMD::Traits<T>::Mask b = T ( gamma ( ) ) * sh * sh < ch * ch;
+		T w = SIMD::rsqrt ( ch * ch + sh * sh );
+
+		ch = SIMD::select ( b , w * ch , T ( cosPi8 ( ) ) );
+		sh = SIMD::select ( b , w * sh , T ( sinPi8 ( ) ) );
+	}
+
+	/// Half-angle quaternion ( ch , sh ) of the rotation annihilating a2 below
+	/// the pivot a1.
+	template < class Real >
+	template < class T >
+	inline void SingularValueDecomposition<Real>::qrGivens ( const T& a1 , const T& a2 , T& ch , T& sh )
+	{
+		T rho = SIMD::sqrt ( a1 * a1 + a2 * a2 );
+
+		sh = SIMD::select ( rho > T ( epsilon ( ) ) , a2 , T ( static_cast<Real> ( 0 ) ) );
+		ch = SIMD::abs ( a1 ) + SIMD::max ( rho , T ( epsilon ( ) ) );
+
+		condSwap<T> ( a1 < T ( static_cast<Real> ( 0 ) ) , sh , ch );
+
+		T w = SIMD::rsqrt ( ch * ch + sh * sh );
+		ch *= w;
+		sh *= w;
+	}
+
+	/// One Jacobi step on the symmetric s = ( s11 , s21 , s22 , s31 , s32 , s33 ) ,
+	/// accumulating the rotation into q = ( x , y , z , w ). The matrix is
+	/// cycled afterwards, so the next call works on the next pair.
+	template < class Real >
+	template < class T >
+	inline void SingularValueDecomposition<Real>::jacobiConjugation ( int x , int y , int z , T s[6] , T q[4] )
+	{
+		T ch;
+		T sh;
+		approximateGivens ( s[0] , s[1] , s[2] , ch , sh );
+
+		/// ( ch , sh ) is a unit quaternion on both paths of approximateGivens.
+		T a = ch * ch - sh * sh;
+		T b = T ( static_cast<Real> ( 2 ) ) * sh * ch;
+
+		T s11 = s[0] , s21 = s[1] , s22 = s[2] , s31 = s[3] , s32 = s[4] , s33 = s[5];
+
+		/// S = Q^T S Q , then cycled.
+		s[0] = -b * ( -b * s11 + a * s21 ) + a * ( -b * s21 + a * s22 );
+		s[1] = -b * s31 + a * s32;
+		s[2] = s33;
+		s[3] = a * ( -b * s11 + a * s21 ) + b * ( -b * s21 + a * s22 );
+		s[4] = a * s31 + b * s32;
+		s[5] = a * ( a * s11 + b * s21 ) + b * ( a * s21 + b * s22 );
+
+		T t[3] = { q[0] * sh , q[1] * sh , q[2] * sh };
+		sh = sh * q[3];
+
+		q[0] *= ch;
+		q[1] *= ch;
+		q[2] *= ch;
+		q[3] *= ch;
+
+		q[z] += sh;
+		q[3] -= t[z];
+		q[x] += t[y];
+		q[y] -= t[x];
+	}
+
+	template < class Real >
+	template < class T >
+	void SingularValueDecomposition<Real>::kernel ( const T a[9] , T u[9] , T sigma[3] , T v[9] )
+	{
+		const T zero ( static_cast<Real> ( 0 ) );
+		const T one ( static_cast<Real> ( 1 ) );
+		const T two ( static_cast<Real> ( 2 ) );
+
+		/// Symmetric A^T A , lower triangle.
+		T s[6];
+		s[0] = a[0] * a[0] + a[3] * a[3] + a[6] * a[6];
+		s[1] = a[1] * a[0] + a[4] * a[3] + a[7] * a[6];
+		s[2] = a[1] * a[1] + a[4] * a[4] + a[7] * a[7];
+		s[3] = a[2] * a[0] + a[5] * a[3] + a[8] * a[6];
+		s[4] = a[2] * a[1] + a[5] * a[4] + a[8] * a[7];
+		s[5] = a[2] * a[2] + a[5] * a[5] + a[8] * a[8];
+
+		T q[4] = { zero , zero , zero , one };
+
+		for ( int i = 0; i < sweeps ( ); ++i )
+		{
+			jacobiConjugation ( 0 , 1 , 2 , s , q );
+			jacobiConjugation ( 1 , 2 , 0 , s , q );
+			jacobiConjugation ( 2 , 0 , 1 , s , q );
+		}
+
+		/// V from the normalized quaternion.
+		T n = SIMD::rsqrt ( q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3] );
+		T qx = q[0] * n , qy = q[1] * n , qz = q[2] * n , qw = q[3] * n;
+
+		v[0] = one - two * ( qy * qy + qz * qz );
+		v[1] = two * ( qx * qy - qw * qz );
+		v[2] = two * ( qx * qz + qw * qy );
+		v[3] = two * ( qx * qy + qw * qz );
+		v[4] = one - two * ( qx * qx + qz * qz );
+		v[5] = two * ( qy * qz - qw * qx );
+		v[6] = two * ( qx * qz - qw * qy );
+		v[7] = two * ( qy * qz + qw * qx );
+		v[8] = one - two * ( qx * qx + qy * qy );
+
+		/// B = A V
+		T b[9];
+		for ( int r = 0; r < 3; ++r )
+		{
+			for ( int c = 0; c < 3; ++c )
+			{
+				b[3 * r + c] = a[3 * r] * v[c] + a[3 * r + 1] * v[3 + c] + a[3 * r + 2] * v[6 + c];
+			}
+		}
+
+		/// Sort the columns by decreasing norm , negating one of each swapped
+		/// pair keeps V a rotation.
+		T rho[3];
+		for ( int c = 0; c < 3; ++c )
+		{
+			rho[c] = b[c] * b[c] + b[3 + c] * b[3 + c] + b[6 + c] * b[6 + c];
+		}
+
+		static const int pairs[3][2] = { { 0 , 1 } , { 0 , 2 } , { 1 , 2 } };
+		for ( int p = 0; p < 3; ++p )
+		{
+			int i = pairs[p][0];
+			int j = pairs[p][1];
+			typename SIMD::Traits<T>::Mask c = rho[i] < rho[j];
+			for ( int r = 0; r < 3; ++r )
+			{
+				condNegSwap<T> ( c , b[3 * r + i] , b[3 * r + j] );
+				condNegSwap<T> ( c , v[3 * r + i] , v[3 * r + j] );
+			}
+			condSwap<T> ( c , rho[i] , rho[j] );
+		}
+
+		/// QR of B by three Givens rotations: ( 1 , 0 ) , ( 2 , 0 ) , ( 2 , 1 ).
+		T ch1 , sh1 , ch2 , sh2 , ch3 , sh3;
+		T r[9];
+
+		qrGivens ( b[0] , b[3] , ch1 , sh1 );
+		T ca = one - two * sh1 * sh1;
+		T sb = two * ch1 * sh1;
+		for ( int c = 0; c < 3; ++c )
+		{
+			r[c] = ca * b[c] + sb * b[3 + c];
+			r[3 + c] = -sb * b[c] + ca * b[3 + c];
+			r[6 + c] = b[6 + c];
+		}
+
+		qrGivens ( r[0] , r[6] , ch2 , sh2 );
+		ca = one - two * sh2 * sh2;
+		sb = two * ch2 * sh2;
+		for ( int c = 0; c < 3; ++c )
+		{
+			b[c] = ca * r[c] + sb * r[6 + c];
+			b[3 + c] = r[3 + c];
+			b[6 + c] = -sb * r[c] + ca * r[6 + c];
+		}
+
+		qrGivens ( b[4] , b[7] , ch3 , sh3 );
+		ca = one - two * sh3 * sh3;
+		sb = two * ch3 * sh3;
+		for ( int c = 0; c < 3; ++c )
+		{
+			r[c] = b[c];
+			r[3 + c] = ca * b[3 + c] + sb * b[6 + c];
+			r[6 + c] = -sb * b[3 + c] + ca * b[6 + c];
+		}
+
+		sigma[0] = r[0];
+		sigma[1] = r[4];
+		sigma[2] = r[8];
+
+		/// U = Q1 Q2 Q3
+		T sh12 = sh1 * sh1;
+		T sh22 = sh2 * sh2;
+		T sh32 = sh3 * sh3;
+		T four ( static_cast<Real> ( 4 ) );
+		T eight ( static_cast<Real> ( 8 ) );
+
+		u[0] = ( two * sh12 - one ) * ( two * sh22 - one );
+		u[1] = four * ch2 * ch3 * ( two * sh12 - one ) * sh2 * sh3 + two * ch1 * sh1 * ( two * sh32 - one );
+		u[2] = four * ch1 * ch3 * sh1 * sh3 - two * ch2 * ( two * sh12 - one ) * sh2 * ( two * sh32 - one );
+		u[3] = two * ch1 * sh1 * ( one - two * sh22 );
+		u[4] = -eight * ch1 * ch2 * ch3 * sh1 * sh2 * sh3 + ( two * sh12 - one ) * ( two * sh32 - one );
+		u[5] = -two * ch3 * sh3 + four * sh1 * ( ch3 * sh1 * sh3 + ch1 * ch2 * sh2 * ( two * sh32 - one ) );
+		u[6] = two * ch2 * sh2;
+		u[7] = two * ch3 * ( one - two * sh22 ) * sh3;
+		u[8] = ( one - two * sh22 ) * ( one - two * sh32 );
+	}
+
+	template < class Real >
+	void SingularValueDecomposition<Real>::decompose ( const Matrix3x3& a )
+	{
+		Real m[9];
+		Real u[9];
+		Real s[3];
+		Real v[9];
+
+		for ( int i = 0; i < 9; ++i )
+		{
+			m[i] = a[i / 3][i % 3];
+		}
+
+		kernel<Real> ( m , u , s , v );
+
+		u_ = Matrix3x3 ( u[0] , u[1] , u[2] , u[3] , u[4] , u[5] , u[6] , u[7] , u[8] );
+		sigma_ = Vector3 ( s[0] , s[1] , s[2] );
+		v_ = Matrix3x3 ( v[0] , v[1] , v[2] , v[3] , v[4] , v[5] , v[6] , v[7] , v[8] );
+	}
+
+	template < class Real >
+	typename SingularValueDecomposition<Real>::Matrix3x3 SingularValueDecomposition<Real>::rotation ( ) const
+	{
+		return u_ * ( ~v_ );
+	}
+
+	template < class Real >
+	typename SingularValueDecomposition<Real>::Matrix3x3 SingularValueDecomposition<Real>::stretch ( ) const
+	{
+		Matrix3x3 s;
+		for ( int r = 0; r < 3; ++r )
+		{
+			for ( int c = 0; c < 3; ++c )
+			{
+				s[r][c] = v_[r][0] * sigma_[0] * v_[c][0] + v_[r][1] * sigma_[1] * v_[c][1] + v_[r][2] * sigma_[2] * v_[c][2];
+			}
+		}
+		return s;
+	}
+
+	template < class Real >
+	void SingularValueDecomposition<Real>::store ( std::size_t i , const Real u[9] , const Real sigma[3] , const Real v[9] ,
+	                                               Matrix3x3* us , Vector3* sigmas , Matrix3x3* vs , Matrix3x3* rotations , Matrix3x3* stretches )
+	{
+		if ( us )
+		{
+			us[i] = Matrix3x3 ( u[0] , u[1] , u[2] , u[3] , u[4] , u[5] , u[6] , u[7] , u[8] );
+		}
+		if ( sigmas )
+		{
+			sigmas[i] = Vector3 ( sigma[0] , sigma[1] , sigma[2] );
+		}
+		if ( vs )
+		{
+			vs[i] = Matrix3x3 ( v[0] , v[1] , v[2] , v[3] , v[4] , v[5] , v[6] , v[7] , v[8] );
+		}
+		for ( int r = 0; r < 3; ++r )
+		{
+			for ( int c = 0; c < 3; ++c )
+			{
+				if ( rotations )
+				{
+					rotations[i][r][c] = u[3 * r] * v[3 * c] + u[3 * r + 1] * v[3 * c + 1] + u[3 * r + 2] * v[3 * c + 2];
+				}
+				if ( stretches )
+				{
+					stretches[i][r][c] = v[3 * r] * sigma[0] * v[3 * c] + v[3 * r + 1] * sigma[1] * v[3 * c + 1] + v[3 * r + 2] * sigma[2] * v[3 * c + 2];
+				}
+			}
+		}
+	}
+
+	template < class Real >
+	void SingularValueDecomposition<Real>::batch ( const Matrix3x3* a , std::size_t first , std::size_t last ,
+	                                               Matrix3x3* u , Vector3* sigma , Matrix3x3* v , Matrix3x3* rotation , Matrix3x3* stretch )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			Real m[9];
+			Real mu[9];
+			Real ms[3];
+			Real mv[9];
+
+			for ( int k = 0; k < 9; ++k )
+			{
+				m[k] = a[i][k / 3][k % 3];
+			}
+
+			kernel<Real> ( m , mu , ms , mv );
+			store ( i , mu , ms , mv , u , sigma , v , rotation , stretch );
+		}
+	}
+
+	template < class Real >
+	void SingularValueDecomposition<Real>::run ( const Matrix3x3* a , std::size_t count ,
+	                                             Matrix3x3* u , Vector3* sigma , Matrix3x3* v , Matrix3x3* rotation , Matrix3x3* stretch )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			batch ( a , first , last , u , sigma , v , rotation , stretch );
+		}
+	}
+
+	template < class Real >
+	void SingularValueDecomposition<Real>::decompose ( const Matrix3x3* a , std::size_t count , Matrix3x3* u , Vector3* sigma , Matrix3x3* v )
+	{
+		run ( a , count , u , sigma , v , 0 , 0 );
+	}
+
+	template < class Real >
+	void SingularValueDecomposition<Real>::polar ( const Matrix3x3* a , std::size_t count , Matrix3x3* rotation , Matrix3x3* stretch )
+	{
+		run ( a , count , 0 , 0 , 0 , rotation , stretch );
+	}
+
+	/// Four matrices per kernel call , transposed into the lanes of Float4.
+	template < >
+	inline void SingularValueDecomposition<float>::batch ( const Matrix3x3* a , std::size_t first , std::size_t last ,
+	                                                       Matrix3x3* u , Vector3* sigma , Matrix3x3* v , Matrix3x3* rotation , Matrix3x3* stretch )
+	{
+		std::size_t i = first;
+
+		for ( ; i + 4 <= last; i += 4 )
+		{
+			SIMD::Float4 m[9];
+			SIMD::Float4 mu[9];
+			SIMD::Float4 ms[3];
+			SIMD::Float4 mv[9];
+
+			for ( int k = 0; k < 9; ++k )
+			{
+				m[k] = SIMD::Float4 ( a[i][k / 3][k % 3] , a[i + 1][k / 3][k % 3] , a[i + 2][k / 3][k % 3] , a[i + 3][k / 3][k % 3] );
+			}
+
+			kernel<SIMD::Float4> ( m , mu , ms , mv );
+
+			float lu[9][4];
+			float ls[3][4];
+			float lv[9][4];
+			for ( int k = 0; k < 9; ++k )
+			{
+				mu[k].store ( lu[k] );
+				mv[k].store ( lv[k] );
+			}
+			for ( int k = 0; k < 3; ++k )
+			{
+				ms[k].store ( ls[k] );
+			}
+
+			for ( int lane = 0; lane < 4; ++lane )
+			{
+				float su[9];
+				float ss[3];
+				float sv[9];
+				for ( int k = 0; k < 9; ++k )
+				{
+					su[k] = lu[k][lane];
+					sv[k] = lv[k][lane];
+				}
+				for ( int k = 0; k < 3; ++k )
+				{
+					ss[k] = ls[k][lane];
+				}
+				store ( i + lane , su , ss , sv , u , sigma , v , rotation , stretch );
+			}
+		}
+
+		for ( ; i < last; ++i )
+		{
+			float m[9];
+			float mu[9];
+			float ms[3];
+			float mv[9];
+
+			for ( int k = 0; k < 9; ++k )
+			{
+				m[k] = a[i][k / 3][k % 3];
+			}
+
+			kernel<float> ( m , mu , ms , mv );
+			store ( i , mu , ms , mv , u , sigma , v , rotation , stretch );
+		}
+	}
+
+}
+
+#endif /* CELER_SINGULARVALUEDECOMPOSITION_HPP_ */
@@ -0,0 +1,624 @@
+#ifndef CELER_TRANSFORM_HPP_
+#define CELER_TRANSFORM_HPP_
+
+//- Celer/Core/Geometry/Math/Transform.hpp - Rotation , translation , scale -//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Math Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the Transform class , a
+//        rotation , a translation and a uniform scale , and its conversions
+//        to and from Matrix4x4.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix4x4.hpp>
+#include <Celer/Core/Geometry/Math/Quaternion.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class Transform.
+	 *@brief A rigid motion with a uniform scale , p' = translation + scale * ( rotation p ).
+	 *@details The rotation is a unit quaternion. With a uniform scale the
+	 * product and the inverse of two transforms are transforms again , so
+	 * both are closed form , with no matrix in between:
+	 * - a * b applies b first: rotation a.r b.r , scale a.s b.s and
+	 *   translation a.t + a.s ( a.r b.t ).
+	 * - the inverse is r^-1 , 1 / s and -( r^-1 t ) / s.
+	 * A negative scale is a point reflection , which is how a mirroring
+	 * matrix comes out of fromMatrix ( ).
+	 *
+	 * toMatrix ( ) gives the Matrix4x4 of the transform , rows as Matrix4x4
+	 * keeps them , translation in the w column. toMatrices ( ) writes many
+	 * at once as 16 column major values each , the layout glUniformMatrix4fv
+	 * takes with transpose false. For float it builds four matrices per
+	 * SIMD::Float4 , and large arrays are split across threads.
+	 *
+	 * decompose ( ) splits any affine Matrix4x4 in translation , rotation
+	 * and a scale per axis. It holds up with shear , through a polar
+	 * decomposition to the nearest rotation , with mirroring , all three
+	 * scales negative , and with axes of zero scale , whose rotation axes
+	 * are completed to a right handed basis.
+	 *
+	 * \code
+	 * Celer::Transform<float> world = parent * local;
+	 * Celer::Vector3<float> p = world.transformPoint ( vertex );
+	 * Celer::Transform<float>::toMatrices ( &worlds[0] , worlds.size ( ) , &uniforms[0] );
+	 * \endcode
+	 */
+	template < class Real >
+	class Transform
+	{
+		public:
+
+			Quaternion<Real> 	rotation;
+			Vector3<Real> 		translation;
+			Real 			scale;
+
+			/// The identity.
+			Transform ( );
+			Transform ( const Quaternion<Real>& rotation , const Vector3<Real>& translation , const Real& scale = Real ( 1 ) );
+
+			/// this * other: other first , then this.
+			Transform<Real> 	operator* 		( const Transform<Real>& other ) const;
+			Transform<Real>& 	operator*= 		( const Transform<Real>& other );
+			Transform<Real> 	inverse 		( ) const;
+
+			/// Rotated , scaled and translated.
+			Vector3<Real> 		transformPoint 		( const Vector3<Real>& point ) const;
+			/// Rotated and scaled , a difference of points.
+			Vector3<Real> 		transformVector 	( const Vector3<Real>& vector ) const;
+			/// Rotated only , the length is kept.
+			Vector3<Real> 		transformDirection 	( const Vector3<Real>& direction ) const;
+
+			Vector3<Real> 		inverseTransformPoint 	( const Vector3<Real>& point ) const;
+			Vector3<Real> 		inverseTransformDirection ( const Vector3<Real>& direction ) const;
+
+			Matrix4x4<Real> 	toMatrix 		( ) const;
+			/// The 16 values of toMatrix ( ) , column major.
+			void 			toMatrix 		( Real* columnMajor ) const;
+
+			/// count transforms to count column major matrices , 16 values each.
+			static void 		toMatrices 		( const Transform<Real>* transforms , std::size_t count , Real* columnMajor );
+
+			/*! The transform nearest matrix , the scale the mean of the decomposed
+			 * ones. False , and this unchanged , if the matrix is not affine or
+			 * not finite.
+			 */
+			bool 			fromMatrix 		( const Matrix4x4<Real>& matrix );
+
+			/*! matrix = T R S. False if the last row is not ( 0 , 0 , 0 , w ) with
+			 * w not zero , or a value is not finite. A w other than 1 is divided out.
+			 */
+			static bool 		decompose 		( const Matrix4x4<Real>& matrix ,
+			            		          		  Vector3<Real>& translation ,
+			            		          		  Quaternion<Real>& rotation ,
+			            		          		  Vector3<Real>& scale );
+
+		private:
+
+			typedef typename SIMD::Batch<Real>::Type Lanes;
+
+			enum
+			{
+				kBlock = 16384 , 	///< Transforms per thread task.
+				kLanes = SIMD::Traits<Lanes>::kLanes
+			};
+
+			/// q v q^-1 with two cross products , q of unit length.
+			static Vector3<Real> rotate ( const Quaternion<Real>& q , const Vector3<Real>& v );
+
+			/// The rotation and scale of one or four transforms. The Float4 lanes
+			/// are member templates , only float transforms ever instantiate them.
+			static void gather ( const Transform<Real>* t , Real lanes[5] );
+			template < class T >
+			static void gather ( const Transform<T>* t , SIMD::Float4 lanes[5] );
+
+			/// One rotation column of one or four matrices.
+			static void scatter ( const Real column[3] , int index , Real* out );
+			static void scatter ( SIMD::Float4 column[3] , int index , float* out );
+
+			/// The translation column of the matrices of t , the lanes those gather ( ) gave.
+			static void translations ( const Transform<Real>* t , const Real lanes[5] , Real* out );
+			template < class T >
+			static void translations ( const Transform<T>* t , const SIMD::Float4 lanes[5] , float* out );
+
+			template < class L >
+			static void toMatricesRange ( const Transform<Real>* transforms , std::size_t first , std::size_t last , Real* columnMajor );
+
+			/// Replaces the columns of a of zero length by a right handed completion.
+			static void complete ( Real a[3][3] , const Real length[3] );
+
+			/// Turns a into the rotation nearest to it , a of positive determinant.
+			static void orthonormalize ( Real a[3][3] );
+	};
+
+	template < class Real >
+	Transform<Real>::Transform ( )
+		: rotation ( ) , translation ( Real ( 0 ) , Real ( 0 ) , Real ( 0 ) ) , scale ( Real ( 1 ) )
+	{
+	}
+
+	template < class Real >
+	Transform<Real>::Transform ( const Quaternion<Real>& rotation , const Vector3<Real>& translation , const Real& scale )
+		: rotation ( rotation ) , translation ( translation ) , scale ( scale )
+	{
+	}
+
+	template < class Real >
+	inline Vector3<Real> Transform<Real>::rotate ( const Quaternion<Real>& q , const Vector3<Real>& v )
+	{
+		// t = 2 ( q.xyz x v ) , v' = v + w t + q.xyz x t.
+		Real tx = Real ( 2 ) * ( q.y * v.z - q.z * v.y );
+		Real ty = Real ( 2 ) * ( q.z * v.x - q.x * v.z );
+		Real tz = Real ( 2 ) * ( q.x * v.y - q.y * v.x );
+
+		return Vector3<Real> ( v.x + q.w * tx + ( q.y * tz - q.z * ty ) ,
+		                       v.y + q.w * ty + ( q.z * tx - q.x * tz ) ,
+		                       v.z + q.w * tz + ( q.x * ty - q.y * tx ) );
+	}
+
+	template < class Real >
+	inline Transform<Real> Transform<Real>::operator* ( const Transform<Real>& other ) const
+	{
+		Vector3<Real> moved = rotate ( rotation , other.translation );
+
+		return Transform<Real> ( rotation * other.rotation ,
+		                         Vector3<Real> ( translation.x + scale * moved.x ,
+		                                         translation.y + scale * moved.y ,
+		                                         translation.z + scale * moved.z ) ,
+		                         scale * other.scale );
+	}
+
+	template < class Real >
+	inline Transform<Real>& Transform<Real>::operator*= ( const Transform<Real>& other )
+	{
+		return *this = *this * other;
+	}
+
+	template < class Real >
+	inline Transform<Real> Transform<Real>::inverse ( ) const
+	{
+		Quaternion<Real> conjugate ( rotation.w , -rotation.x , -rotation.y , -rotation.z );
+		Real inverseScale = Real ( 1 ) / scale;
+		Vector3<Real> moved = rotate ( conjugate , translation );
+
+		return Transform<Real> ( conjugate ,
+		                         Vector3<Real> ( -moved.x * inverseScale , -moved.y * inverseScale , -moved.z * inverseScale ) ,
+		                         inverseScale );
+	}
+
+	template < class Real >
+	inline Vector3<Real> Transform<Real>::transformPoint ( const Vector3<Real>& point ) const
+	{
+		Vector3<Real> v = rotate ( rotation , point );
+		return Vector3<Real> ( translation.x + scale * v.x , translation.y + scale * v.y , translation.z + scale * v.z );
+	}
+
+	template < class Real >
+	inline Vector3<Real> Transform<Real>::transformVector ( const Vector3<Real>& vector ) const
+	{
+		Vector3<Real> v = rotate ( rotation , vector );
+		return Vector3<Real> ( scale * v.x , scale * v.y , scale * v.z );
+	}
+
+	template < class Real >
+	inline Vector3<Real> Transform<Real>::transformDirection ( const Vector3<Real>& direction ) const
+	{
+		return rotate ( rotation , direction );
+	}
+
+	template < class Real >
+	inline Vector3<Real> Transform<Real>::inverseTransformPoint ( const Vector3<Real>& point ) const
+	{
+		Quaternion<Real> conjugate ( rotation.w , -rotation.x , -rotation.y , -rotation.z );
+		Real inverseScale = Real ( 1 ) / scale;
+		Vector3<Real> v = rotate ( conjugate , Vector3<Real> ( point.x - translation.x , point.y - translation.y , point.z - translation.z ) );
+
+		return Vector3<Real> ( v.x * inverseScale , v.y * inverseScale , v.z * inverseScale );
+	}
+
+	template < class Real >
+	inline Vector3<Real> Transform<Real>::inverseTransformDirection ( const Vector3<Real>& direction ) const
+	{
+		return rotate ( Quaternion<Real> ( rotation.w , -rotation.x , -rotation.y , -rotation.z ) , direction );
+	}
+
+	template < class Real >
+	inline void Transform<Real>::gather ( const Transform<Real>* t , Real lanes[5] )
+	{
+		lanes[0] = t->rotation.w;
+		lanes[1] = t->rotation.x;
+		lanes[2] = t->rotation.y;
+		lanes[3] = t->rotation.z;
+		lanes[4] = t->scale;
+	}
+
+	template < class Real >
+	template < class T >
+	inline void Transform<Real>::gather ( const Transform<T>* t , SIMD::Float4 lanes[5] )
+	{
+		// w x y z are adjacent in a Quaternion: one load per transform and a transpose.
+		lanes[0] = SIMD::Float4::load ( &t[0].rotation.w );
+		lanes[1] = SIMD::Float4::load ( &t[1].rotation.w );
+		lanes[2] = SIMD::Float4::load ( &t[2].rotation.w );
+		lanes[3] = SIMD::Float4::load ( &t[3].rotation.w );
+		SIMD::transpose ( lanes[0] , lanes[1] , lanes[2] , lanes[3] );
+		lanes[4] = SIMD::Float4 ( t[0].scale , t[1].scale , t[2].scale , t[3].scale );
+	}
+
+	template < class Real >
+	inline void Transform<Real>::scatter ( const Real column[3] , int index , Real* out )
+	{
+		out[index * 4] = column[0];
+		out[index * 4 + 1] = column[1];
+		out[index * 4 + 2] = column[2];
+		out[index * 4 + 3] = Real ( 0 );
+	}
+
+	template < class Real >
+	inline void Transform<Real>::scatter ( SIMD::Float4 column[3] , int index , float* out )
+	{
+		// Lane k of the rows is column index of matrix k.
+		SIMD::Float4 w ( 0.0f );
+		SIMD::transpose ( column[0] , column[1] , column[2] , w );
+		column[0].store ( out + index * 4 );
+		column[1].store ( out + 16 + index * 4 );
+		column[2].store ( out + 32 + index * 4 );
+		w.store ( out + 48 + index * 4 );
+	}
+
+	template < class Real >
+	inline void Transform<Real>::translations ( const Transform<Real>* t , const Real* , Real* out )
+	{
+		out[12] = t->translation.x;
+		out[13] = t->translation.y;
+		out[14] = t->translation.z;
+		out[15] = Real ( 1 );
+	}
+
+	template < class Real >
+	template < class T >
+	inline void Transform<Real>::translations ( const Transform<T>* t , const SIMD::Float4* , float* out )
+	{
+		for ( int k = 0; k < 4; ++k )
+		{
+			SIMD::Float4 ( t[k].translation.x , t[k].translation.y , t[k].translation.z , 1.0f ).store ( out + k * 16 + 12 );
+		}
+	}
+
+	template < class Real >
+	template < class L >
+	void Transform<Real>::toMatricesRange ( const Transform<Real>* transforms , std::size_t first , std::size_t last , Real* columnMajor )
+	{
+		const int lanes = SIMD::Traits<L>::kLanes;
+		const L one ( Real ( 1 ) );
+		const L two ( Real ( 2 ) );
+
+		for ( std::size_t i = first; i < last; i += lanes )
+		{
+			L v[5];
+			gather ( transforms + i , v );
+
+			L x2 = v[1] * two;
+			L y2 = v[2] * two;
+			L z2 = v[3] * two;
+
+			L xx = v[1] * x2;
+			L yy = v[2] * y2;
+			L zz = v[3] * z2;
+			L xy = v[1] * y2;
+			L xz = v[1] * z2;
+			L yz = v[2] * z2;
+			L xw = v[0] * x2;
+			L yw = v[0] * y2;
+			L zw = v[0] * z2;
+
+			// Quaternion::to4x4Matrix ( ) , each column times the scale.
+			Real* out = columnMajor + i * 16;
+
+			L column[3];
+			column[0] = ( one - ( yy + zz ) ) * v[4];
+			column[1] = ( xy + zw ) * v[4];
+			column[2] = ( xz - yw ) * v[4];
+			scatter ( column , 0 , out );
+
+			column[0] = ( xy - zw ) * v[4];
+			column[1] = ( one - ( xx + zz ) ) * v[4];
+			column[2] = ( yz + xw ) * v[4];
+			scatter ( column , 1 , out );
+
+			column[0] = ( xz + yw ) * v[4];
+			column[1] = ( yz - xw ) * v[4];
+			column[2] = ( one - ( xx + yy ) ) * v[4];
+			scatter ( column , 2 , out );
+
+			translations ( transforms + i , v , out );
+		}
+	}
+
+	template < class Real >
+	void Transform<Real>::toMatrix ( Real* columnMajor ) const
+	{
+		toMatricesRange<Real> ( this , 0 , 1 , columnMajor );
+	}
+
+	template < class Real >
+	Matrix4x4<Real> Transform<Real>::toMatrix ( ) const
+	{
+		Real values[16];
+		toMatrix ( values );
+
+		Matrix4x4<Real> matrix;
+		for ( int i = 0; i < 4; ++i )
+		{
+			for ( int j = 0; j < 4; ++j )
+			{
+				matrix ( i , j ) = values[j * 4 + i];
+			}
+		}
+		return matrix;
+	}
+
+	template < class Real >
+	void Transform<Real>::toMatrices ( const Transform<Real>* transforms , std::size_t count , Real* columnMajor )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			std::size_t split = first + ( last - first ) / kLanes * kLanes;
+
+			toMatricesRange<Lanes> ( transforms , first , split , columnMajor );
+			toMatricesRange<Real> ( transforms , split , last , columnMajor );
+		}
+	}
+
+	template < class Real >
+	void Transform<Real>::complete ( Real a[3][3] , const Real length[3] )
+	{
+		Real largest = std::max ( length[0] , std::max ( length[1] , length[2] ) );
+		Real tiny = largest * std::numeric_limits<Real>::epsilon ( ) * Real ( 16 );
+
+		bool zero[3];
+		int zeros = 0;
+		for ( int j = 0; j < 3; ++j )
+		{
+			zero[j] = !( length[j] > tiny );
+			zeros += zero[j];
+		}
+
+		if ( zeros == 3 )
+		{
+			for ( int i = 0; i < 3; ++i )
+			{
+				for ( int j = 0; j < 3; ++j )
+				{
+					a[i][j] = ( i == j ) ? Real ( 1 ) : Real ( 0 );
+				}
+			}
+			return;
+		}
+
+		if ( zeros == 2 )
+		{
+			// Any axis perpendicular to the one left , off its smallest component.
+			int kept = zero[0] ? ( zero[1] ? 2 : 1 ) : 0;
+			int next = ( kept + 1 ) % 3;
+
+			Real u[3] = { a[0][kept] , a[1][kept] , a[2][kept] };
+			int smallest = 0;
+			for ( int i = 1; i < 3; ++i )
+			{
+				if ( std::abs ( u[i] ) < std::abs ( u[smallest] ) ) smallest = i;
+			}
+			Real e[3] = { Real ( 0 ) , Real ( 0 ) , Real ( 0 ) };
+			e[smallest] = Real ( 1 );
+
+			Real v[3] = { u[1] * e[2] - u[2] * e[1] , u[2] * e[0] - u[0] * e[2] , u[0] * e[1] - u[1] * e[0] };
+			Real size = std::sqrt ( v[0] * v[0] + v[1] * v[1] + v[2] * v[2] );
+			for ( int i = 0; i < 3; ++i )
+			{
+				a[i][next] = v[i] / size;
+			}
+			zero[next] = false;
+		}
+
+		// The one axis left is the cross product of the other two , in cyclic order.
+		for ( int j = 0; j < 3; ++j )
+		{
+			if ( zero[j] )
+			{
+				int p = ( j + 1 ) % 3;
+				int q = ( j + 2 ) % 3;
+				a[0][j] = a[1][p] * a[2][q] - a[2][p] * a[1][q];
+				a[1][j] = a[2][p] * a[0][q] - a[0][p] * a[2][q];
+				a[2][j] = a[0][p] * a[1][q] - a[1][p] * a[0][q];
+
+				Real size = std::sqrt ( a[0][j] * a[0][j] + a[1][j] * a[1][j] + a[2][j] * a[2][j] );
+				for ( int i = 0; i < 3; ++i )
+				{
+					a[i][j] /= size;
+				}
+			}
+		}
+	}
+
+	template < class Real >
+	void Transform<Real>::orthonormalize ( Real a[3][3] )
+	{
+		// Higham's iteration a = ( a + a^-T ) / 2 converges to the orthogonal
+		// polar factor. The columns are of unit length already , so a is well
+		// conditioned unless it is sheared almost flat.
+		for ( int iteration = 0; iteration < 32; ++iteration )
+		{
+			Real c[3][3];
+			c[0][0] = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+			c[0][1] = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+			c[0][2] = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+			c[1][0] = a[0][2] * a[2][1] - a[0][1] * a[2][2];
+			c[1][1] = a[0][0] * a[2][2] - a[0][2] * a[2][0];
+			c[1][2] = a[0][1] * a[2][0] - a[0][0] * a[2][1];
+			c[2][0] = a[0][1] * a[1][2] - a[0][2] * a[1][1];
+			c[2][1] = a[0][2] * a[1][0] - a[0][0] * a[1][2];
+			c[2][2] = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+
+			// The cofactors over the determinant are a^-T.
+			Real determinant = a[0][0] * c[0][0] + a[0][1] * c[0][1] + a[0][2] * c[0][2];
+			Real inverse = Real ( 1 ) / determinant;
+
+			Real change = Real ( 0 );
+			for ( int i = 0; i < 3; ++i )
+			{
+				for ( int j = 0; j < 3; ++j )
+				{
+					Real next = Real ( 0.5 ) * ( a[i][j] + c[i][j] * inverse );
+					change = std::max ( change , std::abs ( next - a[i][j] ) );
+					a[i][j] = next;
+				}
+			}
+
+			if ( change <= std::numeric_limits<Real>::epsilon ( ) * Real ( 4 ) )
+			{
+				break;
+			}
+		}
+	}
+
+	template < class Real >
+	bool Transform<Real>::decompose ( const Matrix4x4<Real>& matrix , Vector3<Real>& translation , Quaternion<Real>& rotation , Vector3<Real>& scale )
+	{
+		for ( int i = 0; i < 4; ++i )
+		{
+			for ( int j = 0; j < 4; ++j )
+			{
+				if ( !( std::abs ( matrix ( i , j ) ) <= std::numeric_limits<Real>::max ( ) ) ) return false;
+			}
+		}
+
+		if ( matrix ( 3 , 0 ) != Real ( 0 ) || matrix ( 3 , 1 ) != Real ( 0 ) || matrix ( 3 , 2 ) != Real ( 0 ) || matrix ( 3 , 3 ) == Real ( 0 ) )
+		{
+			return false;
+		}
+
+		Real homogeneous = Real ( 1 ) / matrix ( 3 , 3 );
+
+		translation = Vector3<Real> ( matrix ( 0 , 3 ) * homogeneous , matrix ( 1 , 3 ) * homogeneous , matrix ( 2 , 3 ) * homogeneous );
+
+		Real a[3][3];
+		Real length[3];
+		for ( int j = 0; j < 3; ++j )
+		{
+			for ( int i = 0; i < 3; ++i )
+			{
+				a[i][j] = matrix ( i , j ) * homogeneous;
+			}
+			length[j] = std::sqrt ( a[0][j] * a[0][j] + a[1][j] * a[1][j] + a[2][j] * a[2][j] );
+			if ( length[j] > Real ( 0 ) )
+			{
+				for ( int i = 0; i < 3; ++i )
+				{
+					a[i][j] /= length[j];
+				}
+			}
+		}
+
+		complete ( a , length );
+
+		// A mirror: all three scales negative , what is left is a rotation.
+		Real determinant = a[0][0] * ( a[1][1] * a[2][2] - a[1][2] * a[2][1] )
+		                 - a[0][1] * ( a[1][0] * a[2][2] - a[1][2] * a[2][0] )
+		                 + a[0][2] * ( a[1][0] * a[2][1] - a[1][1] * a[2][0] );
+		Real sign = ( determinant < Real ( 0 ) ) ? Real ( -1 ) : Real ( 1 );
+		for ( int i = 0; i < 3; ++i )
+		{
+			for ( int j = 0; j < 3; ++j )
+			{
+				a[i][j] *= sign;
+			}
+		}
+
+		orthonormalize ( a );
+
+		// The scale along each rotated axis , the diagonal of R^T M.
+		Real s[3];
+		for ( int j = 0; j < 3; ++j )
+		{
+			s[j] = Real ( 0 );
+			for ( int i = 0; i < 3; ++i )
+			{
+				s[j] += a[i][j] * matrix ( i , j ) * homogeneous;
+			}
+		}
+		scale = Vector3<Real> ( s[0] , s[1] , s[2] );
+
+		// Shepperd's method , from the largest of w , x , y and z.
+		Real trace = a[0][0] + a[1][1] + a[2][2];
+		if ( trace > a[0][0] && trace > a[1][1] && trace > a[2][2] )
+		{
+			Real r = std::sqrt ( Real ( 1 ) + trace ) * Real ( 2 );
+			rotation = Quaternion<Real> ( Real ( 0.25 ) * r , ( a[2][1] - a[1][2] ) / r , ( a[0][2] - a[2][0] ) / r , ( a[1][0] - a[0][1] ) / r );
+		}
+		else if ( a[0][0] >= a[1][1] && a[0][0] >= a[2][2] )
+		{
+			Real r = std::sqrt ( Real ( 1 ) + a[0][0] - a[1][1] - a[2][2] ) * Real ( 2 );
+			rotation = Quaternion<Real> ( ( a[2][1] - a[1][2] ) / r , Real ( 0.25 ) * r , ( a[0][1] + a[1][0] ) / r , ( a[0][2] + a[2][0] ) / r );
+		}
+		else if ( a[1][1] >= a[2][2] )
+		{
+			Real r = std::sqrt ( Real ( 1 ) + a[1][1] - a[0][0] - a[2][2] ) * Real ( 2 );
+			rotation = Quaternion<Real> ( ( a[0][2] - a[2][0] ) / r , ( a[0][1] + a[1][0] ) / r , Real ( 0.25 ) * r , ( a[1][2] + a[2][1] ) / r );
+		}
+		else
+		{
+			Real r = std::sqrt ( Real ( 1 ) + a[2][2] - a[0][0] - a[1][1] ) * Real ( 2 );
+			rotation = Quaternion<Real> ( ( a[1][0] - a[0][1] ) / r , ( a[0][2] + a[2][0] ) / r , ( a[1][2] + a[2][1] ) / r , Real ( 0.25 ) * r );
+		}
+
+		Real size = std::sqrt ( rotation.w * rotation.w + rotation.x * rotation.x + rotation.y * rotation.y + rotation.z * rotation.z );
+		rotation = Quaternion<Real> ( rotation.w / size , rotation.x / size , rotation.y / size , rotation.z / size );
+
+		return true;
+	}
+
+	template < class Real >
+	bool Transform<Real>::fromMatrix ( const Matrix4x4<Real>& matrix )
+	{
+		Vector3<Real> t;
+		Quaternion<Real> r;
+		Vector3<Real> s;
+
+		if ( !decompose ( matrix , t , r , s ) )
+		{
+			return false;
+		}
+
+		rotation = r;
+		translation = t;
+		scale = ( s.x + s.y + s.z ) / Real ( 3 );
+
+		return true;
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_TRANSFORM_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * Triangle3.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Math/Triangle3.hpp>
@@ -0,0 +1,713 @@
+#ifndef CELER_TRIANGLE3_HPP_
+#define CELER_TRIANGLE3_HPP_
+
+//- Celer/Core/Geometry/Math/Triangle3.hpp - Triangle queries --------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Math Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the Triangle3 class, with
+//        ray , box and closest point queries in single and batch form.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class Triangle3.
+	 *@brief Triangle in 3D and the queries built on it.
+	 *@details
+	 * - Ray: Moller-Trumbore , or the watertight test of Woop , Benthin and
+	 *   Wald , which never lets a ray through the shared edge of two
+	 *   triangles. Hits report t and the barycentrics u , v of vertices 1 and
+	 *   2 , so the point is ( 1 - u - v ) p0 + u p1 + v p2.
+	 * - Box: separating axis test against a BoundingBox3 , the three box
+	 *   axes , the triangle normal and the nine edge cross products.
+	 *   Touching counts as overlap.
+	 * - Point: closest point on the triangle , by Voronoi regions.
+	 *
+	 * The batch forms run one query over a triangle array. For float the ray
+	 * and box kernels test four triangles per SIMD::Float4 , and arrays
+	 * longer than one block are split over the OpenMP threads.
+	 *
+	 * \code
+	 * Celer::Triangle3<float>::Hit hit;
+	 * std::size_t picked = Celer::Triangle3<float>::intersect ( &triangles[0] , triangles.size ( ) , eye , direction , hit );
+	 * if ( picked != triangles.size ( ) ) ...
+	 * \endcode
+	 */
+	template < class Real >
+	class Triangle3
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 		Vector3;
+			typedef Celer::BoundingBox3<Real> 	BoundingBox3;
+
+			enum Test
+			{
+				MOLLER_TRUMBORE ,
+				WATERTIGHT
+			};
+
+			struct Hit
+			{
+				Real t;	///< Ray parameter , the point is origin + t direction.
+				Real u;	///< Weight of vertex 1.
+				Real v;	///< Weight of vertex 2.
+			};
+
+			Triangle3 ( )
+			{
+			}
+
+			Triangle3 ( const Vector3& p0 , const Vector3& p1 , const Vector3& p2 )
+			{
+				vertex_[0] = p0;
+				vertex_[1] = p1;
+				vertex_[2] = p2;
+			}
+
+			const Vector3& operator[] ( int i ) const
+			{
+				return vertex_[i];
+			}
+
+			Vector3& operator[] ( int i )
+			{
+				return vertex_[i];
+			}
+
+			/// ( p1 - p0 ) x ( p2 - p0 ) , twice the area long.
+			Vector3 cross ( ) const
+			{
+				return ( vertex_[1] - vertex_[0] ) ^ ( vertex_[2] - vertex_[0] );
+			}
+
+			Vector3 normal ( ) const
+			{
+				Vector3 n = cross ( );
+				Real length = std::sqrt ( n * n );
+				return ( length > static_cast<Real> ( 0 ) ) ? n / length : n;
+			}
+
+			Real area ( ) const
+			{
+				Vector3 n = cross ( );
+				return static_cast<Real> ( 0.5 ) * std::sqrt ( n * n );
+			}
+
+			Vector3 centroid ( ) const
+			{
+				return ( vertex_[0] + vertex_[1] + vertex_[2] ) / static_cast<Real> ( 3 );
+			}
+
+			BoundingBox3 bounds ( ) const
+			{
+				return BoundingBox3 ( ) + vertex_[0] + vertex_[1] + vertex_[2];
+			}
+
+			/// Hit with t in ( 0 , tMax ) , both faces.
+			bool intersect ( const Vector3& origin , const Vector3& direction , Hit& hit ,
+			                 Test test = MOLLER_TRUMBORE , Real tMax = std::numeric_limits<Real>::max ( ) ) const;
+
+			bool intersect ( const BoundingBox3& box ) const;
+
+			/// Closest point to p , with the weights u , v of vertices 1 and 2.
+			Vector3 closestPoint ( const Vector3& p , Real& u , Real& v ) const;
+
+			Vector3 closestPoint ( const Vector3& p ) const
+			{
+				Real u , v;
+				return closestPoint ( p , u , v );
+			}
+
+			/*!@brief Nearest hit of a ray over a triangle array.
+			 * @return Index of the triangle hit , count on a miss.
+			 */
+			static std::size_t intersect ( const Triangle3* triangles , std::size_t count , const Vector3& origin , const Vector3& direction , Hit& hit ,
+			                               Test test = MOLLER_TRUMBORE , Real tMax = std::numeric_limits<Real>::max ( ) );
+
+			/*!@brief Triangles overlapping box , point i in bit i % 32 of mask[i / 32].
+			 * @return Number of overlapping triangles.
+			 */
+			static std::size_t intersect ( const Triangle3* triangles , std::size_t count , const BoundingBox3& box , unsigned int* mask );
+
+			/*!@brief Nearest triangle to p.
+			 * @return Index of the triangle , count for an empty array.
+			 */
+			static std::size_t closest ( const Triangle3* triangles , std::size_t count , const Vector3& p , Vector3& point );
+
+		private:
+
+			enum
+			{
+				kBlock = 4096 	///< Triangles per thread task , a multiple of 32.
+			};
+
+			/// Ray sheared so that it runs along +z , for the watertight test.
+			struct Shear
+			{
+				int 	k[3];	///< Axes x , y and z of the sheared space.
+				Real 	s[3];
+			};
+
+			static Shear shear ( const Vector3& direction );
+
+			template < class T >
+			static void cross ( const T a[3] , const T b[3] , T r[3] )
+			{
+				r[0] = a[1] * b[2] - a[2] * b[1];
+				r[1] = a[2] * b[0] - a[0] * b[2];
+				r[2] = a[0] * b[1] - a[1] * b[0];
+			}
+
+			template < class T >
+			static T dot ( const T a[3] , const T b[3] )
+			{
+				return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+			}
+
+			template < class T >
+			static typename SIMD::Traits<T>::Mask mollerTrumbore ( const T o[3] , const T d[3] , const T p0[3] , const T p1[3] , const T p2[3] ,
+			                                                       const T& tMax , T& t , T& u , T& v );
+
+			template < class T >
+			static typename SIMD::Traits<T>::Mask watertight ( const Shear& ray , const T o[3] , const T p0[3] , const T p1[3] , const T p2[3] ,
+			                                                   const T& tMax , T& t , T& u , T& v );
+
+			/// True where one of the 13 axes separates the triangles , already relative to the box center , from the box.
+			template < class T >
+			static typename SIMD::Traits<T>::Mask separated ( const T p0[3] , const T p1[3] , const T p2[3] , const T half[3] );
+
+			template < class T >
+			static typename SIMD::Traits<T>::Mask separatedOn ( const T& ax , const T& ay , const T& az ,
+			                                                    const T p0[3] , const T p1[3] , const T p2[3] , const T half[3] );
+
+			static void nearestRange ( const Triangle3* triangles , std::size_t first , std::size_t last , const Vector3& origin , const Vector3& direction ,
+			                           Test test , Real tMax , Hit& hit , std::size_t& index );
+
+			static std::size_t overlapRange ( const Triangle3* triangles , std::size_t first , std::size_t last , const BoundingBox3& box , unsigned int* mask );
+
+			Vector3 vertex_[3];
+	};
+
+	template < class Real >
+	template < class T >
+	typename SIMD::Traits<T>::Mask Triangle3<Real>::mollerTrumbore ( const T o[3] , const T d[3] , const T p0[3] , const T p1[3] , const T p2[3] ,
+	                                                                 const T& tMax , T& t , T& u , T& v )
+	{
+		const T zero ( static_cast<Real> ( 0 ) );
+		const T one ( static_cast<Real> ( 1 ) );
+		const T tiny ( std::numeric_limits<Real>::min ( ) );
+
+		T e1[3] = { p1[0] - p0[0] , p1[1] - p0[1] , p1[2] - p0[2] };
+		T e2[3] = { p2[0] - p0[0] , p2[1] - p0[1] , p2[2] - p0[2] };
+		T s[3] = { o[0] - p0[0] , o[1] - p0[1] , o[2] - p0[2] };
+		T p[3];
+		T q[3];
+
+		cross ( d , e2 , p );
+		cross ( s , e1 , q );
+
+		T det = dot ( e1 , p );
+		typename SIMD::Traits<T>::Mask valid = SIMD::abs ( det ) > tiny;
+		T inverse = one / SIMD::select ( valid , det , one );
+
+		u = dot ( s , p ) * inverse;
+		v = dot ( d , q ) * inverse;
+		t = dot ( e2 , q ) * inverse;
+
+		return valid & ( u >= zero ) & ( v >= zero ) & ( u + v <= one ) & ( t > zero ) & ( t < tMax );
+	}
+
+	template < class Real >
+	template < class T >
+	typename SIMD::Traits<T>::Mask Triangle3<Real>::watertight ( const Shear& ray , const T o[3] , const T p0[3] , const T p1[3] , const T p2[3] ,
+	                                                             const T& tMax , T& t , T& u , T& v )
+	{
+		const T zero ( static_cast<Real> ( 0 ) );
+		const T one ( static_cast<Real> ( 1 ) );
+
+		const int x = ray.k[0];
+		const int y = ray.k[1];
+		const int z = ray.k[2];
+		const T sx ( ray.s[0] );
+		const T sy ( ray.s[1] );
+		const T sz ( ray.s[2] );
+
+		T a[3] = { p0[0] - o[0] , p0[1] - o[1] , p0[2] - o[2] };
+		T b[3] = { p1[0] - o[0] , p1[1] - o[1] , p1[2] - o[2] };
+		T c[3] = { p2[0] - o[0] , p2[1] - o[1] , p2[2] - o[2] };
+
+		T ax = a[x] - sx * a[z];
+		T ay = a[y] - sy * a[z];
+		T bx = b[x] - sx * b[z];
+		T by = b[y] - sy * b[z];
+		T cx = c[x] - sx * c[z];
+		T cy = c[y] - sy * c[z];
+
+		/// Scaled barycentrics , the edge functions of the opposite edges.
+		T e0 = cx * by - cy * bx;
+		T e1 = ax * cy - ay * cx;
+		T e2 = bx * ay - by * ax;
+
+		typename SIMD::Traits<T>::Mask inside = ( ( e0 >= zero ) & ( e1 >= zero ) & ( e2 >= zero ) ) |
+		                                        ( ( e0 <= zero ) & ( e1 <= zero ) & ( e2 <= zero ) );
+
+		T det = e0 + e1 + e2;
+		typename SIMD::Traits<T>::Mask valid = ( det > zero ) | ( det < zero );
+		T inverse = one / SIMD::select ( valid , det , one );
+
+		T depth = e0 * ( sz * a[z] ) + e1 * ( sz * b[z] ) + e2 * ( sz * c[z] );
+
+		t = depth * inverse;
+		u = e1 * inverse;
+		v = e2 * inverse;
+
+		return inside & valid & ( t > zero ) & ( t < tMax );
+	}
+
+	template < class Real >
+	template < class T >
+	typename SIMD::Traits<T>::Mask Triangle3<Real>::separatedOn ( const T& ax , const T& ay , const T& az ,
+	                                                              const T p0[3] , const T p1[3] , const T p2[3] , const T half[3] )
+	{
+		T d0 = ax * p0[0] + ay * p0[1] + az * p0[2];
+		T d1 = ax * p1[0] + ay * p1[1] + az * p1[2];
+		T d2 = ax * p2[0] + ay * p2[1] + az * p2[2];
+		T r = half[0] * SIMD::abs ( ax ) + half[1] * SIMD::abs ( ay ) + half[2] * SIMD::abs ( az );
+
+		return ( SIMD::min ( d0 , SIMD::min ( d1 , d2 ) ) > r ) | ( SIMD::max ( d0 , SIMD::max ( d1 , d2 ) ) < -r );
+	}
+
+	template < class Real >
+	template < class T >
+	typename SIMD::Traits<T>::Mask Triangle3<Real>::separated ( const T p0[3] , const T p1[3] , const T p2[3] , const T half[3] )
+	{
+		const T zero ( static_cast<Real> ( 0 ) );
+
+		T f[3][3];
+		for ( int k = 0; k < 3; ++k )
+		{
+			f[0][k] = p1[k] - p0[k];
+			f[1][k] = p2[k] - p1[k];
+			f[2][k] = p0[k] - p2[k];
+		}
+
+		/// Box faces.
+		typename SIMD::Traits<T>::Mask out = separatedOn ( T ( 1 ) , zero , zero , p0 , p1 , p2 , half ) |
+		                                     separatedOn ( zero , T ( 1 ) , zero , p0 , p1 , p2 , half ) |
+		                                     separatedOn ( zero , zero , T ( 1 ) , p0 , p1 , p2 , half );
+
+		/// Triangle plane.
+		T n[3];
+		cross ( f[0] , f[1] , n );
+		out = out | separatedOn ( n[0] , n[1] , n[2] , p0 , p1 , p2 , half );
+
+		/// Box axes crossed with the edges.
+		for ( int e = 0; e < 3; ++e )
+		{
+			out = out | separatedOn ( zero , -f[e][2] , f[e][1] , p0 , p1 , p2 , half ) |
+			            separatedOn ( f[e][2] , zero , -f[e][0] , p0 , p1 , p2 , half ) |
+			            separatedOn ( -f[e][1] , f[e][0] , zero , p0 , p1 , p2 , half );
+		}
+
+		return out;
+	}
+
+	template < class Real >
+	typename Triangle3<Real>::Shear Triangle3<Real>::shear ( const Vector3& direction )
+	{
+		Shear ray;
+
+		int z = 0;
+		for ( int k = 1; k < 3; ++k )
+		{
+			if ( std::fabs ( direction[k] ) > std::fabs ( direction[z] ) )
+			{
+				z = k;
+			}
+		}
+
+		int x = ( z + 1 ) % 3;
+		int y = ( x + 1 ) % 3;
+
+		/// Keep the winding of the sheared triangle.
+		if ( direction[z] < static_cast<Real> ( 0 ) )
+		{
+			std::swap ( x , y );
+		}
+
+		ray.k[0] = x;
+		ray.k[1] = y;
+		ray.k[2] = z;
+		ray.s[0] = direction[x] / direction[z];
+		ray.s[1] = direction[y] / direction[z];
+		ray.s[2] = static_cast<Real> ( 1 ) / direction[z];
+
+		return ray;
+	}
+
+	template < class Real >
+	bool Triangle3<Real>::intersect ( const Vector3& origin , const Vector3& direction , Hit& hit , Test test , Real tMax ) const
+	{
+		Real o[3] = { origin.x , origin.y , origin.z };
+		Real d[3] = { direction.x , direction.y , direction.z };
+		Real p0[3] = { vertex_[0].x , vertex_[0].y , vertex_[0].z };
+		Real p1[3] = { vertex_[1].x , vertex_[1].y , vertex_[1].z };
+		Real p2[3] = { vertex_[2].x , vertex_[2].y , vertex_[2].z };
+
+		if ( test == WATERTIGHT )
+		{
+			return watertight<Real> ( shear ( direction ) , o , p0 , p1 , p2 , tMax , hit.t , hit.u , hit.v );
+		}
+
+		return mollerTrumbore<Real> ( o , d , p0 , p1 , p2 , tMax , hit.t , hit.u , hit.v );
+	}
+
+	template < class Real >
+	bool Triangle3<Real>::intersect ( const BoundingBox3& box ) const
+	{
+		Vector3 center = box.center ( );
+		Vector3 extent = box.extent ( ) * static_cast<Real> ( 0.5 );
+
+		Real half[3] = { extent.x , extent.y , extent.z };
+		Real p0[3] = { vertex_[0].x - center.x , vertex_[0].y - center.y , vertex_[0].z - center.z };
+		Real p1[3] = { vertex_[1].x - center.x , vertex_[1].y - center.y , vertex_[1].z - center.z };
+		Real p2[3] = { vertex_[2].x - center.x , vertex_[2].y - center.y , vertex_[2].z - center.z };
+
+		return !separated<Real> ( p0 , p1 , p2 , half );
+	}
+
+	template < class Real >
+	typename Triangle3<Real>::Vector3 Triangle3<Real>::closestPoint ( const Vector3& p , Real& u , Real& v ) const
+	{
+		const Real zero = static_cast<Real> ( 0 );
+		const Vector3& a = vertex_[0];
+		const Vector3& b = vertex_[1];
+		const Vector3& c = vertex_[2];
+
+		Vector3 ab = b - a;
+		Vector3 ac = c - a;
+		Vector3 ap = p - a;
+
+		Real d1 = ab * ap;
+		Real d2 = ac * ap;
+		if ( d1 <= zero && d2 <= zero )
+		{
+			u = v = zero;
+			return a;
+		}
+
+		Vector3 bp = p - b;
+		Real d3 = ab * bp;
+		Real d4 = ac * bp;
+		if ( d3 >= zero && d4 <= d3 )
+		{
+			u = static_cast<Real> ( 1 );
+			v = zero;
+			return b;
+		}
+
+		Real vc = d1 * d4 - d3 * d2;
+		if ( vc <= zero && d1 >= zero && d3 <= zero )
+		{
+			u = d1 / ( d1 - d3 );
+			v = zero;
+			return a + ab * u;
+		}
+
+		Vector3 cp = p - c;
+		Real d5 = ab * cp;
+		Real d6 = ac * cp;
+		if ( d6 >= zero && d5 <= d6 )
+		{
+			u = zero;
+			v = static_cast<Real> ( 1 );
+			return c;
+		}
+
+		Real vb = d5 * d2 - d1 * d6;
+		if ( vb <= zero && d2 >= zero && d6 <= zero )
+		{
+			u = zero;
+			v = d2 / ( d2 - d6 );
+			return a + ac * v;
+		}
+
+		Real va = d3 * d6 - d5 * d4;
+		if ( va <= zero && ( d4 - d3 ) >= zero && ( d5 - d6 ) >= zero )
+		{
+			Real w = ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) );
+			u = static_cast<Real> ( 1 ) - w;
+			v = w;
+			return b + ( c - b ) * w;
+		}
+
+		Real denominator = static_cast<Real> ( 1 ) / ( va + vb + vc );
+		u = vb * denominator;
+		v = vc * denominator;
+		return a + ab * u + ac * v;
+	}
+
+	template < class Real >
+	void Triangle3<Real>::nearestRange ( const Triangle3* triangles , std::size_t first , std::size_t last , const Vector3& origin , const Vector3& direction ,
+	                                     Test test , Real tMax , Hit& hit , std::size_t& index )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			Hit candidate;
+			if ( triangles[i].intersect ( origin , direction , candidate , test , tMax ) )
+			{
+				hit = candidate;
+				index = i;
+				tMax = candidate.t;
+			}
+		}
+	}
+
+	template < >
+	inline void Triangle3<float>::nearestRange ( const Triangle3* triangles , std::size_t first , std::size_t last , const Vector3& origin , const Vector3& direction ,
+	                                             Test test , float tMax , Hit& hit , std::size_t& index )
+	{
+		const SIMD::Float4 o[3] = { SIMD::Float4 ( origin.x ) , SIMD::Float4 ( origin.y ) , SIMD::Float4 ( origin.z ) };
+		const SIMD::Float4 d[3] = { SIMD::Float4 ( direction.x ) , SIMD::Float4 ( direction.y ) , SIMD::Float4 ( direction.z ) };
+		const Shear ray = shear ( direction );
+
+		std::size_t i = first;
+
+		for ( ; i + 4 <= last; i += 4 )
+		{
+			const Triangle3* q = triangles + i;
+			SIMD::Float4 p[3][3];
+
+			for ( int v = 0; v < 3; ++v )
+			{
+				for ( int k = 0; k < 3; ++k )
+				{
+					p[v][k] = SIMD::Float4 ( q[0].vertex_[v][k] , q[1].vertex_[v][k] , q[2].vertex_[v][k] , q[3].vertex_[v][k] );
+				}
+			}
+
+			SIMD::Float4 t , u , v;
+			int bits = ( ( test == WATERTIGHT ) ? watertight<SIMD::Float4> ( ray , o , p[0] , p[1] , p[2] , SIMD::Float4 ( tMax ) , t , u , v )
+			                                    : mollerTrumbore<SIMD::Float4> ( o , d , p[0] , p[1] , p[2] , SIMD::Float4 ( tMax ) , t , u , v ) ).bits ( );
+
+			if ( bits == 0 )
+			{
+				continue;
+			}
+
+			float tt[4] , uu[4] , vv[4];
+			t.store ( tt );
+			u.store ( uu );
+			v.store ( vv );
+
+			for ( int lane = 0; lane < 4; ++lane )
+			{
+				if ( ( bits >> lane & 1 ) && tt[lane] < tMax )
+				{
+					hit.t = tMax = tt[lane];
+					hit.u = uu[lane];
+					hit.v = vv[lane];
+					index = i + lane;
+				}
+			}
+		}
+
+		for ( ; i < last; ++i )
+		{
+			Hit candidate;
+			if ( triangles[i].intersect ( origin , direction , candidate , test , tMax ) )
+			{
+				hit = candidate;
+				index = i;
+				tMax = candidate.t;
+			}
+		}
+	}
+
+	template < class Real >
+	std::size_t Triangle3<Real>::overlapRange ( const Triangle3* triangles , std::size_t first , std::size_t last , const BoundingBox3& box , unsigned int* mask )
+	{
+		std::size_t count = 0;
+
+		for ( std::size_t w = first; w < last; w += 32 )
+		{
+			std::size_t end = std::min<std::size_t> ( w + 32 , last );
+			unsigned int word = 0;
+
+			for ( std::size_t i = w; i < end; ++i )
+			{
+				if ( triangles[i].intersect ( box ) )
+				{
+					word |= 1u << ( i - w );
+					++count;
+				}
+			}
+			mask[w / 32] = word;
+		}
+
+		return count;
+	}
+
+	template < >
+	inline std::size_t Triangle3<float>::overlapRange ( const Triangle3* triangles , std::size_t first , std::size_t last , const BoundingBox3& box , unsigned int* mask )
+	{
+		Vector3 center = box.center ( );
+		Vector3 extent = box.extent ( ) * 0.5f;
+		const SIMD::Float4 half[3] = { SIMD::Float4 ( extent.x ) , SIMD::Float4 ( extent.y ) , SIMD::Float4 ( extent.z ) };
+
+		std::size_t count = 0;
+
+		for ( std::size_t w = first; w < last; w += 32 )
+		{
+			std::size_t end = std::min<std::size_t> ( w + 32 , last );
+			unsigned int word = 0;
+			std::size_t i = w;
+
+			for ( ; i + 4 <= end; i += 4 )
+			{
+				const Triangle3* q = triangles + i;
+				SIMD::Float4 p[3][3];
+
+				for ( int v = 0; v < 3; ++v )
+				{
+					for ( int k = 0; k < 3; ++k )
+					{
+						p[v][k] = SIMD::Float4 ( q[0].vertex_[v][k] , q[1].vertex_[v][k] , q[2].vertex_[v][k] , q[3].vertex_[v][k] ) - SIMD::Float4 ( center[k] );
+					}
+				}
+
+				word |= static_cast<unsigned int> ( separated<SIMD::Float4> ( p[0] , p[1] , p[2] , half ).bits ( ) ^ 0xF ) << ( i - w );
+			}
+
+			for ( ; i < end; ++i )
+			{
+				if ( triangles[i].intersect ( box ) )
+				{
+					word |= 1u << ( i - w );
+				}
+			}
+
+			mask[w / 32] = word;
+
+			for ( unsigned int v = word; v; v &= v - 1 )
+			{
+				++count;
+			}
+		}
+
+		return count;
+	}
+
+	template < class Real >
+	std::size_t Triangle3<Real>::intersect ( const Triangle3* triangles , std::size_t count , const Vector3& origin , const Vector3& direction , Hit& hit ,
+	                                         Test test , Real tMax )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		std::vector<Hit> hits ( blocks );
+		std::vector<std::size_t> index ( blocks , count );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			nearestRange ( triangles , first , last , origin , direction , test , tMax , hits[b] , index[b] );
+		}
+
+		std::size_t nearest = count;
+		for ( long b = 0; b < blocks; ++b )
+		{
+			if ( index[b] != count && ( nearest == count || hits[b].t < hit.t ) )
+			{
+				hit = hits[b];
+				nearest = index[b];
+			}
+		}
+
+		return nearest;
+	}
+
+	template < class Real >
+	std::size_t Triangle3<Real>::intersect ( const Triangle3* triangles , std::size_t count , const BoundingBox3& box , unsigned int* mask )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		long total = 0;
+
+		#pragma omp parallel for schedule(static) reduction(+:total) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			total += static_cast<long> ( overlapRange ( triangles , first , last , box , mask ) );
+		}
+
+		return static_cast<std::size_t> ( total );
+	}
+
+	template < class Real >
+	std::size_t Triangle3<Real>::closest ( const Triangle3* triangles , std::size_t count , const Vector3& p , Vector3& point )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		std::vector<Real> distance ( blocks , std::numeric_limits<Real>::max ( ) );
+		std::vector<Vector3> points ( blocks );
+		std::vector<std::size_t> index ( blocks , count );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+
+			for ( std::size_t i = first; i < last; ++i )
+			{
+				Vector3 q = triangles[i].closestPoint ( p );
+				Real squared = ( q - p ) * ( q - p );
+				if ( squared < distance[b] )
+				{
+					distance[b] = squared;
+					points[b] = q;
+					index[b] = i;
+				}
+			}
+		}
+
+		std::size_t nearest = count;
+		Real best = std::numeric_limits<Real>::max ( );
+		for ( long b = 0; b < blocks; ++b )
+		{
+			if ( index[b] != count && distance[b] < best )
+			{
+				best = distance[b];
+				point = points[b];
+				nearest = index[b];
+			}
+		}
+
+		return nearest;
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_TRIANGLE3_HPP_ */
@@ -0,0 +1,320 @@
+#ifndef CELER_MESH_HPP_
+#define CELER_MESH_HPP_
+
+//- Celer/Core/Geometry/Mesh/Mesh.hpp - Indexed triangle mesh --------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Mesh Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the Mesh class , an indexed
+//        triangle list with one array per vertex attribute.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector2.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Vector4.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+#include <Celer/Core/Geometry/Mesh/MeshOptimizer.hpp>
+#include <Celer/Core/Geometry/Mesh/TangentSpace.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class Mesh.
+	 *@brief Indexed triangle list , structure of arrays.
+	 *@details Each vertex attribute is its own stream , positions are
+	 * required , normals , tangents and texture coordinates are either empty
+	 * or as long as positions. Three indices make a triangle.
+	 *
+	 * bounds ( ) is cached , call computeBounds ( ) after moving positions.
+	 * optimize ( ) runs the three MeshOptimizer passes in order and keeps
+	 * every stream in step with the new vertex order.
+	 *
+	 * \code
+	 * Celer::Mesh<float> mesh;
+	 * mesh.positions ( ) = points;
+	 * mesh.indices ( ) = triangles;
+	 * mesh.optimize ( );
+	 * \endcode
+	 */
+	template < class Real >
+	class Mesh
+	{
+		public:
+
+			typedef Celer::Vector2<Real> 		Vector2;
+			typedef Celer::Vector3<Real> 		Vector3;
+			typedef Celer::Vector4<Real> 		Vector4;
+			typedef Celer::BoundingBox3<Real> 	BoundingBox3;
+			typedef Celer::MeshOptimizer<Real> 	Optimizer;
+			typedef Celer::TangentSpace<Real> 	TangentSpace;
+
+			Mesh ( )
+			{
+			}
+
+			Mesh ( const std::vector<Vector3>& positions , const std::vector<unsigned int>& indices ) : positions_ ( positions ) , indices_ ( indices )
+			{
+				this->computeBounds ( );
+			}
+
+			std::vector<Vector3>& positions ( )
+			{
+				return positions_;
+			}
+
+			const std::vector<Vector3>& positions ( ) const
+			{
+				return positions_;
+			}
+
+			std::vector<Vector3>& normals ( )
+			{
+				return normals_;
+			}
+
+			const std::vector<Vector3>& normals ( ) const
+			{
+				return normals_;
+			}
+
+			/// Unit tangent and , in w , the bitangent sign.
+			std::vector<Vector4>& tangents ( )
+			{
+				return tangents_;
+			}
+
+			const std::vector<Vector4>& tangents ( ) const
+			{
+				return tangents_;
+			}
+
+			std::vector<Vector2>& texCoords ( )
+			{
+				return texCoords_;
+			}
+
+			const std::vector<Vector2>& texCoords ( ) const
+			{
+				return texCoords_;
+			}
+
+			std::vector<unsigned int>& indices ( )
+			{
+				return indices_;
+			}
+
+			const std::vector<unsigned int>& indices ( ) const
+			{
+				return indices_;
+			}
+
+			std::size_t vertexCount ( ) const
+			{
+				return positions_.size ( );
+			}
+
+			std::size_t triangleCount ( ) const
+			{
+				return indices_.size ( ) / 3;
+			}
+
+			const BoundingBox3& bounds ( ) const
+			{
+				return bounds_;
+			}
+
+			/// Streams are empty or one entry per vertex , and every index is in range.
+			bool valid ( ) const;
+
+			void computeBounds ( );
+
+			/*!@brief Fills normals ( ) , see TangentSpace.
+			 * @details For a mesh deformed every frame keep a TangentSpace
+			 * around instead , it builds the adjacency only once.
+			 */
+			void computeNormals ( typename TangentSpace::Weighting weighting = TangentSpace::ANGLE );
+
+			/// Fills tangents ( ) from normals ( ) and texCoords ( ) , false if either is missing.
+			bool computeTangents ( );
+
+			/// Cost of the current order on a FIFO cache of cacheSize entries.
+			typename Optimizer::Statistics analyzeVertexCache ( unsigned int cacheSize = Optimizer::kFifoSize ) const
+			{
+				return Optimizer::analyzeVertexCache ( indices_.empty ( ) ? 0 : &indices_[0] , indices_.size ( ) , positions_.size ( ) , cacheSize );
+			}
+
+			void optimizeVertexCache ( );
+
+			void optimizeOverdraw ( Real threshold = static_cast<Real> ( 1.05 ) );
+
+			/// Renumbers vertices by first use , vertices no triangle uses are dropped.
+			/// A mesh without indices is left as it is.
+			void optimizeVertexFetch ( );
+
+			/// Vertex cache , overdraw and vertex fetch , in that order.
+			void optimize ( Real threshold = static_cast<Real> ( 1.05 ) )
+			{
+				this->optimizeVertexCache ( );
+				this->optimizeOverdraw ( threshold );
+				this->optimizeVertexFetch ( );
+			}
+
+		private:
+
+			enum
+			{
+				kBlock = 16384 	///< Vertices per thread task.
+			};
+
+			template < class T >
+			static void remap ( std::vector<T>& stream , const std::vector<unsigned int>& table , std::size_t used )
+			{
+				if ( stream.empty ( ) || used == 0 )
+				{
+					return;
+				}
+
+				std::vector<T> reordered ( used );
+				Optimizer::remapVertices ( &reordered[0] , &stream[0] , &table[0] , table.size ( ) );
+				stream.swap ( reordered );
+			}
+
+			std::vector<Vector3> 		positions_;
+			std::vector<Vector3> 		normals_;
+			std::vector<Vector4> 		tangents_;
+			std::vector<Vector2> 		texCoords_;
+			std::vector<unsigned int> 	indices_;
+
+			BoundingBox3 			bounds_;
+	};
+
+	template < class Real >
+	bool Mesh<Real>::valid ( ) const
+	{
+		std::size_t count = positions_.size ( );
+
+		if ( ( indices_.size ( ) % 3 ) != 0 || ( !normals_.empty ( ) && normals_.size ( ) != count ) ||
+		     ( !tangents_.empty ( ) && tangents_.size ( ) != count ) || ( !texCoords_.empty ( ) && texCoords_.size ( ) != count ) )
+		{
+			return false;
+		}
+
+		for ( std::size_t i = 0; i < indices_.size ( ); ++i )
+		{
+			if ( indices_[i] >= count )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template < class Real >
+	void Mesh<Real>::computeBounds ( )
+	{
+		std::size_t count = positions_.size ( );
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		std::vector<BoundingBox3> partial ( blocks );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			partial[b] = BoundingBox3::fromPoints ( &positions_[first] , last - first );
+		}
+
+		bounds_ = BoundingBox3::merge ( partial.empty ( ) ? 0 : &partial[0] , partial.size ( ) );
+	}
+
+	template < class Real >
+	void Mesh<Real>::computeNormals ( typename TangentSpace::Weighting weighting )
+	{
+		normals_.resize ( positions_.size ( ) );
+		if ( positions_.empty ( ) )
+		{
+			return;
+		}
+
+		TangentSpace frames;
+		frames.build ( indices_.empty ( ) ? 0 : &indices_[0] , indices_.size ( ) , positions_.size ( ) );
+		frames.normals ( &positions_[0] , &normals_[0] , weighting );
+	}
+
+	template < class Real >
+	bool Mesh<Real>::computeTangents ( )
+	{
+		if ( positions_.empty ( ) || normals_.size ( ) != positions_.size ( ) || texCoords_.size ( ) != positions_.size ( ) )
+		{
+			return false;
+		}
+
+		tangents_.resize ( positions_.size ( ) );
+
+		TangentSpace frames;
+		frames.build ( indices_.empty ( ) ? 0 : &indices_[0] , indices_.size ( ) , positions_.size ( ) );
+		frames.tangents ( &positions_[0] , &normals_[0] , &texCoords_[0] , &tangents_[0] );
+
+		return true;
+	}
+
+	template < class Real >
+	void Mesh<Real>::optimizeVertexCache ( )
+	{
+		if ( indices_.empty ( ) )
+		{
+			return;
+		}
+
+		Optimizer::optimizeVertexCache ( &indices_[0] , &indices_[0] , indices_.size ( ) , positions_.size ( ) );
+	}
+
+	template < class Real >
+	void Mesh<Real>::optimizeOverdraw ( Real threshold )
+	{
+		if ( indices_.empty ( ) )
+		{
+			return;
+		}
+
+		Optimizer::optimizeOverdraw ( &indices_[0] , &indices_[0] , indices_.size ( ) , &positions_[0] , positions_.size ( ) , threshold );
+	}
+
+	template < class Real >
+	void Mesh<Real>::optimizeVertexFetch ( )
+	{
+		// Without indices no vertex is in use , the streams stay as they are.
+		if ( positions_.empty ( ) || indices_.empty ( ) )
+		{
+			return;
+		}
+
+		std::vector<unsigned int> table ( positions_.size ( ) );
+		std::size_t used = Optimizer::optimizeVertexFetch ( &table[0] , indices_.empty ( ) ? 0 : &indices_[0] , indices_.size ( ) , positions_.size ( ) );
+
+		remap ( positions_ , table , used );
+		remap ( normals_ , table , used );
+		remap ( tangents_ , table , used );
+		remap ( texCoords_ , table , used );
+
+		this->computeBounds ( );
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_MESH_HPP_ */
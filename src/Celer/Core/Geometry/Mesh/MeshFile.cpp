@@ -0,0 +1,209 @@
+/*
+ * MeshFile.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Mesh/MeshFile.hpp>
+
+/// Standard C++ library
+#include <cstdio>
+
+namespace Celer
+{
+
+	namespace
+	{
+		const char kMagic[4] = { 'C' , 'M' , 'S' , 'H' };
+
+		uint64_t align ( uint64_t offset , uint64_t alignment )
+		{
+			return ( offset + alignment - 1 ) / alignment * alignment;
+		}
+
+		/// Writes count bytes at offset , zeros fill the gap since the last write.
+		bool put ( std::FILE* file , uint64_t& written , uint64_t offset , const void* bytes , std::size_t count , std::vector<unsigned char>& padding )
+		{
+			if ( offset > written )
+			{
+				padding.assign ( static_cast<std::size_t> ( offset - written ) , 0 );
+				if ( std::fwrite ( &padding[0] , 1 , padding.size ( ) , file ) != padding.size ( ) )
+				{
+					return false;
+				}
+			}
+
+			written = offset + count;
+
+			return count == 0 || std::fwrite ( bytes , 1 , count , file ) == count;
+		}
+	}
+
+	bool MeshFile::open ( const std::string& path )
+	{
+		this->close ( );
+
+		if ( !file_.open ( path ) )
+		{
+			return false;
+		}
+
+		Header header;
+		bool valid = file_.size ( ) >= sizeof ( Header );
+		if ( valid )
+		{
+			std::memcpy ( &header , file_.data ( ) , sizeof ( Header ) );
+			valid = std::memcmp ( header.magic , kMagic , 4 ) == 0 && header.version == kVersion && header.byteOrder == kByteOrder &&
+				header.headerSize == sizeof ( Header ) && header.sectionSize == sizeof ( Section ) && header.fileSize == file_.size ( ) &&
+				header.tableOffset % kAlignment == 0 && header.tableOffset <= header.fileSize &&
+				header.sectionCount <= ( header.fileSize - header.tableOffset ) / sizeof ( Section );
+		}
+
+		// A damaged table would send data ( ) outside the mapping , check every entry once here.
+		const Section* table = valid ? reinterpret_cast<const Section*> ( file_.data ( ) + header.tableOffset ) : 0;
+		for ( std::size_t i = 0; valid && i < header.sectionCount; ++i )
+		{
+			const Section& entry = table[i];
+			valid = entry.mesh < header.meshCount && entry.stride > 0 && entry.offset % kAlignment == 0 && entry.offset <= header.fileSize &&
+				entry.count <= ( header.fileSize - entry.offset ) / entry.stride;
+		}
+
+		if ( !valid )
+		{
+			file_.close ( );
+			return false;
+		}
+
+		sections_ = table;
+		sectionCount_ = header.sectionCount;
+		meshCount_ = header.meshCount;
+
+		return true;
+	}
+
+	void MeshFile::close ( )
+	{
+		file_.close ( );
+		sections_ = 0;
+		sectionCount_ = 0;
+		meshCount_ = 0;
+	}
+
+	const MeshFile::Section* MeshFile::find ( Kind kind , std::size_t mesh , std::size_t lod ) const
+	{
+		for ( std::size_t i = 0; i < sectionCount_; ++i )
+		{
+			if ( sections_[i].kind == static_cast<uint32_t> ( kind ) && sections_[i].mesh == mesh && sections_[i].lod == lod )
+			{
+				return &sections_[i];
+			}
+		}
+
+		return 0;
+	}
+
+	std::size_t MeshFile::lodCount ( std::size_t mesh ) const
+	{
+		std::size_t count = 0;
+		for ( std::size_t i = 0; i < sectionCount_; ++i )
+		{
+			if ( sections_[i].kind == static_cast<uint32_t> ( INDICES ) && sections_[i].mesh == mesh )
+			{
+				++count;
+			}
+		}
+
+		return count;
+	}
+
+	MeshFile::Writer::Block& MeshFile::Writer::append ( Kind kind , std::size_t mesh , std::size_t lod , std::size_t stride , std::size_t count )
+	{
+		blocks_.push_back ( Block ( ) );
+
+		Block& block = blocks_.back ( );
+		std::memset ( &block.section , 0 , sizeof ( Section ) );
+		block.section.kind = static_cast<uint32_t> ( kind );
+		block.section.mesh = static_cast<uint32_t> ( mesh );
+		block.section.lod = static_cast<uint32_t> ( lod );
+		block.section.stride = static_cast<uint32_t> ( stride );
+		block.section.count = count;
+		block.bytes.resize ( stride * count );
+
+		return block;
+	}
+
+	void MeshFile::Writer::addLevel ( std::size_t mesh , const std::vector<unsigned int>& indices , float error )
+	{
+		std::size_t lod = 0;
+		for ( std::size_t i = 0; i < blocks_.size ( ); ++i )
+		{
+			if ( blocks_[i].section.kind == static_cast<uint32_t> ( INDICES ) && blocks_[i].section.mesh == mesh )
+			{
+				++lod;
+			}
+		}
+
+		Block& block = this->append ( INDICES , mesh , lod , sizeof ( uint32_t ) , indices.size ( ) );
+		block.section.error = error;
+		for ( std::size_t i = 0; i < indices.size ( ); ++i )
+		{
+			uint32_t index = static_cast<uint32_t> ( indices[i] );
+			std::memcpy ( &block.bytes[i * sizeof ( uint32_t )] , &index , sizeof ( uint32_t ) );
+		}
+	}
+
+	bool MeshFile::Writer::write ( const std::string& path ) const
+	{
+		const uint64_t page = static_cast<uint64_t> ( MappedFile::pageSize ( ) );
+
+		// Header , table , then the blocks in the order they were added.
+		std::vector<Section> table ( blocks_.size ( ) );
+		uint64_t offset = align ( sizeof ( Header ) , kAlignment ) + align ( sizeof ( Section ) * table.size ( ) , kAlignment );
+		for ( std::size_t i = 0; i < blocks_.size ( ); ++i )
+		{
+			table[i] = blocks_[i].section;
+			table[i].offset = align ( offset , blocks_[i].bytes.size ( ) >= page ? page : static_cast<uint64_t> ( kAlignment ) );
+			offset = table[i].offset + blocks_[i].bytes.size ( );
+		}
+
+		Header header;
+		std::memset ( &header , 0 , sizeof ( Header ) );
+		std::memcpy ( header.magic , kMagic , 4 );
+		header.version = kVersion;
+		header.byteOrder = kByteOrder;
+		header.headerSize = sizeof ( Header );
+		header.sectionSize = sizeof ( Section );
+		header.sectionCount = static_cast<uint32_t> ( table.size ( ) );
+		header.meshCount = static_cast<uint32_t> ( meshCount_ );
+		header.tableOffset = align ( sizeof ( Header ) , kAlignment );
+		header.fileSize = offset;
+
+		std::FILE* file = std::fopen ( path.c_str ( ) , "wb" );
+		if ( file == 0 )
+		{
+			return false;
+		}
+
+		std::vector<unsigned char> padding;
+		uint64_t written = 0;
+
+		bool ok = put ( file , written , 0 , &header , sizeof ( Header ) , padding );
+		if ( ok && !table.empty ( ) )
+		{
+			ok = put ( file , written , header.tableOffset , &table[0] , sizeof ( Section ) * table.size ( ) , padding );
+		}
+		for ( std::size_t i = 0; ok && i < blocks_.size ( ); ++i )
+		{
+			ok = put ( file , written , table[i].offset , blocks_[i].bytes.empty ( ) ? 0 : &blocks_[i].bytes[0] , blocks_[i].bytes.size ( ) , padding );
+		}
+
+		// Empty blocks at the end still count in fileSize.
+		if ( ok && written < offset )
+		{
+			ok = put ( file , written , offset , 0 , 0 , padding );
+		}
+
+		return ( std::fclose ( file ) == 0 ) && ok;
+	}
+
+}/* Celer :: NAMESPACE */
@@ -0,0 +1,385 @@
+#ifndef CELER_MESHFILE_HPP_
+#define CELER_MESHFILE_HPP_
+
+//- Celer/Core/Geometry/Mesh/MeshFile.hpp - Binary mesh container ----------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Mesh Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the MeshFile class which
+//        reads meshes , their bounds and transforms straight from a memory
+//        mapped binary file , and of its Writer.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+/// Celer Library
+#include <Celer/Base/MappedFile.hpp>
+#include <Celer/Core/Geometry/Math/Vector2.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Vector4.hpp>
+#include <Celer/Core/Geometry/Math/Matrix4x4.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+#include <Celer/Core/Geometry/Mesh/Mesh.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class MeshFile.
+	 *@brief Versioned binary container of meshes , read through a MappedFile.
+	 *@details A file is a Header , a table of Sections and the sections'
+	 * bytes. Each section is one stream of one mesh: positions , normals ,
+	 * tangents , texture coordinates , the indices of one level of detail ,
+	 * the bounding box or the transform. Everything is float or 32 bit
+	 * unsigned , tightly packed , in the byte order of the writer , a file
+	 * of the other byte order is refused by open ( ).
+	 *
+	 * Sections start on kAlignment bytes , and those longer than a page on
+	 * a page , so no two large streams share a page. open ( ) only reads the
+	 * header and the table: data ( ) is a pointer into the mapping and its
+	 * pages are read the first time they are touched , a level of detail
+	 * that is never drawn is never read. The pointer can go to
+	 * PixelBuffer::setData or be copied into PixelBuffer::map as is.
+	 *
+	 * \code
+	 * Celer::MeshFile file;
+	 * file.open ( "bunny.cmsh" );
+	 * const Celer::MeshFile::Section* lod = file.find ( Celer::MeshFile::INDICES , 0 , 2 );
+	 * buffer.bind ( GL_ELEMENT_ARRAY_BUFFER );
+	 * buffer.setData ( file.mapping ( ) , lod->offset , file.bytes ( *lod ) , GL_STATIC_DRAW );
+	 * \endcode
+	 */
+	class MeshFile : public Celer::NonCopyable
+	{
+		public:
+
+			enum
+			{
+				kVersion 	= 1 ,
+				kAlignment 	= 64 ,
+				kByteOrder 	= 0x01020304
+			};
+
+			enum Kind
+			{
+				POSITIONS = 1 , 	///< float x , y , z.
+				NORMALS , 		///< float x , y , z.
+				TANGENTS , 		///< float x , y , z and the bitangent sign.
+				TEXCOORDS , 		///< float u , v.
+				INDICES , 		///< unsigned , three per triangle , one section per level of detail.
+				BOUNDS , 		///< float min x , y , z then max x , y , z.
+				TRANSFORM 		///< float 4x4 , row major.
+			};
+
+			/// First bytes of the file.
+			struct Header
+			{
+				char 		magic[4]; 	///< "CMSH".
+				uint32_t 	version;
+				uint32_t 	byteOrder; 	///< kByteOrder as the writer stored it.
+				uint32_t 	headerSize;
+				uint32_t 	sectionSize;
+				uint32_t 	sectionCount;
+				uint32_t 	meshCount;
+				uint32_t 	reserved;
+				uint64_t 	tableOffset;
+				uint64_t 	fileSize;
+			};
+
+			/// One entry of the table.
+			struct Section
+			{
+				uint32_t 	kind;
+				uint32_t 	mesh;
+				uint32_t 	lod; 		///< 0 for every kind but INDICES.
+				uint32_t 	stride; 	///< Bytes per element.
+				uint64_t 	offset; 	///< From the start of the file.
+				uint64_t 	count; 		///< Elements.
+				float 		error; 		///< Simplification error of an INDICES level , 0 for the others.
+				uint32_t 	reserved[3];
+			};
+
+			class Writer;
+
+			MeshFile ( ) : sections_ ( 0 ) , sectionCount_ ( 0 ) , meshCount_ ( 0 )
+			{
+			}
+
+			/// Maps path and checks its header and table , false if either is wrong.
+			bool open ( const std::string& path );
+
+			void close ( );
+
+			bool isOpen ( ) const
+			{
+				return file_.isOpen ( );
+			}
+
+			std::size_t meshCount ( ) const
+			{
+				return meshCount_;
+			}
+
+			std::size_t sectionCount ( ) const
+			{
+				return sections_ ? sectionCount_ : 0;
+			}
+
+			const Section& section ( std::size_t index ) const
+			{
+				return sections_[index];
+			}
+
+			/// The section of kind for mesh and level , 0 if the file has none.
+			const Section* find ( Kind kind , std::size_t mesh , std::size_t lod = 0 ) const;
+
+			/// INDICES sections of mesh.
+			std::size_t lodCount ( std::size_t mesh ) const;
+
+			/// First byte of the section , inside the mapping.
+			const void* data ( const Section& section ) const
+			{
+				return file_.data ( ) + section.offset;
+			}
+
+			std::size_t bytes ( const Section& section ) const
+			{
+				return static_cast<std::size_t> ( section.count * section.stride );
+			}
+
+			/// Starts reading the section's pages ahead of its use.
+			void prefetch ( const Section& section ) const
+			{
+				file_.prefetch ( static_cast<std::size_t> ( section.offset ) , this->bytes ( section ) );
+			}
+
+			/// Lets the section's pages go , a level of detail out of use for example.
+			void evict ( const Section& section ) const
+			{
+				file_.evict ( static_cast<std::size_t> ( section.offset ) , this->bytes ( section ) );
+			}
+
+			const MappedFile& mapping ( ) const
+			{
+				return file_;
+			}
+
+			/// Stored box of mesh , an empty box if there is none.
+			template < class Real >
+			BoundingBox3<Real> bounds ( std::size_t mesh ) const;
+
+			/// Stored transform of mesh , identity if there is none.
+			template < class Real >
+			Matrix4x4<Real> transform ( std::size_t mesh ) const;
+
+			/*!@brief Copies the streams of mesh and its level lod into target.
+			 * @details For code that edits the mesh , drawing should use data ( ).
+			 * False if the file has no positions or no such level.
+			 */
+			template < class Real >
+			bool read ( std::size_t mesh , std::size_t lod , Celer::Mesh<Real>& target ) const;
+
+		private:
+
+			template < class T , class Real , int N >
+			void unpack ( Kind kind , std::size_t mesh , std::vector<T>& stream ) const
+			{
+				const Section* entry = this->find ( kind , mesh );
+				if ( entry == 0 || entry->stride != N * sizeof ( float ) )
+				{
+					stream.clear ( );
+					return;
+				}
+
+				const float* source = static_cast<const float*> ( this->data ( *entry ) );
+				stream.resize ( static_cast<std::size_t> ( entry->count ) );
+				for ( std::size_t i = 0; i < stream.size ( ); ++i )
+				{
+					for ( int k = 0; k < N; ++k )
+					{
+						stream[i][k] = static_cast<Real> ( source[i * N + k] );
+					}
+				}
+			}
+
+			MappedFile 		file_;
+			const Section* 		sections_;
+			std::size_t 		sectionCount_;
+			std::size_t 		meshCount_;
+	};
+
+	/*!
+	 *@class MeshFile::Writer.
+	 *@brief Collects meshes , converting them to float , and writes a MeshFile.
+	 *
+	 * \code
+	 * Celer::MeshFile::Writer writer;
+	 * std::size_t id = writer.add ( mesh );
+	 * for ( std::size_t i = 0; i < levels.size ( ); ++i )
+	 * 	writer.addLevel ( id , levels[i].indices , levels[i].error );
+	 * writer.write ( "bunny.cmsh" );
+	 * \endcode
+	 */
+	class MeshFile::Writer
+	{
+		public:
+
+			Writer ( ) : meshCount_ ( 0 )
+			{
+			}
+
+			/// Adds every stream of mesh , its bounds and transform , as level 0. Returns the mesh index.
+			template < class Real >
+			std::size_t add ( const Celer::Mesh<Real>& mesh , const Matrix4x4<Real>& transform = Matrix4x4<Real> ( ) );
+
+			/// Adds the next level of detail of mesh , indices into its level 0 vertices.
+			void addLevel ( std::size_t mesh , const std::vector<unsigned int>& indices , float error );
+
+			/// Lays the sections out and writes them , false on an I/O error.
+			bool write ( const std::string& path ) const;
+
+			void clear ( )
+			{
+				blocks_.clear ( );
+				meshCount_ = 0;
+			}
+
+		private:
+
+			struct Block
+			{
+				Section 			section;
+				std::vector<unsigned char> 	bytes;
+			};
+
+			Block& append ( Kind kind , std::size_t mesh , std::size_t lod , std::size_t stride , std::size_t count );
+
+			template < class T , int N >
+			void pack ( Kind kind , std::size_t mesh , const std::vector<T>& stream )
+			{
+				if ( stream.empty ( ) )
+				{
+					return;
+				}
+
+				Block& block = this->append ( kind , mesh , 0 , N * sizeof ( float ) , stream.size ( ) );
+				float* target = reinterpret_cast<float*> ( &block.bytes[0] );
+				for ( std::size_t i = 0; i < stream.size ( ); ++i )
+				{
+					for ( int k = 0; k < N; ++k )
+					{
+						target[i * N + k] = static_cast<float> ( stream[i][k] );
+					}
+				}
+			}
+
+			std::vector<Block> 	blocks_;
+			std::size_t 		meshCount_;
+	};
+
+	template < class Real >
+	BoundingBox3<Real> MeshFile::bounds ( std::size_t mesh ) const
+	{
+		const Section* entry = this->find ( BOUNDS , mesh );
+		if ( entry == 0 || entry->stride != 6 * sizeof ( float ) || entry->count == 0 )
+		{
+			return BoundingBox3<Real> ( );
+		}
+
+		const float* box = static_cast<const float*> ( this->data ( *entry ) );
+		return BoundingBox3<Real> ( box[0] , box[1] , box[2] , box[3] , box[4] , box[5] );
+	}
+
+	template < class Real >
+	Matrix4x4<Real> MeshFile::transform ( std::size_t mesh ) const
+	{
+		Matrix4x4<Real> matrix;
+
+		const Section* entry = this->find ( TRANSFORM , mesh );
+		if ( entry == 0 || entry->stride != 16 * sizeof ( float ) || entry->count == 0 )
+		{
+			return matrix;
+		}
+
+		const float* rows = static_cast<const float*> ( this->data ( *entry ) );
+		for ( int i = 0; i < 4; ++i )
+		{
+			matrix[i] = Vector4<Real> ( rows[4 * i] , rows[4 * i + 1] , rows[4 * i + 2] , rows[4 * i + 3] );
+		}
+
+		return matrix;
+	}
+
+	template < class Real >
+	bool MeshFile::read ( std::size_t mesh , std::size_t lod , Celer::Mesh<Real>& target ) const
+	{
+		const Section* indices = this->find ( INDICES , mesh , lod );
+		if ( this->find ( POSITIONS , mesh ) == 0 || indices == 0 || indices->stride != sizeof ( uint32_t ) )
+		{
+			return false;
+		}
+
+		this->unpack<Vector3<Real> , Real , 3> ( POSITIONS , mesh , target.positions ( ) );
+		this->unpack<Vector3<Real> , Real , 3> ( NORMALS , mesh , target.normals ( ) );
+		this->unpack<Vector4<Real> , Real , 4> ( TANGENTS , mesh , target.tangents ( ) );
+		this->unpack<Vector2<Real> , Real , 2> ( TEXCOORDS , mesh , target.texCoords ( ) );
+
+		target.indices ( ).resize ( static_cast<std::size_t> ( indices->count ) );
+		if ( indices->count > 0 )
+		{
+			std::memcpy ( &target.indices ( )[0] , this->data ( *indices ) , this->bytes ( *indices ) );
+		}
+
+		target.computeBounds ( );
+
+		return target.valid ( );
+	}
+
+	template < class Real >
+	std::size_t MeshFile::Writer::add ( const Celer::Mesh<Real>& mesh , const Matrix4x4<Real>& transform )
+	{
+		std::size_t id = meshCount_++;
+
+		this->pack<Vector3<Real> , 3> ( POSITIONS , id , mesh.positions ( ) );
+		this->pack<Vector3<Real> , 3> ( NORMALS , id , mesh.normals ( ) );
+		this->pack<Vector4<Real> , 4> ( TANGENTS , id , mesh.tangents ( ) );
+		this->pack<Vector2<Real> , 2> ( TEXCOORDS , id , mesh.texCoords ( ) );
+
+		this->addLevel ( id , mesh.indices ( ) , 0.0f );
+
+		Vector3<Real> lower = mesh.bounds ( ).box_min ( );
+		Vector3<Real> upper = mesh.bounds ( ).box_max ( );
+		float* box = reinterpret_cast<float*> ( &this->append ( BOUNDS , id , 0 , 6 * sizeof ( float ) , 1 ).bytes[0] );
+		for ( int k = 0; k < 3; ++k )
+		{
+			box[k] = static_cast<float> ( lower[k] );
+			box[k + 3] = static_cast<float> ( upper[k] );
+		}
+
+		float* rows = reinterpret_cast<float*> ( &this->append ( TRANSFORM , id , 0 , 16 * sizeof ( float ) , 1 ).bytes[0] );
+		for ( int i = 0; i < 4; ++i )
+		{
+			for ( int j = 0; j < 4; ++j )
+			{
+				rows[4 * i + j] = static_cast<float> ( transform ( i , j ) );
+			}
+		}
+
+		return id;
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_MESHFILE_HPP_ */
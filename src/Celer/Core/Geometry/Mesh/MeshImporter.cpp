@@ -0,0 +1,7 @@
+/*
+ * MeshImporter.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Mesh/MeshImporter.hpp>
@@ -0,0 +1,1173 @@
+#ifndef CELER_MESHIMPORTER_HPP_
+#define CELER_MESHIMPORTER_HPP_
+
+//- Celer/Core/Geometry/Mesh/MeshImporter.hpp - OBJ and PLY readers -------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Mesh Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the MeshImporter class which
+//        reads Wavefront OBJ and ASCII or binary PLY files into a Mesh , in
+//        parallel over line aligned chunks.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+/// Celer Library
+#include <Celer/Base/MappedFile.hpp>
+#include <Celer/Base/Text.hpp>
+#include <Celer/Core/Geometry/Math/Vector2.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Mesh/Mesh.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class MeshImporter.
+	 *@brief Parallel OBJ and PLY readers.
+	 *@details Text is cut in chunks of about kChunk bytes , each moved to
+	 * the start of a line , and the chunks are parsed at once. Numbers go
+	 * through Text::parse , a correctly rounded fast path with no locale and
+	 * no copies.
+	 *
+	 * An OBJ chunk collects its own vertices and faces , polygons split in
+	 * fans. The chunks are then copied into the mesh streams , and a fixup
+	 * pass turns the negative indices , relative to the last vertex , into
+	 * absolute ones. An OBJ corner indexes positions , texture coordinates
+	 * and normals separately , a position used with two different pairs is
+	 * duplicated so every stream shares one index. Other statements , groups
+	 * and materials among them , are skipped.
+	 *
+	 * PLY reads x , y , z , nx , ny , nz , u , v ( or s , t ) from the vertex
+	 * element and vertex_indices from the face element. Binary vertices are
+	 * fixed size and decoded in parallel blocks , binary faces are first
+	 * walked once to find where each block starts. ASCII bodies count their
+	 * lines per chunk first , so every chunk knows which element it is in.
+	 *
+	 * The readers return false on malformed input or an index out of range ,
+	 * leaving the mesh in an unspecified state.
+	 *
+	 * \code
+	 * Celer::Mesh<float> mesh;
+	 * if ( !Celer::MeshImporter<float>::read ( "scan.ply" , mesh ) )
+	 * 	std::cerr << "can't read scan.ply" << std::endl;
+	 * \endcode
+	 */
+	template < class Real >
+	class MeshImporter
+	{
+		public:
+
+			typedef Celer::Vector2<Real> 	Vector2;
+			typedef Celer::Vector3<Real> 	Vector3;
+			typedef Celer::Mesh<Real> 	Mesh;
+
+			enum
+			{
+				kChunk = 1 << 20 ,	///< Bytes of text per task.
+				kBlock = 1 << 16 	///< Binary PLY elements per task.
+			};
+
+			/// Maps path and reads it as PLY if it starts with "ply" , as OBJ otherwise.
+			static bool read ( const std::string& path , Mesh& mesh );
+
+			static bool readObj ( const char* data , std::size_t size , Mesh& mesh );
+
+			static bool readPly ( const char* data , std::size_t size , Mesh& mesh );
+
+		private:
+
+			/// Chunk boundaries , each at a line start , first and last included.
+			static std::vector<const char*> split ( const char* first , const char* last );
+
+			/// count numbers separated by blanks , false if one is missing.
+			static const char* numbers ( const char* p , const char* last , Real* values , int count )
+			{
+				for ( int k = 0; k < count && p != 0; ++k )
+				{
+					p = Text::parse ( Text::skipSpaces ( p , last ) , last , values[k] );
+				}
+				return p;
+			}
+
+			/// -- OBJ --
+
+			/// A negative index , resolved against the chunk's own counts.
+			struct Relative
+			{
+				std::size_t 	slot; 	///< Corner in the chunk.
+				long 		value; 	///< Index from the chunk's first vertex of that stream , may be negative.
+				int 		stream; ///< 0 position , 1 texture coordinate , 2 normal.
+			};
+
+			struct ObjChunk
+			{
+				ObjChunk ( ) : failed ( false )
+				{
+				}
+
+				std::vector<Vector3> 		positions;
+				std::vector<Vector2> 		texCoords;
+				std::vector<Vector3> 		normals;
+				/// Position , texture coordinate and normal of each triangle corner. The last two stay empty until used.
+				std::vector<unsigned int> 	corners[3];
+				std::vector<Relative> 		relative;
+				bool 				failed;
+
+				/// Frees the memory once the chunk is copied out.
+				void release ( )
+				{
+					std::vector<Vector3> ( ).swap ( positions );
+					std::vector<Vector2> ( ).swap ( texCoords );
+					std::vector<Vector3> ( ).swap ( normals );
+					std::vector<Relative> ( ).swap ( relative );
+					for ( int s = 0; s < 3; ++s )
+					{
+						std::vector<unsigned int> ( ).swap ( corners[s] );
+					}
+				}
+			};
+
+			static void parseObj ( const char* first , const char* last , ObjChunk& chunk );
+
+			/// Orders corners by position , texture coordinate and normal.
+			struct CornerOrder
+			{
+				CornerOrder ( const std::vector<unsigned int>* corners ) : corners_ ( corners )
+				{
+				}
+
+				bool operator ( ) ( std::size_t a , std::size_t b ) const
+				{
+					for ( int s = 0; s < 3; ++s )
+					{
+						unsigned int left = corners_[s].empty ( ) ? 0u : corners_[s][a];
+						unsigned int right = corners_[s].empty ( ) ? 0u : corners_[s][b];
+						if ( left != right )
+						{
+							return left < right;
+						}
+					}
+					return a < b;
+				}
+
+				const std::vector<unsigned int>* corners_;
+			};
+
+			/// One index per corner , duplicating positions used with more than one attribute pair.
+			static void weld ( std::vector<unsigned int>* corners , const std::vector<Vector2>& texCoords , const std::vector<Vector3>& normals , Mesh& mesh );
+
+			/// -- PLY --
+
+			enum Type
+			{
+				INT8 , UINT8 , INT16 , UINT16 , INT32 , UINT32 , FLOAT32 , FLOAT64 , UNKNOWN
+			};
+
+			enum Target
+			{
+				SKIP , X , Y , Z , NX , NY , NZ , U , V , VERTEX_INDICES
+			};
+
+			enum Format
+			{
+				ASCII , BINARY_LITTLE_ENDIAN , BINARY_BIG_ENDIAN
+			};
+
+			struct Property
+			{
+				Type 	type;
+				Type 	countType; 	///< UNKNOWN unless a list.
+				Target 	target;
+			};
+
+			struct Element
+			{
+				std::string 		name;
+				std::size_t 		count;
+				std::vector<Property> 	properties;
+
+				/// Bytes per binary element , 0 if it has a list.
+				std::size_t stride ( ) const
+				{
+					std::size_t bytes = 0;
+					for ( std::size_t i = 0; i < properties.size ( ); ++i )
+					{
+						if ( properties[i].countType != UNKNOWN )
+						{
+							return 0;
+						}
+						bytes += size ( properties[i].type );
+					}
+					return bytes;
+				}
+
+				/// Fewest bytes an element takes in the body , its lists empty. An
+				/// ASCII value is a digit and a separator , an empty line a break.
+				std::size_t least ( Format format ) const
+				{
+					if ( format == ASCII )
+					{
+						return std::max<std::size_t> ( 2 * properties.size ( ) , 1 );
+					}
+
+					std::size_t bytes = 0;
+					for ( std::size_t i = 0; i < properties.size ( ); ++i )
+					{
+						bytes += size ( ( properties[i].countType != UNKNOWN ) ? properties[i].countType : properties[i].type );
+					}
+					return std::max<std::size_t> ( bytes , 1 );
+				}
+			};
+
+			struct Header
+			{
+				Format 			format;
+				std::vector<Element> 	elements;
+				std::size_t 		vertex; 	///< Element index , elements.size ( ) if none.
+				std::size_t 		face;
+				const char* 		body;
+			};
+
+			static bool parseHeader ( const char* data , const char* last , Header& header );
+
+			static Type type ( const std::string& name );
+
+			static std::size_t size ( Type type )
+			{
+				static const std::size_t sizes[] = { 1 , 1 , 2 , 2 , 4 , 4 , 4 , 8 , 0 };
+				return sizes[type];
+			}
+
+			/// A binary PLY value , any type , in any byte order.
+			static double scalar ( const unsigned char* p , Type type , bool swap );
+
+			static bool readPlyBinary ( const Header& header , const unsigned char* p , const unsigned char* last , Mesh& mesh );
+
+			static bool readPlyAscii ( const Header& header , const char* first , const char* last , Mesh& mesh );
+
+			static void assign ( Target target , Real value , std::size_t vertex , Mesh& mesh )
+			{
+				switch ( target )
+				{
+					case X: mesh.positions ( )[vertex].x = value; break;
+					case Y: mesh.positions ( )[vertex].y = value; break;
+					case Z: mesh.positions ( )[vertex].z = value; break;
+					case NX: if ( !mesh.normals ( ).empty ( ) ) mesh.normals ( )[vertex].x = value; break;
+					case NY: if ( !mesh.normals ( ).empty ( ) ) mesh.normals ( )[vertex].y = value; break;
+					case NZ: if ( !mesh.normals ( ).empty ( ) ) mesh.normals ( )[vertex].z = value; break;
+					case U: if ( !mesh.texCoords ( ).empty ( ) ) mesh.texCoords ( )[vertex].x = value; break;
+					case V: if ( !mesh.texCoords ( ).empty ( ) ) mesh.texCoords ( )[vertex].y = value; break;
+					default: break;
+				}
+			}
+
+			/// Splits polygon in a fan at triangles , false if an index is out of range.
+			static bool fan ( const std::vector<unsigned int>& polygon , std::size_t vertexCount , unsigned int* triangles )
+			{
+				for ( std::size_t k = 0; k < polygon.size ( ); ++k )
+				{
+					if ( polygon[k] >= vertexCount )
+					{
+						return false;
+					}
+				}
+
+				for ( std::size_t k = 2; k < polygon.size ( ); ++k , triangles += 3 )
+				{
+					triangles[0] = polygon[0];
+					triangles[1] = polygon[k - 1];
+					triangles[2] = polygon[k];
+				}
+
+				return true;
+			}
+	};
+
+	template < class Real >
+	bool MeshImporter<Real>::read ( const std::string& path , Mesh& mesh )
+	{
+		MappedFile file;
+		if ( !file.open ( path ) )
+		{
+			return false;
+		}
+
+		const char* data = reinterpret_cast<const char*> ( file.data ( ) );
+
+		// Read once front to back , let the kernel read ahead.
+		file.prefetch ( 0 , file.size ( ) );
+
+		if ( file.size ( ) >= 3 && std::memcmp ( data , "ply" , 3 ) == 0 )
+		{
+			return readPly ( data , file.size ( ) , mesh );
+		}
+
+		return readObj ( data , file.size ( ) , mesh );
+	}
+
+	template < class Real >
+	std::vector<const char*> MeshImporter<Real>::split ( const char* first , const char* last )
+	{
+		std::size_t chunks = std::max<std::size_t> ( 1 , ( static_cast<std::size_t> ( last - first ) + kChunk - 1 ) / kChunk );
+
+		std::vector<const char*> bounds ( chunks + 1 , last );
+		bounds[0] = first;
+		for ( std::size_t c = 1; c < chunks; ++c )
+		{
+			const char* p = first + c * kChunk;
+			bounds[c] = ( p[-1] == '\n' ) ? p : Text::nextLine ( p , last );
+		}
+
+		return bounds;
+	}
+
+	template < class Real >
+	void MeshImporter<Real>::parseObj ( const char* first , const char* last , ObjChunk& chunk )
+	{
+		struct Corner
+		{
+			long 	value[3];
+			int 	kind[3]; 	///< 0 missing , 1 absolute , 2 relative.
+		};
+
+		std::vector<Corner> polygon;
+
+		for ( const char* p = first; p < last && !chunk.failed; )
+		{
+			const char* next = Text::nextLine ( p , last );
+			const char* end = ( next > p && next[-1] == '\n' ) ? next - 1 : next;
+
+			p = Text::skipSpaces ( p , end );
+
+			if ( end - p >= 2 && p[0] == 'v' && Text::isSpace ( p[1] ) )
+			{
+				Real xyz[3];
+				chunk.failed = numbers ( p + 2 , end , xyz , 3 ) == 0;
+				chunk.positions.push_back ( Vector3 ( xyz[0] , xyz[1] , xyz[2] ) );
+			}
+			else if ( end - p >= 3 && p[0] == 'v' && p[1] == 't' && Text::isSpace ( p[2] ) )
+			{
+				// v is optional.
+				Real uv[2] = { static_cast<Real> ( 0 ) , static_cast<Real> ( 0 ) };
+				const char* q = numbers ( p + 3 , end , uv , 1 );
+				chunk.failed = ( q == 0 );
+				if ( q != 0 )
+				{
+					numbers ( q , end , uv + 1 , 1 );
+				}
+				chunk.texCoords.push_back ( Vector2 ( uv[0] , uv[1] ) );
+			}
+			else if ( end - p >= 3 && p[0] == 'v' && p[1] == 'n' && Text::isSpace ( p[2] ) )
+			{
+				Real xyz[3];
+				chunk.failed = numbers ( p + 3 , end , xyz , 3 ) == 0;
+				chunk.normals.push_back ( Vector3 ( xyz[0] , xyz[1] , xyz[2] ) );
+			}
+			else if ( end - p >= 2 && p[0] == 'f' && Text::isSpace ( p[1] ) )
+			{
+				const std::size_t counts[3] = { chunk.positions.size ( ) , chunk.texCoords.size ( ) , chunk.normals.size ( ) };
+
+				polygon.clear ( );
+				for ( const char* q = Text::skipSpaces ( p + 1 , end ); q != end && !chunk.failed; q = Text::skipSpaces ( q , end ) )
+				{
+					// v , v/vt , v//vn or v/vt/vn.
+					Corner corner = { { 0 , 0 , 0 } , { 0 , 0 , 0 } };
+					for ( int s = 0; s < 3 && q != 0; ++s )
+					{
+						if ( s > 0 )
+						{
+							if ( q == end || *q != '/' )
+							{
+								break;
+							}
+							++q;
+							if ( s == 1 && q != end && *q == '/' )
+							{
+								continue;
+							}
+						}
+
+						long index = 0;
+						q = Text::parse ( q , end , index );
+						if ( q == 0 || index == 0 )
+						{
+							q = 0;
+							break;
+						}
+
+						corner.kind[s] = ( index > 0 ) ? 1 : 2;
+						corner.value[s] = ( index > 0 ) ? index - 1 : static_cast<long> ( counts[s] ) + index;
+					}
+
+					if ( q == 0 || ( q != end && !Text::isSpace ( *q ) ) )
+					{
+						chunk.failed = true;
+						break;
+					}
+
+					polygon.push_back ( corner );
+				}
+
+				for ( std::size_t k = 2; k < polygon.size ( ) && !chunk.failed; ++k )
+				{
+					const Corner* triangle[3] = { &polygon[0] , &polygon[k - 1] , &polygon[k] };
+					for ( int j = 0; j < 3; ++j )
+					{
+						for ( int s = 0; s < 3; ++s )
+						{
+							std::vector<unsigned int>& stream = chunk.corners[s];
+							if ( s > 0 )
+							{
+								if ( triangle[j]->kind[s] == 0 && stream.empty ( ) )
+								{
+									continue;
+								}
+								// Corners before the first with this attribute have none.
+								stream.resize ( chunk.corners[0].size ( ) - 1 , ~0u );
+							}
+
+							if ( triangle[j]->kind[s] == 2 )
+							{
+								Relative relative = { stream.size ( ) , triangle[j]->value[s] , s };
+								chunk.relative.push_back ( relative );
+							}
+
+							stream.push_back ( triangle[j]->kind[s] == 1 ? static_cast<unsigned int> ( triangle[j]->value[s] ) : ~0u );
+						}
+					}
+				}
+			}
+
+			p = next;
+		}
+	}
+
+	template < class Real >
+	bool MeshImporter<Real>::readObj ( const char* data , std::size_t size , Mesh& mesh )
+	{
+		mesh = Mesh ( );
+
+		std::vector<const char*> bounds = split ( data , data + size );
+		long chunks = static_cast<long> ( bounds.size ( ) - 1 );
+
+		std::vector<ObjChunk> parts ( chunks );
+
+		#pragma omp parallel for schedule(dynamic, 1) if(chunks > 1)
+		for ( long c = 0; c < chunks; ++c )
+		{
+			parseObj ( bounds[c] , bounds[c + 1] , parts[c] );
+		}
+
+		// Where each chunk goes in the joined positions , texture coordinates , normals and corners.
+		std::vector<std::size_t> base[4];
+		for ( int s = 0; s < 4; ++s )
+		{
+			base[s].assign ( chunks + 1 , 0 );
+		}
+
+		bool present[3] = { true , false , false };
+		for ( long c = 0; c < chunks; ++c )
+		{
+			if ( parts[c].failed )
+			{
+				return false;
+			}
+
+			base[0][c + 1] = base[0][c] + parts[c].positions.size ( );
+			base[1][c + 1] = base[1][c] + parts[c].texCoords.size ( );
+			base[2][c + 1] = base[2][c] + parts[c].normals.size ( );
+			base[3][c + 1] = base[3][c] + parts[c].corners[0].size ( );
+			present[1] = present[1] || !parts[c].corners[1].empty ( );
+			present[2] = present[2] || !parts[c].corners[2].empty ( );
+		}
+
+		const std::size_t counts[3] = { base[0][chunks] , base[1][chunks] , base[2][chunks] };
+
+		std::vector<Vector2> texCoords ( counts[1] );
+		std::vector<Vector3> normals ( counts[2] );
+		std::vector<unsigned int> corners[3];
+
+		mesh.positions ( ).resize ( counts[0] );
+		for ( int s = 0; s < 3; ++s )
+		{
+			corners[s].resize ( present[s] ? base[3][chunks] : 0 );
+		}
+
+		std::vector<char> failed ( chunks , 0 );
+
+		#pragma omp parallel for schedule(dynamic, 1) if(chunks > 1)
+		for ( long c = 0; c < chunks; ++c )
+		{
+			ObjChunk& part = parts[c];
+
+			std::copy ( part.positions.begin ( ) , part.positions.end ( ) , mesh.positions ( ).begin ( ) + base[0][c] );
+			std::copy ( part.texCoords.begin ( ) , part.texCoords.end ( ) , texCoords.begin ( ) + base[1][c] );
+			std::copy ( part.normals.begin ( ) , part.normals.end ( ) , normals.begin ( ) + base[2][c] );
+
+			std::size_t count = part.corners[0].size ( );
+			for ( int s = 0; s < 3; ++s )
+			{
+				if ( !present[s] )
+				{
+					continue;
+				}
+
+				std::vector<unsigned int>& local = part.corners[s];
+				local.resize ( count , ~0u );
+				std::copy ( local.begin ( ) , local.end ( ) , corners[s].begin ( ) + base[3][c] );
+			}
+
+			for ( std::size_t i = 0; i < part.relative.size ( ); ++i )
+			{
+				const Relative& relative = part.relative[i];
+				long index = relative.value + static_cast<long> ( base[relative.stream][c] );
+				corners[relative.stream][base[3][c] + relative.slot] = ( index < 0 ) ? static_cast<unsigned int> ( counts[relative.stream] ) : static_cast<unsigned int> ( index );
+			}
+
+			// Positions are required , the other two may be missing.
+			for ( int s = 0; s < 3 && !failed[c]; ++s )
+			{
+				for ( std::size_t i = base[3][c]; present[s] && i < base[3][c + 1]; ++i )
+				{
+					if ( corners[s][i] >= counts[s] && ( s == 0 || corners[s][i] != ~0u ) )
+					{
+						failed[c] = 1;
+						break;
+					}
+				}
+			}
+
+			part.release ( );
+		}
+
+		if ( std::find ( failed.begin ( ) , failed.end ( ) , 1 ) != failed.end ( ) )
+		{
+			return false;
+		}
+
+		weld ( corners , texCoords , normals , mesh );
+		mesh.computeBounds ( );
+
+		return true;
+	}
+
+	template < class Real >
+	void MeshImporter<Real>::weld ( std::vector<unsigned int>* corners , const std::vector<Vector2>& texCoords , const std::vector<Vector3>& normals , Mesh& mesh )
+	{
+		std::vector<unsigned int>& indices = mesh.indices ( );
+
+		if ( corners[1].empty ( ) && corners[2].empty ( ) )
+		{
+			indices.swap ( corners[0] );
+			return;
+		}
+
+		const unsigned int kUnclaimed = ~0u - 1;
+		std::size_t vertexCount = mesh.positions ( ).size ( );
+		std::size_t cornerCount = corners[0].size ( );
+
+		// The first corner of a position gives it its attributes , a corner that disagrees needs a vertex of its own.
+		std::vector<unsigned int> claim[3];
+		claim[1].assign ( vertexCount , kUnclaimed );
+		claim[2].assign ( vertexCount , kUnclaimed );
+
+		std::vector<std::size_t> rest;
+		indices.resize ( cornerCount );
+		for ( std::size_t i = 0; i < cornerCount; ++i )
+		{
+			unsigned int v = corners[0][i];
+			unsigned int t = corners[1].empty ( ) ? ~0u : corners[1][i];
+			unsigned int n = corners[2].empty ( ) ? ~0u : corners[2][i];
+
+			if ( claim[1][v] == kUnclaimed )
+			{
+				claim[1][v] = t;
+				claim[2][v] = n;
+			}
+			else if ( claim[1][v] != t || claim[2][v] != n )
+			{
+				rest.push_back ( i );
+				continue;
+			}
+
+			indices[i] = v;
+		}
+
+		std::sort ( rest.begin ( ) , rest.end ( ) , CornerOrder ( corners ) );
+
+		std::vector<std::size_t> duplicates;
+		for ( std::size_t k = 0; k < rest.size ( ); ++k )
+		{
+			bool same = k > 0;
+			for ( int s = 0; s < 3 && same; ++s )
+			{
+				same = corners[s].empty ( ) || corners[s][rest[k - 1]] == corners[s][rest[k]];
+			}
+
+			if ( !same )
+			{
+				duplicates.push_back ( rest[k] );
+			}
+			indices[rest[k]] = static_cast<unsigned int> ( vertexCount + duplicates.size ( ) - 1 );
+		}
+
+		std::vector<Vector3>& positions = mesh.positions ( );
+		positions.resize ( vertexCount + duplicates.size ( ) );
+		for ( std::size_t k = 0; k < duplicates.size ( ); ++k )
+		{
+			positions[vertexCount + k] = positions[corners[0][duplicates[k]]];
+		}
+
+		// Texture coordinates , then normals , for the claimed vertices and then the duplicates.
+		if ( !corners[1].empty ( ) )
+		{
+			std::vector<Vector2>& stream = mesh.texCoords ( );
+			stream.resize ( positions.size ( ) );
+			for ( std::size_t v = 0; v < positions.size ( ); ++v )
+			{
+				unsigned int t = ( v < vertexCount ) ? claim[1][v] : corners[1][duplicates[v - vertexCount]];
+				stream[v] = ( t < texCoords.size ( ) ) ? texCoords[t] : Vector2 ( );
+			}
+		}
+
+		if ( !corners[2].empty ( ) )
+		{
+			std::vector<Vector3>& stream = mesh.normals ( );
+			stream.resize ( positions.size ( ) );
+			for ( std::size_t v = 0; v < positions.size ( ); ++v )
+			{
+				unsigned int n = ( v < vertexCount ) ? claim[2][v] : corners[2][duplicates[v - vertexCount]];
+				stream[v] = ( n < normals.size ( ) ) ? normals[n] : Vector3 ( );
+			}
+		}
+	}
+
+	template < class Real >
+	typename MeshImporter<Real>::Type MeshImporter<Real>::type ( const std::string& name )
+	{
+		static const char* names[][2] = { { "char" , "int8" } , { "uchar" , "uint8" } , { "short" , "int16" } , { "ushort" , "uint16" } ,
+		                                   { "int" , "int32" } , { "uint" , "uint32" } , { "float" , "float32" } , { "double" , "float64" } };
+
+		for ( int t = INT8; t < UNKNOWN; ++t )
+		{
+			if ( name == names[t][0] || name == names[t][1] )
+			{
+				return static_cast<Type> ( t );
+			}
+		}
+
+		return UNKNOWN;
+	}
+
+	template < class Real >
+	bool MeshImporter<Real>::parseHeader ( const char* data , const char* last , Header& header )
+	{
+		header.elements.clear ( );
+		header.body = 0;
+
+		bool formatSeen = false;
+		for ( const char* p = data; p < last; )
+		{
+			const char* next = Text::nextLine ( p , last );
+			std::istringstream line ( std::string ( p , next ) );
+			p = next;
+
+			std::string keyword;
+			line >> keyword;
+
+			if ( keyword == "format" )
+			{
+				std::string format;
+				line >> format;
+				formatSeen = true;
+				if ( format == "ascii" )
+				{
+					header.format = ASCII;
+				}
+				else if ( format == "binary_little_endian" )
+				{
+					header.format = BINARY_LITTLE_ENDIAN;
+				}
+				else if ( format == "binary_big_endian" )
+				{
+					header.format = BINARY_BIG_ENDIAN;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			else if ( keyword == "element" )
+			{
+				Element element;
+				if ( !( line >> element.name >> element.count ) )
+				{
+					return false;
+				}
+				header.elements.push_back ( element );
+			}
+			else if ( keyword == "property" )
+			{
+				if ( header.elements.empty ( ) )
+				{
+					return false;
+				}
+
+				Element& element = header.elements.back ( );
+				Property property = { UNKNOWN , UNKNOWN , SKIP };
+				std::string kind , name;
+				line >> kind;
+
+				if ( kind == "list" )
+				{
+					std::string countType , itemType;
+					line >> countType >> itemType;
+					property.countType = type ( countType );
+					property.type = type ( itemType );
+					if ( property.countType == UNKNOWN )
+					{
+						return false;
+					}
+				}
+				else
+				{
+					property.type = type ( kind );
+				}
+
+				line >> name;
+				if ( property.type == UNKNOWN || name.empty ( ) )
+				{
+					return false;
+				}
+
+				if ( element.name == "vertex" && property.countType == UNKNOWN )
+				{
+					static const char* names[] = { "" , "x" , "y" , "z" , "nx" , "ny" , "nz" , "u" , "v" };
+					for ( int t = X; t <= V; ++t )
+					{
+						property.target = ( name == names[t] ) ? static_cast<Target> ( t ) : property.target;
+					}
+					property.target = ( name == "s" || name == "texture_u" || name == "texture_s" ) ? U : property.target;
+					property.target = ( name == "t" || name == "texture_v" || name == "texture_t" ) ? V : property.target;
+				}
+				else if ( element.name == "face" && property.countType != UNKNOWN && ( name == "vertex_indices" || name == "vertex_index" ) )
+				{
+					property.target = VERTEX_INDICES;
+				}
+
+				element.properties.push_back ( property );
+			}
+			else if ( keyword == "end_header" )
+			{
+				header.body = p;
+				break;
+			}
+		}
+
+		header.vertex = header.face = header.elements.size ( );
+		for ( std::size_t e = 0; e < header.elements.size ( ); ++e )
+		{
+			header.vertex = ( header.elements[e].name == "vertex" ) ? e : header.vertex;
+			header.face = ( header.elements[e].name == "face" ) ? e : header.face;
+		}
+
+		return formatSeen && header.body != 0;
+	}
+
+	template < class Real >
+	bool MeshImporter<Real>::readPly ( const char* data , std::size_t size , Mesh& mesh )
+	{
+		mesh = Mesh ( );
+
+		Header header;
+		const char* last = data + size;
+		if ( size < 4 || std::memcmp ( data , "ply" , 3 ) != 0 || !parseHeader ( data , last , header ) )
+		{
+			return false;
+		}
+
+		// The counts must fit the body before anything is sized from them. The
+		// last ASCII value may go without its separator.
+		std::size_t body = static_cast<std::size_t> ( last - header.body ) + ( ( header.format == ASCII ) ? 1 : 0 );
+		for ( std::size_t e = 0; e < header.elements.size ( ); ++e )
+		{
+			std::size_t least = header.elements[e].least ( header.format );
+			if ( header.elements[e].count > body / least )
+			{
+				return false;
+			}
+			body -= header.elements[e].count * least;
+		}
+
+		if ( header.vertex < header.elements.size ( ) )
+		{
+			const Element& vertex = header.elements[header.vertex];
+
+			int seen[V + 1] = { 0 };
+			for ( std::size_t i = 0; i < vertex.properties.size ( ); ++i )
+			{
+				seen[vertex.properties[i].target] = 1;
+			}
+
+			if ( !seen[X] || !seen[Y] || !seen[Z] )
+			{
+				return false;
+			}
+
+			mesh.positions ( ).resize ( vertex.count );
+			if ( seen[NX] && seen[NY] && seen[NZ] )
+			{
+				mesh.normals ( ).resize ( vertex.count );
+			}
+			if ( seen[U] && seen[V] )
+			{
+				mesh.texCoords ( ).resize ( vertex.count );
+			}
+		}
+
+		bool ok = ( header.format == ASCII ) ? readPlyAscii ( header , header.body , last , mesh ) :
+		          readPlyBinary ( header , reinterpret_cast<const unsigned char*> ( header.body ) , reinterpret_cast<const unsigned char*> ( last ) , mesh );
+
+		mesh.computeBounds ( );
+
+		return ok;
+	}
+
+	template < class Real >
+	inline double MeshImporter<Real>::scalar ( const unsigned char* p , Type type , bool swap )
+	{
+		// What nearly every file holds , float coordinates , byte counts and int indices in the machine's order.
+		if ( !swap && type == FLOAT32 )
+		{
+			float v;
+			std::memcpy ( &v , p , 4 );
+			return v;
+		}
+		if ( !swap && type == UINT8 )
+		{
+			return *p;
+		}
+		if ( !swap && ( type == INT32 || type == UINT32 ) )
+		{
+			uint32_t v;
+			std::memcpy ( &v , p , 4 );
+			return ( type == INT32 ) ? static_cast<double> ( static_cast<int32_t> ( v ) ) : static_cast<double> ( v );
+		}
+
+		unsigned char bytes[8];
+		if ( swap )
+		{
+			std::size_t count = size ( type );
+			for ( std::size_t k = 0; k < count; ++k )
+			{
+				bytes[k] = p[count - 1 - k];
+			}
+			p = bytes;
+		}
+
+		switch ( type )
+		{
+			case INT8: { int8_t v; std::memcpy ( &v , p , 1 ); return v; }
+			case UINT8: { uint8_t v; std::memcpy ( &v , p , 1 ); return v; }
+			case INT16: { int16_t v; std::memcpy ( &v , p , 2 ); return v; }
+			case UINT16: { uint16_t v; std::memcpy ( &v , p , 2 ); return v; }
+			case INT32: { int32_t v; std::memcpy ( &v , p , 4 ); return v; }
+			case UINT32: { uint32_t v; std::memcpy ( &v , p , 4 ); return v; }
+			case FLOAT32: { float v; std::memcpy ( &v , p , 4 ); return v; }
+			case FLOAT64: { double v; std::memcpy ( &v , p , 8 ); return v; }
+			default: return 0.0;
+		}
+	}
+
+	template < class Real >
+	bool MeshImporter<Real>::readPlyBinary ( const Header& header , const unsigned char* p , const unsigned char* last , Mesh& mesh )
+	{
+		const bool swap = ( header.format == BINARY_BIG_ENDIAN ) == Text::Detail::littleEndian ( );
+		const std::size_t vertexCount = mesh.positions ( ).size ( );
+
+		for ( std::size_t e = 0; e < header.elements.size ( ); ++e )
+		{
+			const Element& element = header.elements[e];
+			const std::vector<Property>& properties = element.properties;
+			std::size_t stride = element.stride ( );
+			long blocks = static_cast<long> ( ( element.count + kBlock - 1 ) / kBlock );
+
+			if ( stride != 0 )
+			{
+				if ( element.count > static_cast<std::size_t> ( last - p ) / stride )
+				{
+					return false;
+				}
+
+				if ( e == header.vertex )
+				{
+					#pragma omp parallel for schedule(static) if(blocks > 1)
+					for ( long b = 0; b < blocks; ++b )
+					{
+						std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+						std::size_t end = std::min<std::size_t> ( first + kBlock , element.count );
+						for ( std::size_t i = first; i < end; ++i )
+						{
+							const unsigned char* q = p + i * stride;
+							for ( std::size_t k = 0; k < properties.size ( ); q += size ( properties[k].type ) , ++k )
+							{
+								if ( properties[k].target != SKIP )
+								{
+									assign ( properties[k].target , static_cast<Real> ( scalar ( q , properties[k].type , swap ) ) , i , mesh );
+								}
+							}
+						}
+					}
+				}
+
+				p += element.count * stride;
+				continue;
+			}
+
+			// Lists make the elements vary in size , walk them once to find each block and its first triangle.
+			std::vector<const unsigned char*> starts ( blocks + 1 , last );
+			std::vector<std::size_t> triangles ( blocks + 1 , 0 );
+			std::size_t triangleCount = 0;
+
+			for ( std::size_t i = 0; i < element.count; ++i )
+			{
+				if ( i % kBlock == 0 )
+				{
+					starts[i / kBlock] = p;
+					triangles[i / kBlock] = triangleCount;
+				}
+
+				for ( std::size_t k = 0; k < properties.size ( ); ++k )
+				{
+					std::size_t bytes = size ( properties[k].type );
+					if ( properties[k].countType != UNKNOWN )
+					{
+						std::size_t countBytes = size ( properties[k].countType );
+						if ( static_cast<std::size_t> ( last - p ) < countBytes )
+						{
+							return false;
+						}
+
+						double items = scalar ( p , properties[k].countType , swap );
+						if ( items < 0.0 )
+						{
+							return false;
+						}
+
+						std::size_t n = static_cast<std::size_t> ( items );
+						triangleCount += ( properties[k].target == VERTEX_INDICES && n > 2 ) ? n - 2 : 0;
+						p += countBytes;
+						bytes *= n;
+					}
+
+					if ( static_cast<std::size_t> ( last - p ) < bytes )
+					{
+						return false;
+					}
+					p += bytes;
+				}
+			}
+
+			if ( e != header.face )
+			{
+				continue;
+			}
+
+			std::vector<unsigned int>& indices = mesh.indices ( );
+			indices.resize ( triangleCount * 3 );
+			triangles[blocks] = triangleCount;
+
+			std::vector<char> failed ( blocks , 0 );
+
+			#pragma omp parallel for schedule(dynamic, 1) if(blocks > 1)
+			for ( long b = 0; b < blocks; ++b )
+			{
+				const unsigned char* q = starts[b];
+				unsigned int* target = indices.empty ( ) ? 0 : &indices[triangles[b] * 3];
+				std::vector<unsigned int> polygon;
+
+				std::size_t end = std::min<std::size_t> ( static_cast<std::size_t> ( b + 1 ) * kBlock , element.count );
+				for ( std::size_t i = static_cast<std::size_t> ( b ) * kBlock; i < end && !failed[b]; ++i )
+				{
+					for ( std::size_t k = 0; k < properties.size ( ); ++k )
+					{
+						std::size_t bytes = size ( properties[k].type );
+						if ( properties[k].countType == UNKNOWN )
+						{
+							q += bytes;
+							continue;
+						}
+
+						std::size_t n = static_cast<std::size_t> ( scalar ( q , properties[k].countType , swap ) );
+						q += size ( properties[k].countType );
+
+						if ( properties[k].target == VERTEX_INDICES )
+						{
+							polygon.resize ( n );
+							for ( std::size_t j = 0; j < n; ++j , q += bytes )
+							{
+								double index = scalar ( q , properties[k].type , swap );
+								polygon[j] = ( index < 0.0 ) ? ~0u : static_cast<unsigned int> ( index );
+							}
+
+							if ( !fan ( polygon , vertexCount , target ) )
+							{
+								failed[b] = 1;
+								break;
+							}
+							target += ( n > 2 ) ? 3 * ( n - 2 ) : 0;
+						}
+						else
+						{
+							q += n * bytes;
+						}
+					}
+				}
+			}
+
+			if ( std::find ( failed.begin ( ) , failed.end ( ) , 1 ) != failed.end ( ) )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template < class Real >
+	bool MeshImporter<Real>::readPlyAscii ( const Header& header , const char* first , const char* last , Mesh& mesh )
+	{
+		std::vector<const char*> bounds = split ( first , last );
+		long chunks = static_cast<long> ( bounds.size ( ) - 1 );
+
+		// Line each chunk starts at.
+		std::vector<std::size_t> lines ( chunks + 1 , 0 );
+
+		#pragma omp parallel for schedule(static) if(chunks > 1)
+		for ( long c = 0; c < chunks; ++c )
+		{
+			std::size_t count = 0;
+			for ( const char* p = bounds[c]; p != bounds[c + 1]; p = Text::nextLine ( p , bounds[c + 1] ) )
+			{
+				++count;
+			}
+			lines[c + 1] = count;
+		}
+
+		for ( long c = 0; c < chunks; ++c )
+		{
+			lines[c + 1] += lines[c];
+		}
+
+		// First line of each element , and one past the last.
+		std::vector<std::size_t> starts ( header.elements.size ( ) + 1 , 0 );
+		for ( std::size_t e = 0; e < header.elements.size ( ); ++e )
+		{
+			starts[e + 1] = starts[e] + header.elements[e].count;
+		}
+
+		if ( lines[chunks] < starts.back ( ) )
+		{
+			return false;
+		}
+
+		const std::size_t vertexCount = mesh.positions ( ).size ( );
+		std::vector<std::vector<unsigned int> > faces ( chunks );
+		std::vector<char> failed ( chunks , 0 );
+
+		#pragma omp parallel for schedule(dynamic, 1) if(chunks > 1)
+		for ( long c = 0; c < chunks; ++c )
+		{
+			std::vector<unsigned int> polygon;
+			std::size_t line = lines[c];
+			std::size_t e = static_cast<std::size_t> ( std::upper_bound ( starts.begin ( ) , starts.end ( ) , line ) - starts.begin ( ) ) - 1;
+
+			for ( const char* p = bounds[c]; p != bounds[c + 1] && line < starts.back ( ) && !failed[c]; ++line )
+			{
+				const char* next = Text::nextLine ( p , bounds[c + 1] );
+				while ( line >= starts[e + 1] )
+				{
+					++e;
+				}
+
+				const std::vector<Property>& properties = header.elements[e].properties;
+				for ( std::size_t k = 0; k < properties.size ( ) && p != 0; ++k )
+				{
+					if ( properties[k].countType == UNKNOWN )
+					{
+						Real value;
+						p = Text::parse ( Text::skipSpaces ( p , next ) , next , value );
+						if ( p != 0 && e == header.vertex && properties[k].target != SKIP )
+						{
+							assign ( properties[k].target , value , line - starts[e] , mesh );
+						}
+						continue;
+					}
+
+					long n = 0;
+					p = Text::parse ( Text::skipSpaces ( p , next ) , next , n );
+					polygon.clear ( );
+					for ( long j = 0; j < n && p != 0; ++j )
+					{
+						// Indices as integers , a float would round those past 2^24.
+						long index = 0;
+						Real skipped;
+						p = ( properties[k].target == VERTEX_INDICES ) ? Text::parse ( Text::skipSpaces ( p , next ) , next , index ) :
+						                                                  Text::parse ( Text::skipSpaces ( p , next ) , next , skipped );
+						polygon.push_back ( ( p == 0 || index < 0 ) ? ~0u : static_cast<unsigned int> ( index ) );
+					}
+
+					if ( p != 0 && e == header.face && properties[k].target == VERTEX_INDICES && polygon.size ( ) > 2 )
+					{
+						std::vector<unsigned int>& triangles = faces[c];
+						triangles.resize ( triangles.size ( ) + 3 * ( polygon.size ( ) - 2 ) );
+						p = fan ( polygon , vertexCount , &triangles[triangles.size ( ) - 3 * ( polygon.size ( ) - 2 )] ) ? p : 0;
+					}
+				}
+
+				failed[c] = ( p == 0 );
+				p = next;
+			}
+		}
+
+		if ( std::find ( failed.begin ( ) , failed.end ( ) , 1 ) != failed.end ( ) )
+		{
+			return false;
+		}
+
+		std::vector<std::size_t> offsets ( chunks + 1 , 0 );
+		for ( long c = 0; c < chunks; ++c )
+		{
+			offsets[c + 1] = offsets[c] + faces[c].size ( );
+		}
+
+		std::vector<unsigned int>& indices = mesh.indices ( );
+		indices.resize ( offsets[chunks] );
+
+		#pragma omp parallel for schedule(static) if(chunks > 1)
+		for ( long c = 0; c < chunks; ++c )
+		{
+			std::copy ( faces[c].begin ( ) , faces[c].end ( ) , indices.begin ( ) + offsets[c] );
+		}
+
+		return true;
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_MESHIMPORTER_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * MeshOptimizer.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Mesh/MeshOptimizer.hpp>
@@ -0,0 +1,495 @@
+#ifndef CELER_MESHOPTIMIZER_HPP_
+#define CELER_MESHOPTIMIZER_HPP_
+
+//- Celer/Core/Geometry/Mesh/MeshOptimizer.hpp - Index reordering passes ---//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Mesh Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the MeshOptimizer class , the
+//        triangle and vertex reordering passes run on indexed triangle lists
+//        before they are uploaded.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class MeshOptimizer.
+	 *@brief Reordering passes over indexed triangle lists.
+	 *@details The passes are meant to run in this order:
+	 * - optimizeVertexCache: Forsyth's greedy triangle order for the post
+	 *   transform cache. Vertices are scored by their position in a modeled
+	 *   LRU cache of kCacheSize entries and by how many triangles still use
+	 *   them , and the best scored triangle touching the cache goes next.
+	 * - optimizeOverdraw: splits the cache friendly order into clusters ,
+	 *   cutting only where the cache cost stays within threshold of the
+	 *   input , and sorts the clusters so the ones facing away from the mesh
+	 *   center are drawn first ( Sander , Nehab and Barczak ). Occluders then
+	 *   tend to come before what they hide.
+	 * - optimizeVertexFetch: renumbers vertices in the order the indices
+	 *   first use them , so the vertex streams are read front to back.
+	 *
+	 * analyzeVertexCache reports the cost on a FIFO cache , which is what the
+	 * hardware is closer to: ACMR , misses per triangle , between 0.5 and 3 ,
+	 * and ATVR , misses per vertex , 1 at best.
+	 *
+	 * Every pass accepts destination == indices.
+	 *
+	 * \code
+	 * Celer::MeshOptimizer<float>::optimizeVertexCache ( &indices[0] , &indices[0] , indices.size ( ) , positions.size ( ) );
+	 * Celer::MeshOptimizer<float>::Statistics s = Celer::MeshOptimizer<float>::analyzeVertexCache ( &indices[0] , indices.size ( ) , positions.size ( ) );
+	 * \endcode
+	 */
+	template < class Real >
+	class MeshOptimizer
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			struct Statistics
+			{
+				std::size_t 	misses;	///< Vertices transformed.
+				Real 		acmr;	///< Average cache miss ratio , misses per triangle.
+				Real 		atvr;	///< Average transform to vertex ratio , misses per vertex.
+			};
+
+			enum
+			{
+				kCacheSize = 32,	///< Entries of the LRU cache modeled by optimizeVertexCache.
+				kFifoSize = 16		///< Default FIFO size of analyzeVertexCache and optimizeOverdraw.
+			};
+
+			static Statistics analyzeVertexCache ( const unsigned int* indices , std::size_t indexCount , std::size_t vertexCount , unsigned int cacheSize = kFifoSize );
+
+			static void optimizeVertexCache ( unsigned int* destination , const unsigned int* indices , std::size_t indexCount , std::size_t vertexCount );
+
+			/// threshold is the ACMR increase allowed , 1.05 lets the cache cost grow by 5%.
+			static void optimizeOverdraw ( unsigned int* destination , const unsigned int* indices , std::size_t indexCount ,
+			                               const Vector3* positions , std::size_t vertexCount , Real threshold = static_cast<Real> ( 1.05 ) );
+
+			/*!@brief Renumbers vertices by first use and rewrites indices.
+			 * @details remap[old] is the new index , or ~0u for a vertex no
+			 * triangle uses.
+			 * @return Number of vertices in use.
+			 */
+			static std::size_t optimizeVertexFetch ( unsigned int* remap , unsigned int* indices , std::size_t indexCount , std::size_t vertexCount );
+
+			/// destination[remap[i]] = source[i] for the vertices in use.
+			template < class T >
+			static void remapVertices ( T* destination , const T* source , const unsigned int* remap , std::size_t vertexCount )
+			{
+				for ( std::size_t i = 0; i < vertexCount; ++i )
+				{
+					if ( remap[i] != ~0u )
+					{
+						destination[remap[i]] = source[i];
+					}
+				}
+			}
+
+		private:
+
+			/// FIFO cache model , a miss pushes the vertex and evicts the oldest.
+			class Fifo
+			{
+				public:
+
+					Fifo ( std::size_t vertexCount , unsigned int size ) : stamp_ ( vertexCount , 0 ) , size_ ( size ) , time_ ( size + 1 )
+					{
+					}
+
+					/// Number of misses caused by the triangle.
+					unsigned int insert ( const unsigned int* triangle )
+					{
+						unsigned int misses = 0;
+						for ( int k = 0; k < 3; ++k )
+						{
+							if ( time_ - stamp_[triangle[k]] > size_ )
+							{
+								stamp_[triangle[k]] = time_++;
+								++misses;
+							}
+						}
+						return misses;
+					}
+
+					void clear ( )
+					{
+						time_ += size_ + 1;
+					}
+
+				private:
+
+					std::vector<unsigned int> 	stamp_;
+					unsigned int 			size_;
+					unsigned int 			time_;
+			};
+
+			struct Cluster
+			{
+				std::size_t 	first;
+				std::size_t 	last;
+				Real 		key;
+
+				bool operator< ( const Cluster& other ) const
+				{
+					return key > other.key;
+				}
+			};
+
+			struct ScoreTable
+			{
+				Real score[kCacheSize];
+
+				ScoreTable ( )
+				{
+					for ( int i = 0; i < kCacheSize; ++i )
+					{
+						score[i] = ( i < 3 ) ? static_cast<Real> ( 0.75 )
+						                     : static_cast<Real> ( std::pow ( 1.0 - ( i - 3 ) / static_cast<double> ( kCacheSize - 3 ) , 1.5 ) );
+					}
+				}
+			};
+
+			static Real cacheScore ( int position )
+			{
+				// Built once , thread safe , meshes may be optimized in parallel.
+				static const ScoreTable table;
+
+				return ( position < 0 ) ? static_cast<Real> ( 0 ) : table.score[position];
+			}
+
+			/// Score of a vertex at a cache position , -1 in cache , with valence triangles left.
+			static Real vertexScore ( int position , unsigned int valence )
+			{
+				if ( valence == 0 )
+				{
+					return static_cast<Real> ( -1 );
+				}
+
+				return cacheScore ( position ) + static_cast<Real> ( 2.0 / std::sqrt ( static_cast<double> ( valence ) ) );
+			}
+	};
+
+	template < class Real >
+	typename MeshOptimizer<Real>::Statistics MeshOptimizer<Real>::analyzeVertexCache ( const unsigned int* indices , std::size_t indexCount , std::size_t vertexCount , unsigned int cacheSize )
+	{
+		Statistics statistics;
+		Fifo fifo ( vertexCount , cacheSize );
+
+		statistics.misses = 0;
+		for ( std::size_t i = 0; i + 3 <= indexCount; i += 3 )
+		{
+			statistics.misses += fifo.insert ( indices + i );
+		}
+
+		std::size_t triangles = indexCount / 3;
+		statistics.acmr = triangles ? static_cast<Real> ( statistics.misses ) / static_cast<Real> ( triangles ) : static_cast<Real> ( 0 );
+		statistics.atvr = vertexCount ? static_cast<Real> ( statistics.misses ) / static_cast<Real> ( vertexCount ) : static_cast<Real> ( 0 );
+
+		return statistics;
+	}
+
+	template < class Real >
+	void MeshOptimizer<Real>::optimizeVertexCache ( unsigned int* destination , const unsigned int* indices , std::size_t indexCount , std::size_t vertexCount )
+	{
+		std::size_t triangleCount = indexCount / 3;
+		if ( triangleCount == 0 )
+		{
+			return;
+		}
+
+		std::vector<unsigned int> source ( indices , indices + triangleCount * 3 );
+
+		/// Vertex to triangle adjacency , the live triangles of a vertex are the first valence[v] of its range.
+		std::vector<unsigned int> offset ( vertexCount + 1 , 0 );
+		std::vector<unsigned int> valence ( vertexCount , 0 );
+
+		for ( std::size_t i = 0; i < triangleCount * 3; ++i )
+		{
+			++valence[source[i]];
+		}
+		for ( std::size_t v = 0; v < vertexCount; ++v )
+		{
+			offset[v + 1] = offset[v] + valence[v];
+		}
+
+		std::vector<unsigned int> adjacency ( triangleCount * 3 );
+		std::vector<unsigned int> fill ( offset.begin ( ) , offset.end ( ) - 1 );
+
+		for ( std::size_t t = 0; t < triangleCount; ++t )
+		{
+			for ( int k = 0; k < 3; ++k )
+			{
+				adjacency[fill[source[t * 3 + k]]++] = static_cast<unsigned int> ( t );
+			}
+		}
+
+		std::vector<int> position ( vertexCount , -1 );
+		std::vector<Real> score ( vertexCount );
+		for ( std::size_t v = 0; v < vertexCount; ++v )
+		{
+			score[v] = vertexScore ( -1 , valence[v] );
+		}
+
+		std::vector<Real> triangleScore ( triangleCount );
+		std::vector<char> emitted ( triangleCount , 0 );
+		for ( std::size_t t = 0; t < triangleCount; ++t )
+		{
+			triangleScore[t] = score[source[t * 3]] + score[source[t * 3 + 1]] + score[source[t * 3 + 2]];
+		}
+
+		/// Three extra slots hold the vertices pushed out by the last triangle.
+		unsigned int cache[kCacheSize + 3];
+		unsigned int next[kCacheSize + 3];
+		int cacheCount = 0;
+
+		std::size_t cursor = 0;
+		std::size_t best = 0;
+		Real bestScore = triangleScore[0];
+		for ( std::size_t t = 1; t < triangleCount; ++t )
+		{
+			if ( triangleScore[t] > bestScore )
+			{
+				bestScore = triangleScore[t];
+				best = t;
+			}
+		}
+
+		for ( std::size_t output = 0; output < triangleCount; ++output )
+		{
+			/// Nothing in the cache touches a live triangle , take the next one in input order.
+			if ( best == triangleCount )
+			{
+				while ( emitted[cursor] )
+				{
+					++cursor;
+				}
+				best = cursor;
+			}
+
+			const unsigned int* triangle = &source[best * 3];
+			destination[output * 3] = triangle[0];
+			destination[output * 3 + 1] = triangle[1];
+			destination[output * 3 + 2] = triangle[2];
+			emitted[best] = 1;
+
+			/// Drop the triangle from the live list of its vertices.
+			for ( int k = 0; k < 3; ++k )
+			{
+				unsigned int v = triangle[k];
+				unsigned int* live = &adjacency[offset[v]];
+				for ( unsigned int j = 0; j < valence[v]; ++j )
+				{
+					if ( live[j] == best )
+					{
+						live[j] = live[valence[v] - 1];
+						break;
+					}
+				}
+				--valence[v];
+			}
+
+			/// Move the triangle to the front of the LRU cache.
+			int nextCount = 0;
+			for ( int k = 0; k < 3; ++k )
+			{
+				next[nextCount++] = triangle[k];
+			}
+			for ( int i = 0; i < cacheCount; ++i )
+			{
+				unsigned int v = cache[i];
+				if ( v != triangle[0] && v != triangle[1] && v != triangle[2] )
+				{
+					next[nextCount++] = v;
+				}
+			}
+
+			for ( int i = 0; i < nextCount; ++i )
+			{
+				position[next[i]] = ( i < kCacheSize ) ? i : -1;
+			}
+
+			/// Rescore the cache and pick the best triangle it touches.
+			best = triangleCount;
+			bestScore = static_cast<Real> ( -1 );
+
+			for ( int i = 0; i < nextCount; ++i )
+			{
+				unsigned int v = next[i];
+				Real updated = vertexScore ( position[v] , valence[v] );
+				Real delta = updated - score[v];
+				score[v] = updated;
+
+				const unsigned int* live = &adjacency[offset[v]];
+				for ( unsigned int j = 0; j < valence[v]; ++j )
+				{
+					unsigned int t = live[j];
+					triangleScore[t] += delta;
+					if ( triangleScore[t] > bestScore )
+					{
+						bestScore = triangleScore[t];
+						best = t;
+					}
+				}
+			}
+
+			cacheCount = std::min<int> ( nextCount , kCacheSize );
+			std::copy ( next , next + cacheCount , cache );
+		}
+	}
+
+	template < class Real >
+	void MeshOptimizer<Real>::optimizeOverdraw ( unsigned int* destination , const unsigned int* indices , std::size_t indexCount ,
+	                                             const Vector3* positions , std::size_t vertexCount , Real threshold )
+	{
+		std::size_t triangleCount = indexCount / 3;
+		if ( triangleCount == 0 )
+		{
+			return;
+		}
+
+		std::vector<unsigned int> source ( indices , indices + triangleCount * 3 );
+
+		/// Hard boundaries , where the cache starts cold and a cut costs nothing.
+		std::vector<std::size_t> hard;
+		{
+			Fifo fifo ( vertexCount , kFifoSize );
+			for ( std::size_t t = 0; t < triangleCount; ++t )
+			{
+				if ( fifo.insert ( &source[t * 3] ) == 3 )
+				{
+					hard.push_back ( t );
+				}
+			}
+			hard.push_back ( triangleCount );
+		}
+
+		/// Soft boundaries , cut a hard cluster whenever the part since the last cut is within threshold of its ACMR.
+		std::vector<Cluster> clusters;
+		{
+			Fifo fifo ( vertexCount , kFifoSize );
+			for ( std::size_t h = 0; h + 1 < hard.size ( ); ++h )
+			{
+				std::size_t first = hard[h];
+				std::size_t last = hard[h + 1];
+
+				fifo.clear ( );
+				std::size_t misses = 0;
+				for ( std::size_t t = first; t < last; ++t )
+				{
+					misses += fifo.insert ( &source[t * 3] );
+				}
+				Real limit = threshold * static_cast<Real> ( misses ) / static_cast<Real> ( last - first );
+
+				fifo.clear ( );
+				std::size_t start = first;
+				std::size_t running = 0;
+				for ( std::size_t t = first; t < last; ++t )
+				{
+					running += fifo.insert ( &source[t * 3] );
+					if ( t + 1 < last && static_cast<Real> ( running ) <= limit * static_cast<Real> ( t + 1 - start ) )
+					{
+						Cluster cluster = { start , t + 1 , static_cast<Real> ( 0 ) };
+						clusters.push_back ( cluster );
+						fifo.clear ( );
+						start = t + 1;
+						running = 0;
+					}
+				}
+				Cluster cluster = { start , last , static_cast<Real> ( 0 ) };
+				clusters.push_back ( cluster );
+			}
+		}
+
+		Vector3 center;
+		for ( std::size_t t = 0; t < triangleCount * 3; ++t )
+		{
+			center += positions[source[t]];
+		}
+		center = center / static_cast<Real> ( triangleCount * 3 );
+
+		/// Key of a cluster , how far its area weighted center lies along its normal from the mesh center.
+		long count = static_cast<long> ( clusters.size ( ) );
+
+		#pragma omp parallel for schedule(dynamic, 64)
+		for ( long c = 0; c < count; ++c )
+		{
+			Vector3 centroid;
+			Vector3 normal;
+			Real area = static_cast<Real> ( 0 );
+
+			for ( std::size_t t = clusters[c].first; t < clusters[c].last; ++t )
+			{
+				const Vector3& a = positions[source[t * 3]];
+				const Vector3& b = positions[source[t * 3 + 1]];
+				const Vector3& d = positions[source[t * 3 + 2]];
+
+				Vector3 n = ( b - a ) ^ ( d - a );
+				Real weight = std::sqrt ( n * n );
+
+				centroid += ( a + b + d ) * ( weight / static_cast<Real> ( 3 ) );
+				normal += n;
+				area += weight;
+			}
+
+			Real length = std::sqrt ( normal * normal );
+			if ( area > static_cast<Real> ( 0 ) && length > static_cast<Real> ( 0 ) )
+			{
+				clusters[c].key = ( ( centroid / area ) - center ) * ( normal / length );
+			}
+		}
+
+		std::stable_sort ( clusters.begin ( ) , clusters.end ( ) );
+
+		std::size_t output = 0;
+		for ( std::size_t c = 0; c < clusters.size ( ); ++c )
+		{
+			for ( std::size_t t = clusters[c].first; t < clusters[c].last; ++t )
+			{
+				destination[output++] = source[t * 3];
+				destination[output++] = source[t * 3 + 1];
+				destination[output++] = source[t * 3 + 2];
+			}
+		}
+	}
+
+	template < class Real >
+	std::size_t MeshOptimizer<Real>::optimizeVertexFetch ( unsigned int* remap , unsigned int* indices , std::size_t indexCount , std::size_t vertexCount )
+	{
+		std::fill ( remap , remap + vertexCount , ~0u );
+
+		unsigned int used = 0;
+		for ( std::size_t i = 0; i < indexCount; ++i )
+		{
+			unsigned int& index = remap[indices[i]];
+			if ( index == ~0u )
+			{
+				index = used++;
+			}
+			indices[i] = index;
+		}
+
+		return used;
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_MESHOPTIMIZER_HPP_ */
@@ -0,0 +1,664 @@
+#ifndef CELER_MESHLETS_HPP_
+#define CELER_MESHLETS_HPP_
+
+//- Celer/Core/Geometry/Mesh/Meshlets.hpp - Triangle clusters ---------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Mesh Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the Meshlets class which
+//        splits an indexed triangle list in small clusters and culls them
+//        against a view.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Vector4.hpp>
+#include <Celer/Core/Geometry/Math/Matrix4x4.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class Meshlets.
+	 *@brief Triangle clusters with bounds for culling below the object.
+	 *@details build ( ) grows one cluster at a time from a seed triangle.
+	 * Among the unused triangles sharing a vertex with the cluster it takes
+	 * the one that adds the fewest vertices , then the one whose normal is
+	 * closest to the cluster's and whose centroid is nearest , until the
+	 * cluster holds maxVertices vertices or maxTriangles triangles. When
+	 * nothing adjacent fits it goes on with the next unused triangle in index
+	 * order , if that one is near , or else closes the cluster and seeds the
+	 * next with it. An input already sorted for the vertex cache gives the
+	 * best clusters.
+	 *
+	 * A cluster lists its vertices , indices into the mesh vertex buffer ,
+	 * and its triangles as three byte wide indices into that list , the
+	 * layout mesh shaders read. Each cluster has a box , a sphere , and a
+	 * normal cone: apex , axis and cutoff. Every triangle faces away from a
+	 * viewer for whom dot ( normalize ( center - eye ) , axis ) >= cutoff +
+	 * radius / length ( center - eye ). A cone with cutoff 1 never culls.
+	 *
+	 * cull ( ) tests the spheres against the six planes of a View and the
+	 * cones against its eye , four clusters per SIMD::Float4 for float , and
+	 * writes one bit per cluster.
+	 *
+	 * \code
+	 * Celer::Meshlets<float> clusters;
+	 * clusters.build ( &indices[0] , indices.size ( ) , &positions[0] , positions.size ( ) );
+	 * Celer::Meshlets<float>::View view ( projection * modelView , eye );
+	 * std::vector<unsigned int> mask ( Celer::Meshlets<float>::words ( clusters.size ( ) ) );
+	 * std::size_t visible = clusters.cull ( view , &mask[0] );
+	 * \endcode
+	 */
+	template < class Real >
+	class Meshlets
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 		Vector3;
+			typedef Celer::Vector4<Real> 		Vector4;
+			typedef Celer::Matrix4x4<Real> 		Matrix4x4;
+			typedef Celer::BoundingBox3<Real> 	BoundingBox3;
+
+			enum
+			{
+				kMaxVertices = 64 ,
+				kMaxTriangles = 124
+			};
+
+			struct Meshlet
+			{
+				unsigned int vertexOffset;	///< First entry in vertices ( ).
+				unsigned int triangleOffset;	///< First entry in triangles ( ) , three per triangle.
+				unsigned int vertexCount;
+				unsigned int triangleCount;
+			};
+
+			struct Bounds
+			{
+				BoundingBox3 	box;
+				Vector3 	center;
+				Real 		radius;
+				Vector3 	coneApex;
+				Vector3 	coneAxis;
+				Real 		coneCutoff;
+			};
+
+			/// What the clusters are culled against , world space like the mesh.
+			struct View
+			{
+				Vector4 planes[6];	///< Inside where dot ( xyz , p ) + w >= 0 , xyz of unit length.
+				Vector3 eye;
+
+				/// Planes of the clip volume of projection * view , for column vectors.
+				View ( const Matrix4x4& projectionView , const Vector3& position ) : eye ( position )
+				{
+					for ( int i = 0; i < 3; ++i )
+					{
+						planes[2 * i] = projectionView[3] + projectionView[i];
+						planes[2 * i + 1] = projectionView[3] - projectionView[i];
+					}
+
+					for ( int i = 0; i < 6; ++i )
+					{
+						Real length = std::sqrt ( planes[i].x * planes[i].x + planes[i].y * planes[i].y + planes[i].z * planes[i].z );
+						if ( length > static_cast<Real> ( 0 ) )
+						{
+							planes[i] = planes[i] / length;
+						}
+					}
+				}
+			};
+
+			Meshlets ( )
+			{
+			}
+
+			/// Replaces the clusters with those of the given triangle list.
+			void build ( const unsigned int* indices , std::size_t indexCount , const Vector3* positions , std::size_t vertexCount ,
+			             unsigned int maxVertices = kMaxVertices , unsigned int maxTriangles = kMaxTriangles );
+
+			std::size_t size ( ) const
+			{
+				return meshlets_.size ( );
+			}
+
+			const std::vector<Meshlet>& meshlets ( ) const
+			{
+				return meshlets_;
+			}
+
+			const std::vector<unsigned int>& vertices ( ) const
+			{
+				return vertices_;
+			}
+
+			const std::vector<unsigned char>& triangles ( ) const
+			{
+				return triangles_;
+			}
+
+			const std::vector<Bounds>& bounds ( ) const
+			{
+				return bounds_;
+			}
+
+			/// Words of a mask for count clusters.
+			static std::size_t words ( std::size_t count )
+			{
+				return ( count + 31 ) / 32;
+			}
+
+			/*!@brief Visible clusters , cluster i in bit i % 32 of mask[i / 32].
+			 * @return Number of visible clusters.
+			 */
+			std::size_t cull ( const View& view , unsigned int* mask ) const;
+
+			/// Triangles of the clusters set in mask.
+			std::size_t triangleCount ( const unsigned int* mask ) const;
+
+		private:
+
+			enum
+			{
+				kBlock = 4096 	///< Clusters per thread task , a multiple of 32.
+			};
+
+			/// True where a cluster is inside every plane and not back facing.
+			template < class T >
+			static typename SIMD::Traits<T>::Mask visible ( const T center[3] , const T& radius , const T axis[3] , const T& cutoff ,
+			                                                const T planes[6][4] , const T eye[3] );
+
+			void bound ( std::size_t m , const Vector3* positions , const Vector3* normals );
+
+			std::size_t cullRange ( const View& view , std::size_t first , std::size_t last , unsigned int* mask ) const;
+
+			std::vector<Meshlet> 		meshlets_;
+			std::vector<unsigned int> 	vertices_;
+			std::vector<unsigned char> 	triangles_;
+			std::vector<Bounds> 		bounds_;
+
+			/// Sphere and cone of every cluster , one array per component , for the culling kernel.
+			std::vector<Real> 		cull_[8];
+	};
+
+	template < class Real >
+	template < class T >
+	typename SIMD::Traits<T>::Mask Meshlets<Real>::visible ( const T center[3] , const T& radius , const T axis[3] , const T& cutoff ,
+	                                                         const T planes[6][4] , const T eye[3] )
+	{
+		typename SIMD::Traits<T>::Mask inside = ( planes[0][0] * center[0] + planes[0][1] * center[1] + planes[0][2] * center[2] + planes[0][3] ) >= -radius;
+
+		for ( int i = 1; i < 6; ++i )
+		{
+			inside = inside & ( ( planes[i][0] * center[0] + planes[i][1] * center[1] + planes[i][2] * center[2] + planes[i][3] ) >= -radius );
+		}
+
+		T d[3] = { center[0] - eye[0] , center[1] - eye[1] , center[2] - eye[2] };
+		T length = SIMD::sqrt ( d[0] * d[0] + d[1] * d[1] + d[2] * d[2] );
+
+		return inside & ( ( d[0] * axis[0] + d[1] * axis[1] + d[2] * axis[2] ) < cutoff * length + radius );
+	}
+
+	template < class Real >
+	void Meshlets<Real>::build ( const unsigned int* indices , std::size_t indexCount , const Vector3* positions , std::size_t vertexCount ,
+	                             unsigned int maxVertices , unsigned int maxTriangles )
+	{
+		meshlets_.clear ( );
+		vertices_.clear ( );
+		triangles_.clear ( );
+
+		/// Local indices are bytes.
+		maxVertices = std::max ( 3u , std::min ( maxVertices , 256u ) );
+		maxTriangles = std::max ( 1u , maxTriangles );
+
+		std::size_t triangleCount = indexCount / 3;
+
+		/// Vertex to triangle adjacency.
+		std::vector<unsigned int> offset ( vertexCount + 1 , 0 );
+		for ( std::size_t i = 0; i < triangleCount * 3; ++i )
+		{
+			++offset[indices[i] + 1];
+		}
+		for ( std::size_t v = 0; v < vertexCount; ++v )
+		{
+			offset[v + 1] += offset[v];
+		}
+		std::vector<unsigned int> adjacency ( triangleCount * 3 );
+		{
+			std::vector<unsigned int> fill ( offset.begin ( ) , offset.end ( ) - 1 );
+			for ( std::size_t i = 0; i < triangleCount * 3; ++i )
+			{
+				adjacency[fill[indices[i]]++] = static_cast<unsigned int> ( i / 3 );
+			}
+		}
+
+		/// Unit normal and centroid of every triangle , and the mean edge length as the distance scale.
+		std::vector<Vector3> normal ( triangleCount );
+		std::vector<Vector3> centroid ( triangleCount );
+		double edges = 0.0;
+		long count = static_cast<long> ( triangleCount );
+
+		#pragma omp parallel for schedule(static) reduction(+:edges)
+		for ( long t = 0; t < count; ++t )
+		{
+			const Vector3& a = positions[indices[t * 3]];
+			const Vector3& b = positions[indices[t * 3 + 1]];
+			const Vector3& c = positions[indices[t * 3 + 2]];
+
+			Vector3 n = ( b - a ) ^ ( c - a );
+			Real length = std::sqrt ( n * n );
+
+			normal[t] = ( length > static_cast<Real> ( 0 ) ) ? n / length : n;
+			centroid[t] = ( a + b + c ) / static_cast<Real> ( 3 );
+			edges += std::sqrt ( static_cast<double> ( ( b - a ) * ( b - a ) ) );
+		}
+
+		Real scale = triangleCount ? static_cast<Real> ( 4.0 * edges / triangleCount ) : static_cast<Real> ( 1 );
+		if ( !( scale > static_cast<Real> ( 0 ) ) )
+		{
+			scale = static_cast<Real> ( 1 );
+		}
+
+		std::vector<char> used ( triangleCount , 0 );
+		std::vector<unsigned int> local ( vertexCount , ~0u );
+
+		Meshlet current = { 0 , 0 , 0 , 0 };
+		Vector3 centerSum;
+		Vector3 normalSum;
+		std::size_t cursor = 0;
+
+		for ( std::size_t emitted = 0; emitted < triangleCount; ++emitted )
+		{
+			std::size_t best = triangleCount;
+			Real bestScore = std::numeric_limits<Real>::max ( );
+
+			if ( current.triangleCount > 0 )
+			{
+				Vector3 center = centerSum / static_cast<Real> ( current.triangleCount );
+				Real length = std::sqrt ( normalSum * normalSum );
+				Vector3 axis = ( length > static_cast<Real> ( 0 ) ) ? normalSum / length : normalSum;
+
+				for ( unsigned int i = 0; i < current.vertexCount; ++i )
+				{
+					unsigned int v = vertices_[current.vertexOffset + i];
+					for ( unsigned int j = offset[v]; j < offset[v + 1]; ++j )
+					{
+						unsigned int t = adjacency[j];
+						if ( used[t] )
+						{
+							continue;
+						}
+
+						unsigned int extra = ( local[indices[t * 3]] == ~0u ) + ( local[indices[t * 3 + 1]] == ~0u ) + ( local[indices[t * 3 + 2]] == ~0u );
+						if ( current.vertexCount + extra > maxVertices )
+						{
+							continue;
+						}
+
+						Vector3 d = centroid[t] - center;
+						Real distance = std::sqrt ( d * d );
+						Real score = static_cast<Real> ( extra ) + static_cast<Real> ( 0.5 ) * ( static_cast<Real> ( 1 ) - normal[t] * axis ) +
+						             distance / ( distance + scale );
+
+						if ( score < bestScore || ( score == bestScore && t < best ) )
+						{
+							bestScore = score;
+							best = t;
+						}
+					}
+				}
+			}
+
+			/// Nothing adjacent fits , go on with the next unused triangle in index order if it fits and is near.
+			if ( best == triangleCount )
+			{
+				while ( used[cursor] )
+				{
+					++cursor;
+				}
+
+				bool near = false;
+				if ( current.triangleCount > 0 )
+				{
+					unsigned int extra = ( local[indices[cursor * 3]] == ~0u ) + ( local[indices[cursor * 3 + 1]] == ~0u ) + ( local[indices[cursor * 3 + 2]] == ~0u );
+					Vector3 d = centroid[cursor] - centerSum / static_cast<Real> ( current.triangleCount );
+					near = ( current.vertexCount + extra <= maxVertices ) && ( d * d <= scale * scale );
+				}
+
+				if ( current.triangleCount > 0 && !near )
+				{
+					for ( unsigned int i = 0; i < current.vertexCount; ++i )
+					{
+						local[vertices_[current.vertexOffset + i]] = ~0u;
+					}
+					meshlets_.push_back ( current );
+
+					current.vertexOffset = static_cast<unsigned int> ( vertices_.size ( ) );
+					current.triangleOffset = static_cast<unsigned int> ( triangles_.size ( ) );
+					current.vertexCount = 0;
+					current.triangleCount = 0;
+					centerSum = Vector3 ( );
+					normalSum = Vector3 ( );
+				}
+
+				best = cursor;
+			}
+
+			used[best] = 1;
+			for ( int k = 0; k < 3; ++k )
+			{
+				unsigned int v = indices[best * 3 + k];
+				if ( local[v] == ~0u )
+				{
+					local[v] = current.vertexCount++;
+					vertices_.push_back ( v );
+				}
+				triangles_.push_back ( static_cast<unsigned char> ( local[v] ) );
+			}
+			++current.triangleCount;
+			centerSum += centroid[best];
+			normalSum += normal[best];
+
+			if ( current.triangleCount == maxTriangles )
+			{
+				for ( unsigned int i = 0; i < current.vertexCount; ++i )
+				{
+					local[vertices_[current.vertexOffset + i]] = ~0u;
+				}
+				meshlets_.push_back ( current );
+
+				current.vertexOffset = static_cast<unsigned int> ( vertices_.size ( ) );
+				current.triangleOffset = static_cast<unsigned int> ( triangles_.size ( ) );
+				current.vertexCount = 0;
+				current.triangleCount = 0;
+				centerSum = Vector3 ( );
+				normalSum = Vector3 ( );
+			}
+		}
+
+		if ( current.triangleCount > 0 )
+		{
+			meshlets_.push_back ( current );
+		}
+
+		/// Bounds , one cluster per iteration.
+		std::size_t size = meshlets_.size ( );
+		bounds_.resize ( size );
+
+		std::size_t padded = ( size + 3 ) & ~static_cast<std::size_t> ( 3 );
+		for ( int k = 0; k < 8; ++k )
+		{
+			cull_[k].assign ( padded , static_cast<Real> ( 0 ) );
+		}
+
+		std::vector<Vector3> normals ( triangles_.size ( ) / 3 );
+		for ( std::size_t m = 0; m < size; ++m )
+		{
+			const Meshlet& meshlet = meshlets_[m];
+			for ( unsigned int i = 0; i < meshlet.triangleCount; ++i )
+			{
+				const unsigned char* q = &triangles_[meshlet.triangleOffset + i * 3];
+				const Vector3& a = positions[vertices_[meshlet.vertexOffset + q[0]]];
+				const Vector3& b = positions[vertices_[meshlet.vertexOffset + q[1]]];
+				const Vector3& c = positions[vertices_[meshlet.vertexOffset + q[2]]];
+
+				Vector3 n = ( b - a ) ^ ( c - a );
+				Real length = std::sqrt ( n * n );
+				normals[meshlet.triangleOffset / 3 + i] = ( length > static_cast<Real> ( 0 ) ) ? n / length : n;
+			}
+		}
+
+		long clusters = static_cast<long> ( size );
+
+		#pragma omp parallel for schedule(static)
+		for ( long m = 0; m < clusters; ++m )
+		{
+			bound ( m , positions , &normals[0] );
+		}
+	}
+
+	template < class Real >
+	void Meshlets<Real>::bound ( std::size_t m , const Vector3* positions , const Vector3* normals )
+	{
+		const Meshlet& meshlet = meshlets_[m];
+		Bounds& bounds = bounds_[m];
+		const unsigned int* vertex = &vertices_[meshlet.vertexOffset];
+
+		bounds.box = BoundingBox3 ( );
+		for ( unsigned int i = 0; i < meshlet.vertexCount; ++i )
+		{
+			bounds.box += positions[vertex[i]];
+		}
+
+		/// Ritter's sphere , from a far apart pair , grown to take every vertex.
+		const Vector3& first = positions[vertex[0]];
+		unsigned int a = 0;
+		Real farthest = static_cast<Real> ( -1 );
+		for ( unsigned int i = 0; i < meshlet.vertexCount; ++i )
+		{
+			Vector3 d = positions[vertex[i]] - first;
+			if ( d * d > farthest )
+			{
+				farthest = d * d;
+				a = i;
+			}
+		}
+
+		unsigned int b = a;
+		farthest = static_cast<Real> ( -1 );
+		for ( unsigned int i = 0; i < meshlet.vertexCount; ++i )
+		{
+			Vector3 d = positions[vertex[i]] - positions[vertex[a]];
+			if ( d * d > farthest )
+			{
+				farthest = d * d;
+				b = i;
+			}
+		}
+
+		Vector3 center = ( positions[vertex[a]] + positions[vertex[b]] ) * static_cast<Real> ( 0.5 );
+		Real radius = std::sqrt ( farthest ) * static_cast<Real> ( 0.5 );
+
+		for ( unsigned int i = 0; i < meshlet.vertexCount; ++i )
+		{
+			Vector3 d = positions[vertex[i]] - center;
+			Real distance = std::sqrt ( d * d );
+			if ( distance > radius )
+			{
+				Real grown = ( radius + distance ) * static_cast<Real> ( 0.5 );
+				center += d * ( ( grown - radius ) / distance );
+				radius = grown;
+			}
+		}
+
+		/// The growing steps round , the radius is taken again from the final center.
+		radius = static_cast<Real> ( 0 );
+		for ( unsigned int i = 0; i < meshlet.vertexCount; ++i )
+		{
+			Vector3 d = positions[vertex[i]] - center;
+			radius = std::max ( radius , d * d );
+		}
+		radius = std::sqrt ( radius );
+
+		bounds.center = center;
+		bounds.radius = radius;
+
+		/// Normal cone , around the mean normal , opening to the normal farthest from it.
+		const Vector3* normal = normals + meshlet.triangleOffset / 3;
+		Vector3 axis;
+		for ( unsigned int i = 0; i < meshlet.triangleCount; ++i )
+		{
+			axis += normal[i];
+		}
+		Real length = std::sqrt ( axis * axis );
+		axis = ( length > static_cast<Real> ( 0 ) ) ? axis / length : axis;
+
+		Real spread = static_cast<Real> ( 1 );
+		for ( unsigned int i = 0; i < meshlet.triangleCount; ++i )
+		{
+			spread = std::min ( spread , normal[i] * axis );
+		}
+
+		bounds.coneAxis = axis;
+		bounds.coneApex = center;
+		bounds.coneCutoff = static_cast<Real> ( 1 );
+
+		/// Wider than about 84 degrees the cone would hardly ever cull.
+		if ( spread > static_cast<Real> ( 0.1 ) )
+		{
+			Real reach = static_cast<Real> ( 0 );
+			for ( unsigned int i = 0; i < meshlet.triangleCount; ++i )
+			{
+				const Vector3& p = positions[vertex[triangles_[meshlet.triangleOffset + i * 3]]];
+				Real along = ( ( center - p ) * normal[i] ) / ( axis * normal[i] );
+				reach = std::max ( reach , along );
+			}
+
+			bounds.coneApex = center - axis * reach;
+			bounds.coneCutoff = std::sqrt ( static_cast<Real> ( 1 ) - spread * spread );
+		}
+
+		cull_[0][m] = center.x;
+		cull_[1][m] = center.y;
+		cull_[2][m] = center.z;
+		cull_[3][m] = radius;
+		cull_[4][m] = bounds.coneAxis.x;
+		cull_[5][m] = bounds.coneAxis.y;
+		cull_[6][m] = bounds.coneAxis.z;
+		cull_[7][m] = bounds.coneCutoff;
+	}
+
+	template < class Real >
+	std::size_t Meshlets<Real>::cullRange ( const View& view , std::size_t first , std::size_t last , unsigned int* mask ) const
+	{
+		Real planes[6][4];
+		for ( int i = 0; i < 6; ++i )
+		{
+			planes[i][0] = view.planes[i].x;
+			planes[i][1] = view.planes[i].y;
+			planes[i][2] = view.planes[i].z;
+			planes[i][3] = view.planes[i].w;
+		}
+		Real eye[3] = { view.eye.x , view.eye.y , view.eye.z };
+
+		std::size_t count = 0;
+
+		for ( std::size_t w = first; w < last; w += 32 )
+		{
+			std::size_t end = std::min<std::size_t> ( w + 32 , last );
+			unsigned int word = 0;
+
+			for ( std::size_t m = w; m < end; ++m )
+			{
+				Real center[3] = { cull_[0][m] , cull_[1][m] , cull_[2][m] };
+				Real axis[3] = { cull_[4][m] , cull_[5][m] , cull_[6][m] };
+
+				if ( visible<Real> ( center , cull_[3][m] , axis , cull_[7][m] , planes , eye ) )
+				{
+					word |= 1u << ( m - w );
+					++count;
+				}
+			}
+			mask[w / 32] = word;
+		}
+
+		return count;
+	}
+
+	template < >
+	inline std::size_t Meshlets<float>::cullRange ( const View& view , std::size_t first , std::size_t last , unsigned int* mask ) const
+	{
+		SIMD::Float4 planes[6][4];
+		for ( int i = 0; i < 6; ++i )
+		{
+			planes[i][0] = SIMD::Float4 ( view.planes[i].x );
+			planes[i][1] = SIMD::Float4 ( view.planes[i].y );
+			planes[i][2] = SIMD::Float4 ( view.planes[i].z );
+			planes[i][3] = SIMD::Float4 ( view.planes[i].w );
+		}
+		SIMD::Float4 eye[3] = { SIMD::Float4 ( view.eye.x ) , SIMD::Float4 ( view.eye.y ) , SIMD::Float4 ( view.eye.z ) };
+
+		std::size_t count = 0;
+
+		/// The arrays are padded to four , the lanes past last are masked off.
+		for ( std::size_t w = first; w < last; w += 32 )
+		{
+			std::size_t end = std::min<std::size_t> ( w + 32 , last );
+			unsigned int word = 0;
+
+			for ( std::size_t m = w; m < end; m += 4 )
+			{
+				SIMD::Float4 center[3] = { SIMD::Float4::load ( &cull_[0][m] ) , SIMD::Float4::load ( &cull_[1][m] ) , SIMD::Float4::load ( &cull_[2][m] ) };
+				SIMD::Float4 axis[3] = { SIMD::Float4::load ( &cull_[4][m] ) , SIMD::Float4::load ( &cull_[5][m] ) , SIMD::Float4::load ( &cull_[6][m] ) };
+
+				unsigned int bits = static_cast<unsigned int> ( visible<SIMD::Float4> ( center , SIMD::Float4::load ( &cull_[3][m] ) , axis ,
+				                                                                        SIMD::Float4::load ( &cull_[7][m] ) , planes , eye ).bits ( ) );
+				if ( end - m < 4 )
+				{
+					bits &= ( 1u << ( end - m ) ) - 1u;
+				}
+				word |= bits << ( m - w );
+			}
+
+			mask[w / 32] = word;
+			for ( unsigned int v = word; v; v &= v - 1 )
+			{
+				++count;
+			}
+		}
+
+		return count;
+	}
+
+	template < class Real >
+	std::size_t Meshlets<Real>::cull ( const View& view , unsigned int* mask ) const
+	{
+		std::size_t size = meshlets_.size ( );
+		long blocks = static_cast<long> ( ( size + kBlock - 1 ) / kBlock );
+		long total = 0;
+
+		#pragma omp parallel for schedule(static) reduction(+:total) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , size );
+			total += static_cast<long> ( cullRange ( view , first , last , mask ) );
+		}
+
+		return static_cast<std::size_t> ( total );
+	}
+
+	template < class Real >
+	std::size_t Meshlets<Real>::triangleCount ( const unsigned int* mask ) const
+	{
+		std::size_t count = 0;
+		for ( std::size_t m = 0; m < meshlets_.size ( ); ++m )
+		{
+			if ( mask[m / 32] >> ( m % 32 ) & 1u )
+			{
+				count += meshlets_[m].triangleCount;
+			}
+		}
+		return count;
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_MESHLETS_HPP_ */
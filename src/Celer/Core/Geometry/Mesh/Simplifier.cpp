@@ -0,0 +1,7 @@
+/*
+ * Simplifier.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/Mesh/Simplifier.hpp>
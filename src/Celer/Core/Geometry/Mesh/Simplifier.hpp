@@ -0,0 +1,731 @@
+#ifndef CELER_SIMPLIFIER_HPP_
+#define CELER_SIMPLIFIER_HPP_
+
+//- Celer/Core/Geometry/Mesh/Simplifier.hpp - Quadric error simplification -//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Mesh Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the Simplifier class which
+//        builds level of detail chains by quadric error edge collapses.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+/// Celer Library
+#include <Celer/Base/Parallel.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class Simplifier.
+	 *@brief Level of detail chains by quadric error edge collapses.
+	 *@details Garland and Heckbert's simplification with half edge
+	 * collapses: a vertex is merged into one of its neighbours and never
+	 * moves , so every level indexes the input vertex buffer and a chain
+	 * costs only its index buffers.
+	 *
+	 * Each vertex sums the area weighted plane quadrics of its faces , in the
+	 * compact symmetric form of ten doubles , plus planes through its border
+	 * edges that keep open borders in place. Candidate collapses sit in a
+	 * binary heap keyed by the quadric error. When a collapse changes the
+	 * quadric of a vertex its stamp is bumped and its edges pushed again ,
+	 * older entries are dropped when they surface. A collapse is refused if
+	 * it folds a face over , breaks the link condition , or pulls a border
+	 * vertex off the border.
+	 *
+	 * All levels come out of one run: the collapses go on from the finest
+	 * target to the coarsest and the index buffer is copied out as each
+	 * target is reached.
+	 *
+	 * Large inputs are cut in a grid of partitions by triangle centroid ,
+	 * the vertices shared by two partitions are locked , and the partitions
+	 * are simplified in parallel as long as each keeps at least
+	 * kPartitionTail triangles. The coarser levels continue from the joined
+	 * partitions with nothing locked , so no seam is left at the end.
+	 *
+	 * Only positions are looked at. Vertices split on texture or normal
+	 * seams are separate vertices , their seams are treated as borders.
+	 *
+	 * \code
+	 * std::vector<Celer::Simplifier<float>::Level> levels;
+	 * Celer::Simplifier<float>::chain ( &indices[0] , indices.size ( ) , &positions[0] , positions.size ( ) , levels );
+	 * \endcode
+	 */
+	template < class Real >
+	class Simplifier
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 		Vector3;
+			typedef Celer::BoundingBox3<Real> 	BoundingBox3;
+
+			struct Level
+			{
+				std::vector<unsigned int> 	indices;
+				Real 				error;	///< Largest quadric error of the collapses so far.
+			};
+
+			/// Symmetric 4x4 quadric , the upper triangle row by row.
+			struct Quadric
+			{
+				double a[10];
+
+				Quadric ( )
+				{
+					std::fill ( a , a + 10 , 0.0 );
+				}
+
+				/// weight times the squared distance to the plane n . p + d = 0 , n of unit length.
+				Quadric ( double nx , double ny , double nz , double d , double weight )
+				{
+					a[0] = weight * nx * nx;
+					a[1] = weight * nx * ny;
+					a[2] = weight * nx * nz;
+					a[3] = weight * nx * d;
+					a[4] = weight * ny * ny;
+					a[5] = weight * ny * nz;
+					a[6] = weight * ny * d;
+					a[7] = weight * nz * nz;
+					a[8] = weight * nz * d;
+					a[9] = weight * d * d;
+				}
+
+				Quadric& operator+= ( const Quadric& q )
+				{
+					for ( int i = 0; i < 10; ++i )
+					{
+						a[i] += q.a[i];
+					}
+					return *this;
+				}
+
+				double evaluate ( const Vector3& p ) const
+				{
+					double x = p.x;
+					double y = p.y;
+					double z = p.z;
+
+					return a[0] * x * x + 2.0 * a[1] * x * y + 2.0 * a[2] * x * z + 2.0 * a[3] * x +
+					       a[4] * y * y + 2.0 * a[5] * y * z + 2.0 * a[6] * y +
+					       a[7] * z * z + 2.0 * a[8] * z + a[9];
+				}
+			};
+
+			enum
+			{
+				kPartitionTail = 4096 	///< Fewest triangles a partition is taken down to.
+			};
+
+			/*!@brief One level per target triangle count.
+			 * @details targets go from fine to coarse. A level may keep more
+			 * triangles than its target when no collapse is left.
+			 */
+			static void simplify ( const unsigned int* indices , std::size_t indexCount , const Vector3* positions , std::size_t vertexCount ,
+			                       const std::vector<std::size_t>& targets , std::vector<Level>& levels );
+
+			/// Levels of ratio times the triangles of the one before , down to minimum triangles.
+			static void chain ( const unsigned int* indices , std::size_t indexCount , const Vector3* positions , std::size_t vertexCount ,
+			                    std::vector<Level>& levels , Real ratio = static_cast<Real> ( 0.5 ) , std::size_t minimum = 64 );
+
+		private:
+
+			/// Collapses over one set of triangles , vertices keep their global index.
+			class Collapser
+			{
+				public:
+
+					Collapser ( const unsigned int* triangles , std::size_t triangleCount , const Vector3* positions , const std::vector<char>* locked );
+
+					/// Collapses down to each target , copying the triangles out into levels[first + i].
+					void run ( const std::vector<std::size_t>& targets , std::vector<Level>& levels , std::size_t first );
+
+				private:
+
+					/// Smallest cosine between the normal of a face and the one it had in the input.
+					static const double kFold;
+
+					/// Smallest squared area over squared perimeter , loosely , a face may be left with.
+					static const double kSliver;
+
+					struct Candidate
+					{
+						double 		cost;
+						double 		length;	///< Squared edge length , shorter edges go first on equal cost.
+						unsigned int 	from;
+						unsigned int 	to;
+						unsigned int 	stampFrom;
+						unsigned int 	stampTo;
+
+						/// Cheapest on top of std::priority_queue , then shortest , then by vertex.
+						bool operator< ( const Candidate& other ) const
+						{
+							if ( cost != other.cost )
+							{
+								return cost > other.cost;
+							}
+							if ( length != other.length )
+							{
+								return length > other.length;
+							}
+							return ( from != other.from ) ? from > other.from : to > other.to;
+						}
+					};
+
+					void push ( unsigned int from , unsigned int to );
+
+					/// Neighbours of local vertex v through its live triangles , marked with mark.
+					void neighbours ( unsigned int v , std::vector<unsigned int>& list , unsigned int mark );
+
+					bool allowed ( unsigned int from , unsigned int to );
+
+					void collapse ( unsigned int from , unsigned int to );
+
+					void output ( Level& level ) const;
+
+					const Vector3* 				positions_;
+
+					std::vector<unsigned int> 		global_;	///< Local to global vertex.
+					std::vector<unsigned int> 		triangles_;	///< Local vertices.
+					std::vector<char> 			live_;
+					std::vector<Vector3> 			origin_;	///< Unit normal of each triangle in the input.
+					std::size_t 				liveCount_;
+
+					std::vector<std::vector<unsigned int> > adjacency_;	///< Triangles of each vertex , dead ones dropped lazily.
+					std::vector<Quadric> 			quadric_;
+					std::vector<unsigned int> 		stamp_;
+					std::vector<char> 			removed_;
+					std::vector<char> 			border_;
+					std::vector<char> 			locked_;
+					std::vector<unsigned int> 		mark_;
+					std::vector<unsigned int> 		scratch_;
+					unsigned int 				time_;
+
+					std::priority_queue<Candidate> 		heap_;
+					double 					error_;
+			};
+	};
+
+	template < class Real >
+	const double Simplifier<Real>::Collapser::kFold = 0.2;
+
+	template < class Real >
+	const double Simplifier<Real>::Collapser::kSliver = 1e-8;
+
+	template < class Real >
+	Simplifier<Real>::Collapser::Collapser ( const unsigned int* triangles , std::size_t triangleCount , const Vector3* positions , const std::vector<char>* locked )
+		: positions_ ( positions ) , liveCount_ ( triangleCount ) , time_ ( 0 ) , error_ ( 0.0 )
+	{
+		/// Local numbering , the sorted global indices in use.
+		global_.assign ( triangles , triangles + triangleCount * 3 );
+		std::sort ( global_.begin ( ) , global_.end ( ) );
+		global_.erase ( std::unique ( global_.begin ( ) , global_.end ( ) ) , global_.end ( ) );
+
+		std::size_t vertexCount = global_.size ( );
+
+		triangles_.resize ( triangleCount * 3 );
+		for ( std::size_t i = 0; i < triangleCount * 3; ++i )
+		{
+			triangles_[i] = static_cast<unsigned int> ( std::lower_bound ( global_.begin ( ) , global_.end ( ) , triangles[i] ) - global_.begin ( ) );
+		}
+
+		live_.assign ( triangleCount , 1 );
+		origin_.resize ( triangleCount );
+		adjacency_.resize ( vertexCount );
+		quadric_.resize ( vertexCount );
+		stamp_.assign ( vertexCount , 0 );
+		removed_.assign ( vertexCount , 0 );
+		border_.assign ( vertexCount , 0 );
+		locked_.assign ( vertexCount , 0 );
+		mark_.assign ( vertexCount , 0 );
+
+		if ( locked )
+		{
+			for ( std::size_t v = 0; v < vertexCount; ++v )
+			{
+				locked_[v] = ( *locked )[global_[v]];
+			}
+		}
+
+		for ( std::size_t t = 0; t < triangleCount; ++t )
+		{
+			const unsigned int* q = &triangles_[t * 3];
+			const Vector3& p0 = positions_[global_[q[0]]];
+
+			Vector3 n = ( positions_[global_[q[1]]] - p0 ) ^ ( positions_[global_[q[2]]] - p0 );
+			double area = std::sqrt ( static_cast<double> ( n * n ) );
+
+			if ( area > 0.0 )
+			{
+				origin_[t] = n / static_cast<Real> ( area );
+
+				double nx = n.x / area;
+				double ny = n.y / area;
+				double nz = n.z / area;
+				Quadric plane ( nx , ny , nz , - ( nx * p0.x + ny * p0.y + nz * p0.z ) , 0.5 * area );
+
+				for ( int k = 0; k < 3; ++k )
+				{
+					quadric_[q[k]] += plane;
+				}
+			}
+
+			for ( int k = 0; k < 3; ++k )
+			{
+				adjacency_[q[k]].push_back ( static_cast<unsigned int> ( t ) );
+			}
+		}
+
+		/// Edges as ( low , high , triangle , corner ) , sorted so that the copies of an edge are next to each other.
+		std::vector<unsigned long long> edges;
+		edges.reserve ( triangleCount * 3 );
+		for ( std::size_t t = 0; t < triangleCount; ++t )
+		{
+			for ( int k = 0; k < 3; ++k )
+			{
+				unsigned long long a = triangles_[t * 3 + k];
+				unsigned long long b = triangles_[t * 3 + ( k + 1 ) % 3];
+				edges.push_back ( ( std::min ( a , b ) << 32 ) | std::max ( a , b ) );
+			}
+		}
+		std::vector<unsigned long long> sorted ( edges );
+		std::sort ( sorted.begin ( ) , sorted.end ( ) );
+
+		/// Border edges , used by one triangle , get a plane through them at right angles to the face.
+		for ( std::size_t t = 0; t < triangleCount; ++t )
+		{
+			for ( int k = 0; k < 3; ++k )
+			{
+				unsigned long long key = edges[t * 3 + k];
+				std::pair<std::vector<unsigned long long>::iterator , std::vector<unsigned long long>::iterator> range = std::equal_range ( sorted.begin ( ) , sorted.end ( ) , key );
+				if ( range.second - range.first != 1 )
+				{
+					continue;
+				}
+
+				unsigned int a = triangles_[t * 3 + k];
+				unsigned int b = triangles_[t * 3 + ( k + 1 ) % 3];
+				unsigned int c = triangles_[t * 3 + ( k + 2 ) % 3];
+				const Vector3& pa = positions_[global_[a]];
+				const Vector3& pb = positions_[global_[b]];
+
+				Vector3 edge = pb - pa;
+				Vector3 n = edge ^ ( edge ^ ( positions_[global_[c]] - pa ) );
+				double length = std::sqrt ( static_cast<double> ( n * n ) );
+
+				border_[a] = border_[b] = 1;
+
+				if ( length > 0.0 )
+				{
+					double nx = n.x / length;
+					double ny = n.y / length;
+					double nz = n.z / length;
+					Quadric plane ( nx , ny , nz , - ( nx * pa.x + ny * pa.y + nz * pa.z ) , static_cast<double> ( edge * edge ) );
+
+					quadric_[a] += plane;
+					quadric_[b] += plane;
+				}
+			}
+		}
+
+		for ( std::size_t i = 0; i < sorted.size ( ); ++i )
+		{
+			if ( i == 0 || sorted[i] != sorted[i - 1] )
+			{
+				unsigned int a = static_cast<unsigned int> ( sorted[i] >> 32 );
+				unsigned int b = static_cast<unsigned int> ( sorted[i] & 0xffffffffull );
+				push ( a , b );
+				push ( b , a );
+			}
+		}
+	}
+
+	template < class Real >
+	void Simplifier<Real>::Collapser::push ( unsigned int from , unsigned int to )
+	{
+		if ( locked_[from] || ( border_[from] && !border_[to] ) )
+		{
+			return;
+		}
+
+		Quadric q = quadric_[from];
+		q += quadric_[to];
+
+		Candidate candidate;
+		Vector3 edge = positions_[global_[to]] - positions_[global_[from]];
+
+		candidate.cost = std::max ( 0.0 , q.evaluate ( positions_[global_[to]] ) );
+		candidate.length = static_cast<double> ( edge * edge );
+		candidate.from = from;
+		candidate.to = to;
+		candidate.stampFrom = stamp_[from];
+		candidate.stampTo = stamp_[to];
+
+		heap_.push ( candidate );
+	}
+
+	template < class Real >
+	void Simplifier<Real>::Collapser::neighbours ( unsigned int v , std::vector<unsigned int>& list , unsigned int mark )
+	{
+		list.clear ( );
+
+		std::vector<unsigned int>& triangles = adjacency_[v];
+		std::size_t kept = 0;
+
+		for ( std::size_t i = 0; i < triangles.size ( ); ++i )
+		{
+			unsigned int t = triangles[i];
+			if ( !live_[t] )
+			{
+				continue;
+			}
+			triangles[kept++] = t;
+
+			for ( int k = 0; k < 3; ++k )
+			{
+				unsigned int w = triangles_[t * 3 + k];
+				if ( w != v && mark_[w] != mark )
+				{
+					mark_[w] = mark;
+					list.push_back ( w );
+				}
+			}
+		}
+
+		triangles.resize ( kept );
+	}
+
+	template < class Real >
+	bool Simplifier<Real>::Collapser::allowed ( unsigned int from , unsigned int to )
+	{
+		neighbours ( from , scratch_ , ++time_ );
+		neighbours ( to , scratch_ , ++time_ );
+
+		/// Link condition , the two ends share only the apexes of the edge's triangles.
+		unsigned int mark = time_;
+		unsigned int counted = ++time_;
+		std::size_t shared = 0;
+
+		for ( std::size_t i = 0; i < adjacency_[from].size ( ); ++i )
+		{
+			const unsigned int* q = &triangles_[adjacency_[from][i] * 3];
+			for ( int k = 0; k < 3; ++k )
+			{
+				if ( q[k] != from && mark_[q[k]] == mark )
+				{
+					mark_[q[k]] = counted;
+					++shared;
+				}
+			}
+		}
+
+		std::size_t faces = 0;
+		const Vector3& target = positions_[global_[to]];
+		const std::vector<unsigned int>& triangles = adjacency_[from];
+
+		for ( std::size_t i = 0; i < triangles.size ( ); ++i )
+		{
+			const unsigned int* q = &triangles_[triangles[i] * 3];
+			if ( q[0] == to || q[1] == to || q[2] == to )
+			{
+				++faces;
+				continue;
+			}
+
+			/// The face must not fold over , nor drift more than about 80 degrees from where it started.
+			int k = ( q[0] == from ) ? 0 : ( ( q[1] == from ) ? 1 : 2 );
+			const Vector3& p1 = positions_[global_[q[( k + 1 ) % 3]]];
+			const Vector3& p2 = positions_[global_[q[( k + 2 ) % 3]]];
+
+			Vector3 before = ( p1 - positions_[global_[from]] ) ^ ( p2 - positions_[global_[from]] );
+			Vector3 after = ( p1 - target ) ^ ( p2 - target );
+
+			double turn = static_cast<double> ( origin_[triangles[i]] * after );
+			if ( before * after <= static_cast<Real> ( 0 ) || turn < kFold * std::sqrt ( static_cast<double> ( after * after ) ) )
+			{
+				return false;
+			}
+
+			/// Nor come out with its three corners on a line.
+			double edges = static_cast<double> ( ( p1 - target ) * ( p1 - target ) + ( p2 - target ) * ( p2 - target ) + ( p2 - p1 ) * ( p2 - p1 ) );
+			if ( static_cast<double> ( after * after ) <= kSliver * edges * edges )
+			{
+				return false;
+			}
+		}
+
+		if ( faces == 0 || shared != faces )
+		{
+			return false;
+		}
+
+		/// A border vertex only slides along a border edge.
+		return !border_[from] || faces == 1;
+	}
+
+	template < class Real >
+	void Simplifier<Real>::Collapser::collapse ( unsigned int from , unsigned int to )
+	{
+		std::vector<unsigned int>& triangles = adjacency_[from];
+
+		for ( std::size_t i = 0; i < triangles.size ( ); ++i )
+		{
+			unsigned int t = triangles[i];
+			unsigned int* q = &triangles_[t * 3];
+
+			if ( q[0] == to || q[1] == to || q[2] == to )
+			{
+				live_[t] = 0;
+				--liveCount_;
+				continue;
+			}
+
+			for ( int k = 0; k < 3; ++k )
+			{
+				if ( q[k] == from )
+				{
+					q[k] = to;
+				}
+			}
+			adjacency_[to].push_back ( t );
+		}
+
+		triangles.clear ( );
+		removed_[from] = 1;
+		quadric_[to] += quadric_[from];
+		++stamp_[to];
+
+		neighbours ( to , scratch_ , ++time_ );
+		for ( std::size_t i = 0; i < scratch_.size ( ); ++i )
+		{
+			push ( to , scratch_[i] );
+			push ( scratch_[i] , to );
+		}
+	}
+
+	template < class Real >
+	void Simplifier<Real>::Collapser::output ( Level& level ) const
+	{
+		level.indices.clear ( );
+		level.indices.reserve ( liveCount_ * 3 );
+
+		for ( std::size_t t = 0; t < live_.size ( ); ++t )
+		{
+			if ( live_[t] )
+			{
+				for ( int k = 0; k < 3; ++k )
+				{
+					level.indices.push_back ( global_[triangles_[t * 3 + k]] );
+				}
+			}
+		}
+
+		level.error = static_cast<Real> ( error_ );
+	}
+
+	template < class Real >
+	void Simplifier<Real>::Collapser::run ( const std::vector<std::size_t>& targets , std::vector<Level>& levels , std::size_t first )
+	{
+		std::size_t level = 0;
+
+		while ( level < targets.size ( ) )
+		{
+			if ( liveCount_ <= targets[level] || heap_.empty ( ) )
+			{
+				output ( levels[first + level] );
+				++level;
+				continue;
+			}
+
+			Candidate candidate = heap_.top ( );
+			heap_.pop ( );
+
+			if ( removed_[candidate.from] || removed_[candidate.to] ||
+			     candidate.stampFrom != stamp_[candidate.from] || candidate.stampTo != stamp_[candidate.to] )
+			{
+				continue;
+			}
+
+			if ( !allowed ( candidate.from , candidate.to ) )
+			{
+				continue;
+			}
+
+			error_ = std::max ( error_ , candidate.cost );
+			collapse ( candidate.from , candidate.to );
+		}
+	}
+
+	template < class Real >
+	void Simplifier<Real>::simplify ( const unsigned int* indices , std::size_t indexCount , const Vector3* positions , std::size_t vertexCount ,
+	                                  const std::vector<std::size_t>& targets , std::vector<Level>& levels )
+	{
+		std::size_t triangleCount = indexCount / 3;
+		levels.resize ( targets.size ( ) );
+
+		if ( targets.empty ( ) )
+		{
+			return;
+		}
+
+		/// Grid of partitions , about four per thread.
+		int threads = Parallel::maxThreads ( );
+		int side = 1;
+		while ( side * side * side < 4 * threads )
+		{
+			++side;
+		}
+		std::size_t partitions = static_cast<std::size_t> ( side ) * side * side;
+
+		/// Levels the partitions can reach on their own.
+		std::size_t parallel = 0;
+		if ( threads > 1 )
+		{
+			while ( parallel < targets.size ( ) && targets[parallel] >= 2 * partitions * kPartitionTail )
+			{
+				++parallel;
+			}
+		}
+
+		std::vector<unsigned int> input ( indices , indices + triangleCount * 3 );
+
+		if ( parallel > 0 )
+		{
+			BoundingBox3 box;
+			for ( std::size_t i = 0; i < triangleCount * 3; ++i )
+			{
+				box += positions[input[i]];
+			}
+			Vector3 lower = box.box_min ( );
+			Vector3 extent = box.extent ( );
+
+			/// Partition of each triangle , by the cell of its centroid.
+			std::vector<unsigned int> cell ( triangleCount );
+			for ( std::size_t t = 0; t < triangleCount; ++t )
+			{
+				Vector3 c = ( positions[input[t * 3]] + positions[input[t * 3 + 1]] + positions[input[t * 3 + 2]] ) / static_cast<Real> ( 3 );
+				int k[3];
+				for ( int a = 0; a < 3; ++a )
+				{
+					k[a] = ( extent[a] > static_cast<Real> ( 0 ) ) ? static_cast<int> ( ( c[a] - lower[a] ) / extent[a] * side ) : 0;
+					k[a] = std::max ( 0 , std::min ( side - 1 , k[a] ) );
+				}
+				cell[t] = static_cast<unsigned int> ( ( k[2] * side + k[1] ) * side + k[0] );
+			}
+
+			/// Vertices used by more than one partition stay put.
+			std::vector<unsigned int> owner ( vertexCount , ~0u );
+			std::vector<char> locked ( vertexCount , 0 );
+			for ( std::size_t t = 0; t < triangleCount; ++t )
+			{
+				for ( int k = 0; k < 3; ++k )
+				{
+					unsigned int& o = owner[input[t * 3 + k]];
+					if ( o == ~0u )
+					{
+						o = cell[t];
+					}
+					else if ( o != cell[t] )
+					{
+						locked[input[t * 3 + k]] = 1;
+					}
+				}
+			}
+
+			std::vector<std::vector<unsigned int> > groups ( partitions );
+			for ( std::size_t t = 0; t < triangleCount; ++t )
+			{
+				groups[cell[t]].insert ( groups[cell[t]].end ( ) , &input[t * 3] , &input[t * 3] + 3 );
+			}
+
+			std::vector<std::vector<Level> > partial ( partitions , std::vector<Level> ( parallel ) );
+			long count = static_cast<long> ( partitions );
+
+			#pragma omp parallel for schedule(dynamic, 1)
+			for ( long p = 0; p < count; ++p )
+			{
+				std::size_t share = groups[p].size ( ) / 3;
+				if ( share == 0 )
+				{
+					continue;
+				}
+
+				std::vector<std::size_t> local ( parallel );
+				for ( std::size_t l = 0; l < parallel; ++l )
+				{
+					local[l] = static_cast<std::size_t> ( static_cast<double> ( targets[l] ) * share / triangleCount );
+				}
+
+				Collapser collapser ( &groups[p][0] , share , positions , &locked );
+				collapser.run ( local , partial[p] , 0 );
+			}
+
+			for ( std::size_t l = 0; l < parallel; ++l )
+			{
+				levels[l].indices.clear ( );
+				levels[l].error = static_cast<Real> ( 0 );
+				for ( std::size_t p = 0; p < partitions; ++p )
+				{
+					levels[l].indices.insert ( levels[l].indices.end ( ) , partial[p][l].indices.begin ( ) , partial[p][l].indices.end ( ) );
+					levels[l].error = std::max ( levels[l].error , partial[p][l].error );
+				}
+			}
+
+			input = levels[parallel - 1].indices;
+		}
+
+		if ( parallel < targets.size ( ) && !input.empty ( ) )
+		{
+			std::vector<std::size_t> rest ( targets.begin ( ) + parallel , targets.end ( ) );
+
+			Collapser collapser ( &input[0] , input.size ( ) / 3 , positions , 0 );
+			collapser.run ( rest , levels , parallel );
+
+			if ( parallel > 0 )
+			{
+				for ( std::size_t l = parallel; l < targets.size ( ); ++l )
+				{
+					levels[l].error = std::max ( levels[l].error , levels[parallel - 1].error );
+				}
+			}
+		}
+	}
+
+	template < class Real >
+	void Simplifier<Real>::chain ( const unsigned int* indices , std::size_t indexCount , const Vector3* positions , std::size_t vertexCount ,
+	                               std::vector<Level>& levels , Real ratio , std::size_t minimum )
+	{
+		std::vector<std::size_t> targets;
+
+		std::size_t count = indexCount / 3;
+		while ( true )
+		{
+			std::size_t next = static_cast<std::size_t> ( count * ratio );
+			if ( next < minimum || next >= count )
+			{
+				break;
+			}
+			targets.push_back ( next );
+			count = next;
+		}
+
+		simplify ( indices , indexCount , positions , vertexCount , targets , levels );
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_SIMPLIFIER_HPP_ */
@@ -0,0 +1,406 @@
+#ifndef CELER_TANGENTSPACE_HPP_
+#define CELER_TANGENTSPACE_HPP_
+
+//- Celer/Core/Geometry/Mesh/TangentSpace.hpp - Vertex normals and tangents //
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Mesh Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the TangentSpace class which
+//        rebuilds vertex normals and tangents of an indexed triangle list.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector2.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Vector4.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class TangentSpace.
+	 *@brief Vertex normals and tangents of an indexed triangle list.
+	 *@details build ( ) takes the topology once and keeps , for every
+	 * vertex , the list of triangle corners using it. After that each call
+	 * runs two parallel passes and never scatters:
+	 * - faces: one thread block per run of triangles computes the unit
+	 *   normal , the area and , unless the weights are areas , the three
+	 *   corner angles. For float four triangles go through SIMD::Float4 at
+	 *   a time.
+	 * - vertices: one thread block per run of vertices gathers the faces of
+	 *   its corners , in corner order , so the result does not depend on the
+	 *   number of threads.
+	 *
+	 * Tangents follow MikkTSpace: the face tangent comes from the texture
+	 * coordinate gradients , is flipped with the sign of the texture area ,
+	 * projected on the plane of the vertex normal , normalized and summed
+	 * with corner angle weights. w holds the bitangent sign , so
+	 * bitangent = w ( normal x tangent ). Unlike MikkTSpace , vertices are
+	 * not split where the frames disagree , the index buffer decides what a
+	 * vertex is.
+	 *
+	 * \code
+	 * Celer::TangentSpace<float> frames;
+	 * frames.build ( &indices[0] , indices.size ( ) , positions.size ( ) );
+	 * // every frame , after skinning
+	 * frames.normals ( &positions[0] , &normals[0] );
+	 * frames.tangents ( &positions[0] , &normals[0] , &texCoords[0] , &tangents[0] );
+	 * \endcode
+	 */
+	template < class Real >
+	class TangentSpace
+	{
+		public:
+
+			typedef Celer::Vector2<Real> Vector2;
+			typedef Celer::Vector3<Real> Vector3;
+			typedef Celer::Vector4<Real> Vector4;
+
+			/// Weight of each face in the normal of its vertices.
+			enum Weighting
+			{
+				AREA ,	///< Face area.
+				ANGLE 	///< Angle of the face at the vertex.
+			};
+
+			TangentSpace ( )
+			{
+			}
+
+			/// Keeps the index buffer and the vertex to corner adjacency.
+			void build ( const unsigned int* indices , std::size_t indexCount , std::size_t vertexCount );
+
+			/// Unit normals , zero for a vertex of degenerate triangles only.
+			void normals ( const Vector3* positions , Vector3* normals , Weighting weighting = ANGLE );
+
+			/// Unit tangents orthogonal to normals , with the bitangent sign in w.
+			void tangents ( const Vector3* positions , const Vector3* normals , const Vector2* texCoords , Vector4* tangents );
+
+			std::size_t vertexCount ( ) const
+			{
+				return offset_.empty ( ) ? 0 : offset_.size ( ) - 1;
+			}
+
+			std::size_t triangleCount ( ) const
+			{
+				return indices_.size ( ) / 3;
+			}
+
+			/// Corners of vertex v , corner c is vertex c % 3 of triangle c / 3.
+			const unsigned int* begin ( std::size_t v ) const
+			{
+				return &corner_[0] + offset_[v];
+			}
+
+			const unsigned int* end ( std::size_t v ) const
+			{
+				return &corner_[0] + offset_[v + 1];
+			}
+
+		private:
+
+			enum
+			{
+				kBlock = 8192 	///< Triangles or vertices per thread task.
+			};
+
+			/// Unit normal , twice the area and the cosines of the corner angles.
+			template < class T >
+			static void face ( const T p0[3] , const T p1[3] , const T p2[3] , T normal[3] , T& area , T cosine[3] );
+
+			void faceRange ( const Vector3* positions , std::size_t first , std::size_t last , bool angles );
+
+			/// The corner angles cost three acos per face , area weights skip them.
+			void faces ( const Vector3* positions , bool angles );
+
+			static Real angle ( Real cosine )
+			{
+				return std::acos ( std::max ( static_cast<Real> ( -1 ) , std::min ( static_cast<Real> ( 1 ) , cosine ) ) );
+			}
+
+			std::vector<unsigned int> 	indices_;
+			std::vector<unsigned int> 	offset_;
+			std::vector<unsigned int> 	corner_;
+
+			/// Per face and per corner data of the last call.
+			std::vector<Vector3> 		faceNormal_;
+			std::vector<Real> 		faceArea_;
+			std::vector<Real> 		cornerAngle_;
+	};
+
+	template < class Real >
+	template < class T >
+	void TangentSpace<Real>::face ( const T p0[3] , const T p1[3] , const T p2[3] , T normal[3] , T& area , T cosine[3] )
+	{
+		const T zero ( static_cast<Real> ( 0 ) );
+		const T one ( static_cast<Real> ( 1 ) );
+
+		T a[3] = { p1[0] - p0[0] , p1[1] - p0[1] , p1[2] - p0[2] };
+		T b[3] = { p2[0] - p0[0] , p2[1] - p0[1] , p2[2] - p0[2] };
+		T c[3] = { p2[0] - p1[0] , p2[1] - p1[1] , p2[2] - p1[2] };
+
+		T n[3] = { a[1] * b[2] - a[2] * b[1] , a[2] * b[0] - a[0] * b[2] , a[0] * b[1] - a[1] * b[0] };
+		area = SIMD::sqrt ( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+
+		T inverse = SIMD::select ( area > zero , one / SIMD::select ( area > zero , area , one ) , zero );
+		normal[0] = n[0] * inverse;
+		normal[1] = n[1] * inverse;
+		normal[2] = n[2] * inverse;
+
+		T la = SIMD::sqrt ( a[0] * a[0] + a[1] * a[1] + a[2] * a[2] );
+		T lb = SIMD::sqrt ( b[0] * b[0] + b[1] * b[1] + b[2] * b[2] );
+		T lc = SIMD::sqrt ( c[0] * c[0] + c[1] * c[1] + c[2] * c[2] );
+
+		T ab = la * lb;
+		T ac = la * lc;
+		T bc = lb * lc;
+
+		/// A corner with a zero length edge gets angle pi / 2 , it only matters next to degenerate faces.
+		cosine[0] = SIMD::select ( ab > zero , ( a[0] * b[0] + a[1] * b[1] + a[2] * b[2] ) / SIMD::select ( ab > zero , ab , one ) , zero );
+		cosine[1] = SIMD::select ( ac > zero , -( a[0] * c[0] + a[1] * c[1] + a[2] * c[2] ) / SIMD::select ( ac > zero , ac , one ) , zero );
+		cosine[2] = SIMD::select ( bc > zero , ( b[0] * c[0] + b[1] * c[1] + b[2] * c[2] ) / SIMD::select ( bc > zero , bc , one ) , zero );
+	}
+
+	template < class Real >
+	void TangentSpace<Real>::faceRange ( const Vector3* positions , std::size_t first , std::size_t last , bool angles )
+	{
+		for ( std::size_t t = first; t < last; ++t )
+		{
+			const Vector3& q0 = positions[indices_[t * 3]];
+			const Vector3& q1 = positions[indices_[t * 3 + 1]];
+			const Vector3& q2 = positions[indices_[t * 3 + 2]];
+
+			Real p0[3] = { q0.x , q0.y , q0.z };
+			Real p1[3] = { q1.x , q1.y , q1.z };
+			Real p2[3] = { q2.x , q2.y , q2.z };
+			Real normal[3];
+			Real cosine[3];
+
+			face<Real> ( p0 , p1 , p2 , normal , faceArea_[t] , cosine );
+
+			faceNormal_[t] = Vector3 ( normal[0] , normal[1] , normal[2] );
+			for ( int k = 0; angles && k < 3; ++k )
+			{
+				cornerAngle_[t * 3 + k] = angle ( cosine[k] );
+			}
+		}
+	}
+
+	template < >
+	inline void TangentSpace<float>::faceRange ( const Vector3* positions , std::size_t first , std::size_t last , bool angles )
+	{
+		std::size_t t = first;
+
+		for ( ; t + 4 <= last; t += 4 )
+		{
+			const unsigned int* q = &indices_[t * 3];
+			SIMD::Float4 p[3][3];
+
+			for ( int v = 0; v < 3; ++v )
+			{
+				const Vector3& a = positions[q[v]];
+				const Vector3& b = positions[q[3 + v]];
+				const Vector3& c = positions[q[6 + v]];
+				const Vector3& d = positions[q[9 + v]];
+
+				p[v][0] = SIMD::Float4 ( a.x , b.x , c.x , d.x );
+				p[v][1] = SIMD::Float4 ( a.y , b.y , c.y , d.y );
+				p[v][2] = SIMD::Float4 ( a.z , b.z , c.z , d.z );
+			}
+
+			SIMD::Float4 normal[3];
+			SIMD::Float4 area;
+			SIMD::Float4 cosine[3];
+
+			face<SIMD::Float4> ( p[0] , p[1] , p[2] , normal , area , cosine );
+
+			float n[3][4];
+			float c[3][4];
+			for ( int k = 0; k < 3; ++k )
+			{
+				normal[k].store ( n[k] );
+				cosine[k].store ( c[k] );
+			}
+			area.store ( &faceArea_[t] );
+
+			for ( int lane = 0; lane < 4; ++lane )
+			{
+				faceNormal_[t + lane] = Vector3 ( n[0][lane] , n[1][lane] , n[2][lane] );
+				for ( int k = 0; angles && k < 3; ++k )
+				{
+					cornerAngle_[( t + lane ) * 3 + k] = angle ( c[k][lane] );
+				}
+			}
+		}
+
+		for ( ; t < last; ++t )
+		{
+			const Vector3& q0 = positions[indices_[t * 3]];
+			const Vector3& q1 = positions[indices_[t * 3 + 1]];
+			const Vector3& q2 = positions[indices_[t * 3 + 2]];
+
+			float p0[3] = { q0.x , q0.y , q0.z };
+			float p1[3] = { q1.x , q1.y , q1.z };
+			float p2[3] = { q2.x , q2.y , q2.z };
+			float normal[3];
+			float cosine[3];
+
+			face<float> ( p0 , p1 , p2 , normal , faceArea_[t] , cosine );
+
+			faceNormal_[t] = Vector3 ( normal[0] , normal[1] , normal[2] );
+			for ( int k = 0; angles && k < 3; ++k )
+			{
+				cornerAngle_[t * 3 + k] = angle ( cosine[k] );
+			}
+		}
+	}
+
+	template < class Real >
+	void TangentSpace<Real>::build ( const unsigned int* indices , std::size_t indexCount , std::size_t vertexCount )
+	{
+		std::size_t count = ( indexCount / 3 ) * 3;
+
+		indices_.assign ( indices , indices + count );
+		offset_.assign ( vertexCount + 1 , 0 );
+		corner_.resize ( count );
+
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			++offset_[indices_[i] + 1];
+		}
+		for ( std::size_t v = 0; v < vertexCount; ++v )
+		{
+			offset_[v + 1] += offset_[v];
+		}
+
+		/// Corners go in increasing order , which fixes the summation order.
+		std::vector<unsigned int> fill ( offset_.begin ( ) , offset_.end ( ) - 1 );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			corner_[fill[indices_[i]]++] = static_cast<unsigned int> ( i );
+		}
+
+		faceNormal_.resize ( count / 3 );
+		faceArea_.resize ( count / 3 );
+		cornerAngle_.resize ( count );
+	}
+
+	template < class Real >
+	void TangentSpace<Real>::faces ( const Vector3* positions , bool angles )
+	{
+		std::size_t count = triangleCount ( );
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			faceRange ( positions , first , last , angles );
+		}
+	}
+
+	template < class Real >
+	void TangentSpace<Real>::normals ( const Vector3* positions , Vector3* normals , Weighting weighting )
+	{
+		faces ( positions , weighting == ANGLE );
+
+		std::size_t count = vertexCount ( );
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+
+			for ( std::size_t v = first; v < last; ++v )
+			{
+				Vector3 sum;
+				for ( const unsigned int* c = begin ( v ); c != end ( v ); ++c )
+				{
+					Real weight = ( weighting == AREA ) ? faceArea_[*c / 3] : cornerAngle_[*c];
+					sum += faceNormal_[*c / 3] * weight;
+				}
+
+				Real length = std::sqrt ( sum * sum );
+				normals[v] = ( length > static_cast<Real> ( 0 ) ) ? sum / length : sum;
+			}
+		}
+	}
+
+	template < class Real >
+	void TangentSpace<Real>::tangents ( const Vector3* positions , const Vector3* normals , const Vector2* texCoords , Vector4* tangents )
+	{
+		faces ( positions , true );
+
+		std::size_t count = vertexCount ( );
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+
+			for ( std::size_t v = first; v < last; ++v )
+			{
+				const Vector3& n = normals[v];
+				Vector3 sum;
+				Real orientation = static_cast<Real> ( 0 );
+
+				for ( const unsigned int* c = begin ( v ); c != end ( v ); ++c )
+				{
+					const unsigned int* triangle = &indices_[( *c / 3 ) * 3];
+
+					Vector3 e1 = positions[triangle[1]] - positions[triangle[0]];
+					Vector3 e2 = positions[triangle[2]] - positions[triangle[0]];
+					Real s1 = texCoords[triangle[1]].x - texCoords[triangle[0]].x;
+					Real t1 = texCoords[triangle[1]].y - texCoords[triangle[0]].y;
+					Real s2 = texCoords[triangle[2]].x - texCoords[triangle[0]].x;
+					Real t2 = texCoords[triangle[2]].y - texCoords[triangle[0]].y;
+
+					/// Twice the signed area in texture space , its sign is the handedness of the face.
+					Real signedArea = s1 * t2 - t1 * s2;
+					Real sign = ( signedArea < static_cast<Real> ( 0 ) ) ? static_cast<Real> ( -1 ) : static_cast<Real> ( 1 );
+
+					Vector3 tangent = ( e1 * t2 - e2 * t1 ) * sign;
+					tangent -= n * ( n * tangent );
+
+					Real length = std::sqrt ( tangent * tangent );
+					if ( length > static_cast<Real> ( 0 ) )
+					{
+						Real weight = cornerAngle_[*c];
+						sum += tangent * ( weight / length );
+						orientation += ( signedArea > static_cast<Real> ( 0 ) ) ? weight : -weight;
+					}
+				}
+
+				Real length = std::sqrt ( sum * sum );
+				if ( length > static_cast<Real> ( 0 ) )
+				{
+					sum /= length;
+				}
+
+				tangents[v] = Vector4 ( sum , ( orientation < static_cast<Real> ( 0 ) ) ? static_cast<Real> ( -1 ) : static_cast<Real> ( 1 ) );
+			}
+		}
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_TANGENTSPACE_HPP_ */
@@ -0,0 +1,918 @@
+#ifndef CELER_CONVEXHULL_HPP_
+#define CELER_CONVEXHULL_HPP_
+
+//- Celer/Core/Geometry/PointCloud/ConvexHull.hpp - Quickhull Module ------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Point Cloud Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the ConvexHull class which
+//        computes the 3D convex hull of a point set by quickhull and returns
+//        it as a half-edge mesh.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+/// Celer Library
+#include <Celer/Base/Parallel.hpp>
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class ConvexHull.
+	 *@brief Quickhull over Vector3 point sets.
+	 *@details The hull starts from a tetrahedron on the extreme points, found
+	 * with SSE over four points at a time for float input. Every point is then
+	 * handed, in parallel, to the outside set of a face it lies above. Each
+	 * iteration lifts the furthest point of a face, removes the faces it sees,
+	 * closes the horizon with a fan of new faces and hands the orphaned points
+	 * to them, again in parallel when there are many.
+	 *
+	 * Faces and half-edges live in pools owned by the object. Removed faces go
+	 * to a free list and outside sets are linked lists threaded through a per
+	 * point array, so once a ConvexHull has built a hull of some size the next
+	 * builds of that size do not allocate.
+	 *
+	 * The result is a closed triangle mesh with outward normals, stored as
+	 * half-edges over the hull vertices. Every input point is inside it or
+	 * within epsilon ( ) of it. Coplanar faces are not merged, so thin faces
+	 * over nearly coplanar points can bend inwards by slightly more than
+	 * epsilon ( ).
+	 *
+	 * \code
+	 * Celer::ConvexHull<float> hull;
+	 * if ( hull.build ( points ) )
+	 * {
+	 * 	std::vector<unsigned int> triangles;
+	 * 	hull.triangles ( triangles );
+	 * }
+	 * \endcode
+	 *
+	 * Fewer than four points, or points which are all on one plane, give no
+	 * hull and build ( ) returns false.
+	 */
+	template < class Real >
+	class ConvexHull
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			/// Half-edge of the hull , all indices refer to the output arrays.
+			struct HalfEdge
+			{
+				unsigned int vertex;	///< Origin vertex.
+				unsigned int twin;	///< Opposite half-edge.
+				unsigned int next;	///< Next half-edge counter-clockwise on the face.
+				unsigned int face;	///< Face on the left.
+			};
+
+			struct Face
+			{
+				unsigned int 	edge;	///< One of the three half-edges of the face.
+				Vector3 	normal;	///< Unit outward normal.
+				Real 		offset;	///< normal * p for any point p of the face.
+			};
+
+			ConvexHull ( ) : points_ ( 0 ) , epsilon_ ( 0 ) , visit_ ( 0 ) , elapsed_ ( 0.0 )
+			{
+			}
+
+			bool build ( const Vector3* points , std::size_t count );
+
+			bool build ( const std::vector<Vector3>& points )
+			{
+				return build ( points.empty ( ) ? 0 : &points[0] , points.size ( ) );
+			}
+
+			/// Positions of the hull vertices.
+			const std::vector<Vector3>& vertices ( ) const
+			{
+				return vertices_;
+			}
+
+			/// Input index of each hull vertex.
+			const std::vector<unsigned int>& vertexIndices ( ) const
+			{
+				return vertexIndices_;
+			}
+
+			const std::vector<HalfEdge>& halfEdges ( ) const
+			{
+				return halfEdges_;
+			}
+
+			const std::vector<Face>& faces ( ) const
+			{
+				return faces_;
+			}
+
+			/// Three hull vertex indices per face , counter-clockwise from outside.
+			void triangles ( std::vector<unsigned int>& indices ) const
+			{
+				indices.resize ( faces_.size ( ) * 3 );
+				for ( std::size_t f = 0; f < faces_.size ( ); ++f )
+				{
+					unsigned int e = faces_[f].edge;
+					for ( int k = 0; k < 3; ++k )
+					{
+						indices[3 * f + k] = halfEdges_[e].vertex;
+						e = halfEdges_[e].next;
+					}
+				}
+			}
+
+			/// Distance under which a point counts as lying on a face.
+			Real epsilon ( ) const
+			{
+				return epsilon_;
+			}
+
+			/// Seconds spent in the last build.
+			double elapsed ( ) const
+			{
+				return elapsed_;
+			}
+
+		private:
+
+			enum
+			{
+				kNone = 0xFFFFFFFFu,
+				/// Orphans handed to the new faces in parallel above this count.
+				kParallelAssign = 4096
+			};
+
+			/// Working face. Face f owns the half-edges 3f , 3f + 1 and 3f + 2.
+			/// Planes are kept in double whatever Real is , the differences and
+			/// products of float coordinates are then exact and thin faces do not
+			/// flip.
+			struct BuildFace
+			{
+				Celer::Vector3<double> 	normal;
+				double 		offset;
+				unsigned int 	head;		///< First point of the outside set.
+				unsigned int 	furthest;	///< Point of the outside set furthest above.
+				Real 		height;		///< Its distance.
+				unsigned int 	visit;		///< Iteration which last classified the face.
+				bool 		visible;	///< Classification of that iteration.
+				bool 		alive;
+			};
+
+			struct Horizon
+			{
+				unsigned int from;
+				unsigned int to;
+				unsigned int twin;		///< Half-edge on the face which stays.
+			};
+
+			/// Squared distance to the line through origin_ along direction_.
+			struct LineDistance
+			{
+				Vector3 origin;
+				Vector3 direction;
+
+				Real operator( ) ( const Vector3& p ) const
+				{
+					Vector3 c = ( p - origin ) ^ direction;
+					return c * c;
+				}
+			};
+
+			/// Absolute distance to the plane ( normal , offset ).
+			struct PlaneDistance
+			{
+				Vector3 normal;
+				Real offset;
+
+				Real operator( ) ( const Vector3& p ) const
+				{
+					return std::fabs ( normal * p - offset );
+				}
+			};
+
+			Real distance ( unsigned int face , const Vector3& p ) const
+			{
+				const Celer::Vector3<double>& n = pool_[face].normal;
+				return static_cast<Real> ( n.x * p.x + n.y * p.y + n.z * p.z - pool_[face].offset );
+			}
+
+			void extremes ( unsigned int index[6] ) const;
+
+			template < class Measure >
+			unsigned int furthest ( const Measure& measure , Real& best );
+
+			unsigned int createFace ( unsigned int a , unsigned int b , unsigned int c );
+			void removeFace ( unsigned int face );
+
+			/// Links point p to the first face of faces it lies above.
+			unsigned int above ( const unsigned int* faces , std::size_t count , unsigned int p ) const;
+			void push ( unsigned int face , unsigned int p );
+			void assign ( const std::vector<unsigned int>& points , const unsigned int* faces , std::size_t count );
+
+			bool initialize ( );
+			bool simpleHorizon ( );
+			void dropEye ( unsigned int face );
+			void addPoint ( unsigned int face );
+			void collect ( );
+
+			const Vector3* 			points_;
+			std::size_t 			count_;
+			Real 				epsilon_;
+			unsigned int 			visit_;
+
+			/// Pools , kept between builds.
+			std::vector<BuildFace> 		pool_;
+			std::vector<HalfEdge> 		edges_;
+			std::vector<unsigned int> 	free_;
+			std::vector<unsigned int> 	next_;		///< Outside set links , one per point.
+			std::vector<unsigned int> 	spoke_;		///< New half-edge ending at each horizon vertex.
+
+			/// Scratch of one iteration , kept between builds.
+			std::vector<unsigned int> 	stack_;
+			std::vector<unsigned int> 	visible_;
+			std::vector<Horizon> 		horizon_;
+			std::vector<unsigned int> 	created_;
+			std::vector<unsigned int> 	orphans_;
+			std::vector<unsigned int> 	owner_;
+			std::vector<unsigned int> 	pending_;
+			std::vector<Real> 		threadBest_;
+			std::vector<unsigned int> 	threadIndex_;
+			std::vector<unsigned int> 	remap_;
+
+			std::vector<Vector3> 		vertices_;
+			std::vector<unsigned int> 	vertexIndices_;
+			std::vector<HalfEdge> 		halfEdges_;
+			std::vector<Face> 		faces_;
+
+			double 				elapsed_;
+	};
+
+	/// Minimum and maximum point along each axis , as x min , x max , y min ...
+	template < class Real >
+	void ConvexHull<Real>::extremes ( unsigned int index[6] ) const
+	{
+		for ( int k = 0; k < 6; ++k )
+		{
+			index[k] = 0;
+		}
+
+		for ( std::size_t i = 1; i < count_; ++i )
+		{
+			for ( int axis = 0; axis < 3; ++axis )
+			{
+				if ( points_[i][axis] < points_[index[2 * axis]][axis] )
+				{
+					index[2 * axis] = static_cast<unsigned int> ( i );
+				}
+				if ( points_[i][axis] > points_[index[2 * axis + 1]][axis] )
+				{
+					index[2 * axis + 1] = static_cast<unsigned int> ( i );
+				}
+			}
+		}
+	}
+
+	/// Min and max over four points per step , the indices are then found by a
+	/// second scan which stops at the first point holding each value.
+	template < >
+	inline void ConvexHull<float>::extremes ( unsigned int index[6] ) const
+	{
+		const float* p = &points_[0].x;
+		std::size_t blocks = count_ / 4;
+
+		SIMD::Float4 lower[3];
+		SIMD::Float4 upper[3];
+		lower[0] = upper[0] = SIMD::Float4 ( p[0] );
+		lower[1] = upper[1] = SIMD::Float4 ( p[1] );
+		lower[2] = upper[2] = SIMD::Float4 ( p[2] );
+
+		for ( std::size_t b = 0; b < blocks; ++b )
+		{
+			SIMD::Float4 axis[3];
+			SIMD::loadPoints ( p + 12 * b , axis[0] , axis[1] , axis[2] );
+
+			for ( int k = 0; k < 3; ++k )
+			{
+				lower[k] = SIMD::min ( lower[k] , axis[k] );
+				upper[k] = SIMD::max ( upper[k] , axis[k] );
+			}
+		}
+
+		float value[6];
+		for ( int k = 0; k < 3; ++k )
+		{
+			float lanes[2][4];
+			lower[k].store ( lanes[0] );
+			upper[k].store ( lanes[1] );
+			value[2 * k] = std::min ( std::min ( lanes[0][0] , lanes[0][1] ) , std::min ( lanes[0][2] , lanes[0][3] ) );
+			value[2 * k + 1] = std::max ( std::max ( lanes[1][0] , lanes[1][1] ) , std::max ( lanes[1][2] , lanes[1][3] ) );
+		}
+
+		for ( std::size_t i = 4 * blocks; i < count_; ++i )
+		{
+			for ( int k = 0; k < 3; ++k )
+			{
+				value[2 * k] = std::min ( value[2 * k] , p[3 * i + k] );
+				value[2 * k + 1] = std::max ( value[2 * k + 1] , p[3 * i + k] );
+			}
+		}
+
+		int found = 0;
+		for ( int k = 0; k < 6; ++k )
+		{
+			index[k] = kNone;
+		}
+
+		for ( std::size_t i = 0; i < count_ && found < 6; ++i )
+		{
+			for ( int k = 0; k < 6; ++k )
+			{
+				if ( index[k] == kNone && p[3 * i + k / 2] == value[k] )
+				{
+					index[k] = static_cast<unsigned int> ( i );
+					++found;
+				}
+			}
+		}
+	}
+
+	/// Point with the largest measure , each thread keeps its own best.
+	template < class Real >
+	template < class Measure >
+	unsigned int ConvexHull<Real>::furthest ( const Measure& measure , Real& best )
+	{
+		int threads = Celer::Parallel::maxThreads ( );
+		threadBest_.assign ( threads , static_cast<Real> ( -1 ) );
+		threadIndex_.assign ( threads , 0 );
+		long n = static_cast<long> ( count_ );
+
+		#pragma omp parallel
+		{
+			int t = Celer::Parallel::threadIndex ( );
+			Real localBest = static_cast<Real> ( -1 );
+			unsigned int localIndex = 0;
+
+			#pragma omp for schedule(static)
+			for ( long i = 0; i < n; ++i )
+			{
+				Real d = measure ( points_[i] );
+				if ( d > localBest )
+				{
+					localBest = d;
+					localIndex = static_cast<unsigned int> ( i );
+				}
+			}
+
+			threadBest_[t] = localBest;
+			threadIndex_[t] = localIndex;
+		}
+
+		unsigned int index = threadIndex_[0];
+		best = threadBest_[0];
+		for ( int t = 1; t < threads; ++t )
+		{
+			if ( threadBest_[t] > best )
+			{
+				best = threadBest_[t];
+				index = threadIndex_[t];
+			}
+		}
+
+		return index;
+	}
+
+	template < class Real >
+	unsigned int ConvexHull<Real>::createFace ( unsigned int a , unsigned int b , unsigned int c )
+	{
+		unsigned int f;
+		if ( free_.empty ( ) )
+		{
+			f = static_cast<unsigned int> ( pool_.size ( ) );
+			pool_.push_back ( BuildFace ( ) );
+			edges_.resize ( edges_.size ( ) + 3 );
+		}
+		else
+		{
+			f = free_.back ( );
+			free_.pop_back ( );
+		}
+
+		unsigned int v[3] = { a , b , c };
+		for ( unsigned int k = 0; k < 3; ++k )
+		{
+			HalfEdge& edge = edges_[3 * f + k];
+			edge.vertex = v[k];
+			edge.twin = kNone;
+			edge.next = 3 * f + ( k + 1 ) % 3;
+			edge.face = f;
+		}
+
+		Celer::Vector3<double> pa ( points_[a].x , points_[a].y , points_[a].z );
+		Celer::Vector3<double> pb ( points_[b].x , points_[b].y , points_[b].z );
+		Celer::Vector3<double> pc ( points_[c].x , points_[c].y , points_[c].z );
+
+		BuildFace& face = pool_[f];
+		face.normal = ( pb - pa ) ^ ( pc - pa );
+		face.normal.normalize ( );
+		face.offset = face.normal * pa;
+		face.head = kNone;
+		face.furthest = kNone;
+		face.height = static_cast<Real> ( 0 );
+		face.visit = 0;
+		face.visible = false;
+		face.alive = true;
+
+		return f;
+	}
+
+	template < class Real >
+	void ConvexHull<Real>::removeFace ( unsigned int face )
+	{
+		pool_[face].alive = false;
+		free_.push_back ( face );
+	}
+
+	template < class Real >
+	unsigned int ConvexHull<Real>::above ( const unsigned int* faces , std::size_t count , unsigned int p ) const
+	{
+		for ( std::size_t k = 0; k < count; ++k )
+		{
+			if ( distance ( faces[k] , points_[p] ) > epsilon_ )
+			{
+				return faces[k];
+			}
+		}
+		return kNone;
+	}
+
+	template < class Real >
+	void ConvexHull<Real>::push ( unsigned int face , unsigned int p )
+	{
+		BuildFace& f = pool_[face];
+		Real d = distance ( face , points_[p] );
+
+		next_[p] = f.head;
+		f.head = p;
+
+		if ( f.furthest == kNone || d > f.height )
+		{
+			f.furthest = p;
+			f.height = d;
+		}
+	}
+
+	/// Hands every point to the first face it lies above , points above none
+	/// are inside the hull and dropped.
+	template < class Real >
+	void ConvexHull<Real>::assign ( const std::vector<unsigned int>& points , const unsigned int* faces , std::size_t count )
+	{
+		long n = static_cast<long> ( points.size ( ) );
+
+		if ( n > kParallelAssign )
+		{
+			owner_.resize ( points.size ( ) );
+
+			#pragma omp parallel for schedule(static)
+			for ( long i = 0; i < n; ++i )
+			{
+				owner_[i] = above ( faces , count , points[i] );
+			}
+
+			for ( long i = 0; i < n; ++i )
+			{
+				if ( owner_[i] != kNone )
+				{
+					push ( owner_[i] , points[i] );
+				}
+			}
+		}
+		else
+		{
+			for ( long i = 0; i < n; ++i )
+			{
+				unsigned int face = above ( faces , count , points[i] );
+				if ( face != kNone )
+				{
+					push ( face , points[i] );
+				}
+			}
+		}
+	}
+
+	/// Builds the first tetrahedron and splits the points among its faces.
+	template < class Real >
+	bool ConvexHull<Real>::initialize ( )
+	{
+		unsigned int index[6];
+		extremes ( index );
+
+		/// Tolerance scaled by the extent of the input , as in qhull.
+		Real extent = static_cast<Real> ( 0 );
+		for ( int axis = 0; axis < 3; ++axis )
+		{
+			extent += std::max ( std::fabs ( points_[index[2 * axis]][axis] ) , std::fabs ( points_[index[2 * axis + 1]][axis] ) );
+		}
+		epsilon_ = static_cast<Real> ( 3 ) * extent * std::numeric_limits<Real>::epsilon ( );
+
+		/// The widest pair of extremes spans the first edge.
+		unsigned int v[4] = { index[0] , index[1] , 0 , 0 };
+		Real widest = static_cast<Real> ( -1 );
+		for ( int axis = 0; axis < 3; ++axis )
+		{
+			Vector3 d = points_[index[2 * axis + 1]] - points_[index[2 * axis]];
+			if ( d * d > widest )
+			{
+				widest = d * d;
+				v[0] = index[2 * axis];
+				v[1] = index[2 * axis + 1];
+			}
+		}
+
+		if ( widest <= epsilon_ * epsilon_ )
+		{
+			return false;
+		}
+
+		LineDistance line;
+		line.origin = points_[v[0]];
+		line.direction = points_[v[1]] - points_[v[0]];
+		line.direction.normalize ( );
+
+		Real best;
+		v[2] = furthest ( line , best );
+		if ( best <= epsilon_ * epsilon_ )
+		{
+			return false;
+		}
+
+		PlaneDistance plane;
+		plane.normal = ( points_[v[1]] - points_[v[0]] ) ^ ( points_[v[2]] - points_[v[0]] );
+		plane.normal.normalize ( );
+		plane.offset = plane.normal * points_[v[0]];
+
+		v[3] = furthest ( plane , best );
+		if ( best <= epsilon_ )
+		{
+			return false;
+		}
+
+		/// The apex has to be below the base for the base to face outwards.
+		if ( plane.normal * points_[v[3]] - plane.offset > static_cast<Real> ( 0 ) )
+		{
+			std::swap ( v[1] , v[2] );
+		}
+
+		unsigned int tetrahedron[4];
+		tetrahedron[0] = createFace ( v[0] , v[1] , v[2] );
+		tetrahedron[1] = createFace ( v[0] , v[3] , v[1] );
+		tetrahedron[2] = createFace ( v[1] , v[3] , v[2] );
+		tetrahedron[3] = createFace ( v[2] , v[3] , v[0] );
+
+		for ( int i = 0; i < 4; ++i )
+		{
+			for ( int j = 0; j < 4; ++j )
+			{
+				if ( i == j )
+				{
+					continue;
+				}
+				for ( unsigned int a = 3 * tetrahedron[i]; a < 3 * tetrahedron[i] + 3; ++a )
+				{
+					for ( unsigned int b = 3 * tetrahedron[j]; b < 3 * tetrahedron[j] + 3; ++b )
+					{
+						if ( edges_[a].vertex == edges_[edges_[b].next].vertex && edges_[b].vertex == edges_[edges_[a].next].vertex )
+						{
+							edges_[a].twin = b;
+						}
+					}
+				}
+			}
+		}
+
+		orphans_.clear ( );
+		orphans_.reserve ( count_ );
+		for ( std::size_t i = 0; i < count_; ++i )
+		{
+			unsigned int p = static_cast<unsigned int> ( i );
+			if ( p != v[0] && p != v[1] && p != v[2] && p != v[3] )
+			{
+				orphans_.push_back ( p );
+			}
+		}
+
+		assign ( orphans_ , tetrahedron , 4 );
+
+		pending_.assign ( tetrahedron , tetrahedron + 4 );
+
+		return true;
+	}
+
+	/// Lifts the furthest point of face onto the hull.
+	template < class Real >
+	void ConvexHull<Real>::addPoint ( unsigned int face )
+	{
+		unsigned int eye = pool_[face].furthest;
+		const Vector3& p = points_[eye];
+
+		/// Faces seen from the eye , grown from face across its edges. Every
+		/// edge between a seen and an unseen face is on the horizon. Faces the
+		/// eye is within epsilon of count as seen: leaving one would let the new
+		/// face across the shared edge fold over it.
+		++visit_;
+		visible_.clear ( );
+		horizon_.clear ( );
+		stack_.clear ( );
+
+		pool_[face].visit = visit_;
+		pool_[face].visible = true;
+		stack_.push_back ( face );
+
+		while ( !stack_.empty ( ) )
+		{
+			unsigned int f = stack_.back ( );
+			stack_.pop_back ( );
+			visible_.push_back ( f );
+
+			for ( unsigned int e = 3 * f; e < 3 * f + 3; ++e )
+			{
+				unsigned int twin = edges_[e].twin;
+				unsigned int neighbour = edges_[twin].face;
+				BuildFace& n = pool_[neighbour];
+
+				if ( n.visit != visit_ )
+				{
+					n.visit = visit_;
+					n.visible = distance ( neighbour , p ) > -epsilon_;
+					if ( n.visible )
+					{
+						stack_.push_back ( neighbour );
+					}
+				}
+
+				if ( !n.visible )
+				{
+					Horizon h;
+					h.from = edges_[e].vertex;
+					h.to = edges_[edges_[e].next].vertex;
+					h.twin = twin;
+					horizon_.push_back ( h );
+				}
+			}
+		}
+
+		/// Rounding can make the seen faces touch the horizon twice at a vertex.
+		/// The eye is then left out of the hull instead of breaking the mesh.
+		if ( !simpleHorizon ( ) )
+		{
+			dropEye ( face );
+			return;
+		}
+
+		/// The outside sets of the removed faces become orphans.
+		orphans_.clear ( );
+		for ( std::size_t k = 0; k < visible_.size ( ); ++k )
+		{
+			for ( unsigned int q = pool_[visible_[k]].head; q != kNone; q = next_[q] )
+			{
+				if ( q != eye )
+				{
+					orphans_.push_back ( q );
+				}
+			}
+			removeFace ( visible_[k] );
+		}
+
+		/// A fan of faces from the horizon to the eye.
+		created_.clear ( );
+		for ( std::size_t k = 0; k < horizon_.size ( ); ++k )
+		{
+			const Horizon& h = horizon_[k];
+			unsigned int f = createFace ( h.from , h.to , eye );
+
+			edges_[3 * f].twin = h.twin;
+			edges_[h.twin].twin = 3 * f;
+			spoke_[h.from] = 3 * f + 2;
+
+			created_.push_back ( f );
+		}
+
+		for ( std::size_t k = 0; k < created_.size ( ); ++k )
+		{
+			unsigned int e = 3 * created_[k] + 1;
+			unsigned int to = horizon_[k].to;
+
+			edges_[e].twin = spoke_[to];
+			edges_[spoke_[to]].twin = e;
+		}
+
+		for ( std::size_t k = 0; k < horizon_.size ( ); ++k )
+		{
+			spoke_[horizon_[k].from] = kNone;
+		}
+
+		assign ( orphans_ , &created_[0] , created_.size ( ) );
+
+		pending_.insert ( pending_.end ( ) , created_.begin ( ) , created_.end ( ) );
+	}
+
+	/// True when every horizon vertex starts exactly one horizon edge and ends
+	/// exactly one , so the fan around the eye closes.
+	template < class Real >
+	bool ConvexHull<Real>::simpleHorizon ( )
+	{
+		bool simple = true;
+
+		for ( std::size_t k = 0; k < horizon_.size ( ); ++k )
+		{
+			simple = simple && ( spoke_[horizon_[k].from] == kNone );
+			spoke_[horizon_[k].from] = static_cast<unsigned int> ( k );
+		}
+
+		for ( std::size_t k = 0; k < horizon_.size ( ) && simple; ++k )
+		{
+			simple = ( spoke_[horizon_[k].to] != kNone );
+		}
+
+		for ( std::size_t k = 0; k < horizon_.size ( ); ++k )
+		{
+			spoke_[horizon_[k].from] = kNone;
+		}
+
+		return simple;
+	}
+
+	/// Removes the furthest point from the outside set of face.
+	template < class Real >
+	void ConvexHull<Real>::dropEye ( unsigned int face )
+	{
+		BuildFace& f = pool_[face];
+		unsigned int eye = f.furthest;
+		unsigned int previous = kNone;
+
+		f.furthest = kNone;
+		f.height = static_cast<Real> ( 0 );
+
+		for ( unsigned int q = f.head; q != kNone; q = next_[q] )
+		{
+			if ( q == eye )
+			{
+				if ( previous == kNone )
+				{
+					f.head = next_[q];
+				}
+				else
+				{
+					next_[previous] = next_[q];
+				}
+				continue;
+			}
+
+			Real d = distance ( face , points_[q] );
+			if ( f.furthest == kNone || d > f.height )
+			{
+				f.furthest = q;
+				f.height = d;
+			}
+			previous = q;
+		}
+
+		if ( f.furthest != kNone )
+		{
+			pending_.push_back ( face );
+		}
+	}
+
+	/// Compacts the live faces and the vertices they use into the output.
+	template < class Real >
+	void ConvexHull<Real>::collect ( )
+	{
+		vertices_.clear ( );
+		vertexIndices_.clear ( );
+		halfEdges_.clear ( );
+		faces_.clear ( );
+
+		/// spoke_ is all kNone again , it doubles as the vertex map.
+		std::vector<unsigned int>& vertexMap = spoke_;
+		remap_.assign ( pool_.size ( ) , kNone );
+
+		for ( std::size_t f = 0; f < pool_.size ( ); ++f )
+		{
+			if ( !pool_[f].alive )
+			{
+				continue;
+			}
+
+			remap_[f] = static_cast<unsigned int> ( faces_.size ( ) );
+
+			Face face;
+			face.edge = static_cast<unsigned int> ( 3 * faces_.size ( ) );
+			face.normal = Vector3 ( static_cast<Real> ( pool_[f].normal.x ) , static_cast<Real> ( pool_[f].normal.y ) , static_cast<Real> ( pool_[f].normal.z ) );
+			face.offset = static_cast<Real> ( pool_[f].offset );
+			faces_.push_back ( face );
+
+			for ( unsigned int e = 3 * f; e < 3 * f + 3; ++e )
+			{
+				unsigned int v = edges_[e].vertex;
+				if ( vertexMap[v] == kNone )
+				{
+					vertexMap[v] = static_cast<unsigned int> ( vertices_.size ( ) );
+					vertices_.push_back ( points_[v] );
+					vertexIndices_.push_back ( v );
+				}
+			}
+		}
+
+		halfEdges_.resize ( 3 * faces_.size ( ) );
+		for ( std::size_t f = 0; f < pool_.size ( ); ++f )
+		{
+			if ( remap_[f] == kNone )
+			{
+				continue;
+			}
+
+			for ( unsigned int k = 0; k < 3; ++k )
+			{
+				const HalfEdge& from = edges_[3 * f + k];
+				HalfEdge& to = halfEdges_[3 * remap_[f] + k];
+
+				to.vertex = vertexMap[from.vertex];
+				to.twin = 3 * remap_[edges_[from.twin].face] + from.twin % 3;
+				to.next = 3 * remap_[f] + ( k + 1 ) % 3;
+				to.face = remap_[f];
+			}
+		}
+
+		for ( std::size_t k = 0; k < vertexIndices_.size ( ); ++k )
+		{
+			vertexMap[vertexIndices_[k]] = kNone;
+		}
+	}
+
+	template < class Real >
+	bool ConvexHull<Real>::build ( const Vector3* points , std::size_t count )
+	{
+		Celer::Timer timer;
+
+		points_ = points;
+		count_ = count;
+
+		pool_.clear ( );
+		edges_.clear ( );
+		free_.clear ( );
+		pending_.clear ( );
+		vertices_.clear ( );
+		vertexIndices_.clear ( );
+		halfEdges_.clear ( );
+		faces_.clear ( );
+
+		if ( count < 4 )
+		{
+			elapsed_ = timer.elapsed ( );
+			return false;
+		}
+
+		next_.resize ( count );
+		spoke_.assign ( count , kNone );
+
+		if ( !initialize ( ) )
+		{
+			elapsed_ = timer.elapsed ( );
+			return false;
+		}
+
+		while ( !pending_.empty ( ) )
+		{
+			unsigned int f = pending_.back ( );
+			pending_.pop_back ( );
+
+			if ( pool_[f].alive && pool_[f].furthest != kNone )
+			{
+				addPoint ( f );
+			}
+		}
+
+		collect ( );
+
+		elapsed_ = timer.elapsed ( );
+		return true;
+	}
+
+}
+
+#endif /* CELER_CONVEXHULL_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * IterativeClosestPoint.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Geometry/PointCloud/IterativeClosestPoint.hpp>
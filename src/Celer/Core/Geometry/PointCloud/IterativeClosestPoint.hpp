@@ -0,0 +1,860 @@
+#ifndef CELER_ITERATIVECLOSESTPOINT_HPP_
+#define CELER_ITERATIVECLOSESTPOINT_HPP_
+
+//- Celer/Core/Geometry/PointCloud/IterativeClosestPoint.hpp - ICP Module ---//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Point Cloud Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the IterativeClosestPoint
+//        class which rigidly registers a source point set onto a target one.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+/// SSE intrinsics for the cross-covariance accumulation
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+/// Celer Library
+#include <Celer/Base/Parallel.hpp>
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix3x3.hpp>
+#include <Celer/Core/Geometry/Math/Quaternion.hpp>
+#include <Celer/Core/Geometry/Math/EigenSystem.hpp>
+#include <Celer/Core/Geometry/PointCloud/KdTree.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class IterativeClosestPoint.
+	 *@brief Point-to-point and point-to-plane ICP registration.
+	 *@details Each iteration matches every source point to its nearest target
+	 * point through a KdTree, rejects pairs farther than the maximum
+	 * correspondence distance and solves for the rigid motion in closed form:
+	 *
+	 * - POINT_TO_POINT: the cross-covariance H of the pairs is decomposed through
+	 *   the EigenSystem of H^T H (an SVD of H) and R = V U^T, with the reflection
+	 *   case handled as in Kabsch's method.
+	 * - POINT_TO_PLANE: the linearized plane distances give a 6x6 normal equation
+	 *   solved by Cholesky, the rotation vector is turned into a Quaternion.
+	 *
+	 * The source is processed in blocks of kBlock points spread over the OpenMP
+	 * threads. Each block writes its pairs to a local SoA buffer which is then
+	 * accumulated with SSE for either metric, in float lanes flushed to double
+	 * once per block. All sums are taken about the target centroid to keep the
+	 * float lanes accurate.
+	 *
+	 * Iteration stops when the rotation and translation increments, or the
+	 * relative change of the RMS distance, fall under their tolerances.
+	 *
+	 * \code
+	 * Celer::IterativeClosestPoint<float> icp;
+	 * icp.setTarget ( scan0 );
+	 * icp.setMaxCorrespondenceDistance ( 0.05f );
+	 * Celer::Matrix3x3<float> rotation;
+	 * Celer::Vector3<float> translation;
+	 * icp.align ( scan1 , rotation , translation );
+	 * std::cout << icp.iterationsPerSecond ( ) << " it/s" << std::endl;
+	 * \endcode
+	 */
+	template < class Real >
+	class IterativeClosestPoint
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 	Vector3;
+			typedef Celer::Matrix3x3<Real> 	Matrix3x3;
+
+			enum Metric
+			{
+				POINT_TO_POINT,
+				POINT_TO_PLANE
+			};
+
+			/// Source points per block of the correspondence search.
+			enum { kBlock = 256 };
+
+		private:
+
+			/// Sums over the correspondences, all in double.
+			struct Accumulator
+			{
+				double count;
+				double error;		///< Sum of the squared pair distances.
+				double p[3];		///< Sum of the source points.
+				double q[3];		///< Sum of the target points.
+				double pq[9];		///< Sum of p q^T, row major.
+				double ata[6][6];	///< Point-to-plane normal matrix.
+				double atb[6];		///< Point-to-plane right hand side.
+
+				void clear ( )
+				{
+					std::fill ( &count , &atb[5] + 1 , 0.0 );
+				}
+
+				void add ( const Accumulator& other )
+				{
+					const double* from = &other.count;
+					double* to = &count;
+
+					for ( std::size_t i = 0; i < sizeof ( Accumulator ) / sizeof ( double ); ++i )
+					{
+						to[i] += from[i];
+					}
+				}
+			};
+
+			/// Pairs of one block, SoA. The target normals are only used by POINT_TO_PLANE.
+			struct Block
+			{
+				Real px[kBlock] , py[kBlock] , pz[kBlock];
+				Real qx[kBlock] , qy[kBlock] , qz[kBlock];
+				Real nx[kBlock] , ny[kBlock] , nz[kBlock];
+			};
+
+			KdTree<Real> 		tree_;
+			std::vector<Vector3> 	target_;
+			std::vector<Vector3> 	normals_;
+			Vector3 		center_;
+
+			Metric 			metric_;
+			unsigned int 		maxIterations_;
+			Real 			maxDistance_;
+			Real 			rotationTolerance_;
+			Real 			translationTolerance_;
+			Real 			errorTolerance_;
+			unsigned int 		normalNeighbours_;
+
+			unsigned int 		iterations_;
+			std::size_t 		correspondences_;
+			Real 			rms_;
+			bool 			converged_;
+			double 			elapsed_;
+
+			/// Sums of p, q and p q^T of a block of pairs.
+			static void accumulate ( const Block& block , std::size_t n , Accumulator& sum )
+			{
+				for ( std::size_t i = 0; i < n; ++i )
+				{
+					double p[3] = { block.px[i] , block.py[i] , block.pz[i] };
+					double q[3] = { block.qx[i] , block.qy[i] , block.qz[i] };
+
+					for ( int a = 0; a < 3; ++a )
+					{
+						sum.p[a] += p[a];
+						sum.q[a] += q[a];
+
+						for ( int b = 0; b < 3; ++b )
+						{
+							sum.pq[3 * a + b] += p[a] * q[b];
+						}
+					}
+				}
+			}
+
+			/// Normal equations of the linearized plane distances of a block of pairs.
+			static void accumulatePlane ( const Block& block , std::size_t n , Accumulator& sum )
+			{
+				for ( std::size_t i = 0; i < n; ++i )
+				{
+					double px = block.px[i] , py = block.py[i] , pz = block.pz[i];
+					double nx = block.nx[i] , ny = block.ny[i] , nz = block.nz[i];
+
+					// Row of the Jacobian: [ p x n , n ].
+					double a[6] = { py * nz - pz * ny , pz * nx - px * nz , px * ny - py * nx , nx , ny , nz };
+					double b = ( px - block.qx[i] ) * nx + ( py - block.qy[i] ) * ny + ( pz - block.qz[i] ) * nz;
+
+					for ( int r = 0; r < 6; ++r )
+					{
+						for ( int c = r; c < 6; ++c )
+						{
+							sum.ata[r][c] += a[r] * a[c];
+						}
+						sum.atb[r] += a[r] * b;
+					}
+				}
+			}
+
+			/// Solves the symmetric positive definite system by Cholesky, upper triangle of a is read.
+			static bool solve ( double a[6][6] , const double b[6] , double x[6] )
+			{
+				double l[6][6];
+
+				for ( int j = 0; j < 6; ++j )
+				{
+					double d = a[j][j];
+					for ( int k = 0; k < j; ++k )
+					{
+						d -= l[j][k] * l[j][k];
+					}
+
+					if ( d <= 1e-12 * std::max ( a[j][j] , 1e-300 ) )
+					{
+						return false;
+					}
+
+					l[j][j] = std::sqrt ( d );
+
+					for ( int i = j + 1; i < 6; ++i )
+					{
+						double s = a[j][i];
+						for ( int k = 0; k < j; ++k )
+						{
+							s -= l[i][k] * l[j][k];
+						}
+						l[i][j] = s / l[j][j];
+					}
+				}
+
+				double y[6];
+				for ( int i = 0; i < 6; ++i )
+				{
+					double s = b[i];
+					for ( int k = 0; k < i; ++k )
+					{
+						s -= l[i][k] * y[k];
+					}
+					y[i] = s / l[i][i];
+				}
+
+				for ( int i = 5; i >= 0; --i )
+				{
+					double s = y[i];
+					for ( int k = i + 1; k < 6; ++k )
+					{
+						s -= l[k][i] * x[k];
+					}
+					x[i] = s / l[i][i];
+				}
+
+				return true;
+			}
+
+			/// Rotation minimizing the point-to-point distances, from the centered cross-covariance h.
+			static bool solveRotation ( const Celer::Matrix3x3<double>& h , double rotation[3][3] )
+			{
+				typedef Celer::Vector3<double> Vector3d;
+
+				// H^T H = V S^2 V^T, eigenvalues in ascending order.
+				Celer::EigenSystem<double> eigen ( ( ~h ) * h );
+
+				Vector3d v0 = eigen.mEigenvector[0];
+				Vector3d v1 = eigen.mEigenvector[1];
+				Vector3d v2 = eigen.mEigenvector[2];
+
+				Vector3d u2 = h * v2;
+				Vector3d u1 = h * v1;
+
+				double s2 = u2.length ( );
+				if ( s2 <= 0.0 )
+				{
+					return false;
+				}
+				u2 /= s2;
+
+				u1 -= u2 * ( u1 * u2 );
+				double s1 = u1.length ( );
+				if ( s1 <= 1e-9 * s2 )
+				{
+					// All pairs are collinear, the rotation about that line is free.
+					return false;
+				}
+				u1 /= s1;
+
+				// Kabsch: R = V diag ( 1 , 1 , det ( V ) det ( U ) ) U^T. With U completed
+				// as a right handed basis the sign only depends on V.
+				Vector3d u0 = u1 ^ u2;
+				double d = v0 * ( v1 ^ v2 );
+
+				for ( int a = 0; a < 3; ++a )
+				{
+					for ( int b = 0; b < 3; ++b )
+					{
+						rotation[a][b] = v2[a] * u2[b] + v1[a] * u1[b] + d * v0[a] * u0[b];
+					}
+				}
+
+				return true;
+			}
+
+			void estimateNormals ( )
+			{
+				normals_.resize ( target_.size ( ) );
+				long n = static_cast<long> ( target_.size ( ) );
+
+				#pragma omp parallel
+				{
+					std::vector<unsigned int> neighbours;
+
+					#pragma omp for schedule(dynamic, 1024)
+					for ( long i = 0; i < n; ++i )
+					{
+						tree_.nearest ( target_[i] , normalNeighbours_ , neighbours );
+
+						Celer::Vector3<double> mean;
+						for ( std::size_t k = 0; k < neighbours.size ( ); ++k )
+						{
+							mean += Celer::Vector3<double> ( target_[neighbours[k]] );
+						}
+						mean /= static_cast<double> ( neighbours.size ( ) );
+
+						double c[6] = { 0.0 , 0.0 , 0.0 , 0.0 , 0.0 , 0.0 };
+						for ( std::size_t k = 0; k < neighbours.size ( ); ++k )
+						{
+							Celer::Vector3<double> d = Celer::Vector3<double> ( target_[neighbours[k]] ) - mean;
+							c[0] += d.x * d.x; c[1] += d.x * d.y; c[2] += d.x * d.z;
+							c[3] += d.y * d.y; c[4] += d.y * d.z; c[5] += d.z * d.z;
+						}
+
+						// The eigenvector of the smallest eigenvalue is the normal.
+						Celer::EigenSystem<double> eigen ( Celer::Matrix3x3<double> ( c[0] , c[1] , c[2] ,
+						                                                              c[1] , c[3] , c[4] ,
+						                                                              c[2] , c[4] , c[5] ) );
+						normals_[i] = Vector3 ( eigen.mEigenvector[0] );
+					}
+				}
+			}
+
+		public:
+
+			IterativeClosestPoint ( )
+			{
+				metric_ = POINT_TO_POINT;
+				maxIterations_ = 50;
+				maxDistance_ = std::numeric_limits<Real>::max ( );
+				rotationTolerance_ = static_cast<Real> ( 1e-5 );
+				translationTolerance_ = static_cast<Real> ( 1e-5 );
+				errorTolerance_ = static_cast<Real> ( 1e-5 );
+				normalNeighbours_ = 10;
+
+				iterations_ = 0;
+				correspondences_ = 0;
+				rms_ = static_cast<Real> ( 0 );
+				converged_ = false;
+				elapsed_ = 0.0;
+			}
+
+			/*!@brief Sets the fixed point set and builds its KdTree.
+			 * @param[in] normals Unit normals of the target, required by POINT_TO_PLANE.
+			 *            When null they are estimated from the normalNeighbours ( )
+			 *            nearest points the first time they are needed.
+			 */
+			void setTarget ( const Vector3* points , std::size_t count , const Vector3* normals = 0 )
+			{
+				target_.assign ( points , points + count );
+
+				if ( normals )
+				{
+					normals_.assign ( normals , normals + count );
+				}
+				else
+				{
+					normals_.clear ( );
+				}
+
+				Celer::Vector3<double> sum;
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					sum += Celer::Vector3<double> ( points[i] );
+				}
+				center_ = ( count != 0 ) ? Vector3 ( sum / static_cast<double> ( count ) ) : Vector3 ( );
+
+				tree_.build ( points , count );
+			}
+
+			void setTarget ( const std::vector<Vector3>& points )
+			{
+				setTarget ( points.empty ( ) ? 0 : &points[0] , points.size ( ) );
+			}
+
+			void setTarget ( const std::vector<Vector3>& points , const std::vector<Vector3>& normals )
+			{
+				assert ( points.size ( ) == normals.size ( ) );
+
+				setTarget ( points.empty ( ) ? 0 : &points[0] , points.size ( ) , normals.empty ( ) ? 0 : &normals[0] );
+			}
+
+			void setMetric ( Metric metric )
+			{
+				metric_ = metric;
+			}
+
+			Metric metric ( ) const
+			{
+				return metric_;
+			}
+
+			void setMaxIterations ( unsigned int iterations )
+			{
+				maxIterations_ = iterations;
+			}
+
+			/// Pairs farther than distance are rejected.
+			void setMaxCorrespondenceDistance ( const Real& distance )
+			{
+				maxDistance_ = distance;
+			}
+
+			/// Stops when an iteration rotates less than radians and moves less than distance.
+			void setTransformTolerance ( const Real& radians , const Real& distance )
+			{
+				rotationTolerance_ = radians;
+				translationTolerance_ = distance;
+			}
+
+			/// Stops when the RMS distance changes by less than this fraction.
+			void setErrorTolerance ( const Real& relative )
+			{
+				errorTolerance_ = relative;
+			}
+
+			void setNormalNeighbours ( unsigned int k )
+			{
+				normalNeighbours_ = k;
+			}
+
+			unsigned int normalNeighbours ( ) const
+			{
+				return normalNeighbours_;
+			}
+
+			/*!@brief Registers source onto the target.
+			 * @param[in] source Moving point set.
+			 * @param[in] count Number of source points.
+			 * @param[in,out] rotation Initial guess, then the rotation found.
+			 * @param[in,out] translation Initial guess, then the translation found.
+			 *                A source point p maps to rotation * p + translation.
+			 * @return true if a tolerance was met before maxIterations.
+			 */
+			bool align ( const Vector3* source , std::size_t count , Matrix3x3& rotation , Vector3& translation )
+			{
+				iterations_ = 0;
+				correspondences_ = 0;
+				converged_ = false;
+
+				if ( metric_ == POINT_TO_PLANE && normals_.size ( ) != target_.size ( ) )
+				{
+					estimateNormals ( );
+				}
+
+				Celer::Timer timer;
+
+				double r[3][3];
+				double t[3];
+				for ( int a = 0; a < 3; ++a )
+				{
+					for ( int b = 0; b < 3; ++b )
+					{
+						r[a][b] = rotation[a][b];
+					}
+					t[a] = translation[a];
+				}
+
+				const double c[3] = { center_.x , center_.y , center_.z };
+				const Real maxDistanceSquared = ( maxDistance_ < std::sqrt ( std::numeric_limits<Real>::max ( ) ) ) ?
+				                                maxDistance_ * maxDistance_ : std::numeric_limits<Real>::max ( );
+
+				long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+				std::vector<Accumulator> partial ( Celer::Parallel::maxThreads ( ) );
+				double previous = -1.0;
+
+				while ( iterations_ < maxIterations_ && !converged_ )
+				{
+					// Current transform, moved to the centered frame: p' = R p + ( t - c ).
+					Real rr[3][3];
+					Real tt[3];
+					for ( int a = 0; a < 3; ++a )
+					{
+						for ( int b = 0; b < 3; ++b )
+						{
+							rr[a][b] = static_cast<Real> ( r[a][b] );
+						}
+						tt[a] = static_cast<Real> ( t[a] - c[a] );
+					}
+
+					for ( std::size_t i = 0; i < partial.size ( ); ++i )
+					{
+						partial[i].clear ( );
+					}
+
+					#pragma omp parallel
+					{
+						Accumulator& sum = partial[Celer::Parallel::threadIndex ( )];
+						std::vector<Block> storage ( 1 );
+						Block& block = storage[0];
+
+						#pragma omp for schedule(dynamic, 4)
+						for ( long k = 0; k < blocks; ++k )
+						{
+							std::size_t begin = static_cast<std::size_t> ( k ) * kBlock;
+							std::size_t end = std::min ( begin + kBlock , count );
+							std::size_t n = 0;
+
+							for ( std::size_t i = begin; i < end; ++i )
+							{
+								const Vector3& s = source[i];
+								Vector3 p ( rr[0][0] * s.x + rr[0][1] * s.y + rr[0][2] * s.z + tt[0] ,
+								            rr[1][0] * s.x + rr[1][1] * s.y + rr[1][2] * s.z + tt[1] ,
+								            rr[2][0] * s.x + rr[2][1] * s.y + rr[2][2] * s.z + tt[2] );
+
+								unsigned int index;
+								Real distance;
+								if ( !tree_.nearest ( p + center_ , maxDistanceSquared , index , distance ) )
+								{
+									continue;
+								}
+
+								const Vector3& q = target_[index];
+								block.px[n] = p.x;
+								block.py[n] = p.y;
+								block.pz[n] = p.z;
+								block.qx[n] = q.x - center_.x;
+								block.qy[n] = q.y - center_.y;
+								block.qz[n] = q.z - center_.z;
+
+								if ( metric_ == POINT_TO_PLANE )
+								{
+									block.nx[n] = normals_[index].x;
+									block.ny[n] = normals_[index].y;
+									block.nz[n] = normals_[index].z;
+								}
+
+								sum.error += distance;
+								++n;
+							}
+
+							sum.count += static_cast<double> ( n );
+
+							if ( metric_ == POINT_TO_PLANE )
+							{
+								accumulatePlane ( block , n , sum );
+							}
+							else
+							{
+								accumulate ( block , n , sum );
+							}
+						}
+					}
+
+					Accumulator total;
+					total.clear ( );
+					for ( std::size_t i = 0; i < partial.size ( ); ++i )
+					{
+						total.add ( partial[i] );
+					}
+
+					++iterations_;
+					correspondences_ = static_cast<std::size_t> ( total.count );
+
+					if ( total.count < 3.0 )
+					{
+						break;
+					}
+
+					rms_ = static_cast<Real> ( std::sqrt ( total.error / total.count ) );
+
+					// Increment in the centered frame: p' -> R p' + d.
+					double increment[3][3];
+					double d[3];
+
+					if ( metric_ == POINT_TO_PLANE )
+					{
+						double x[6];
+						double rhs[6] = { -total.atb[0] , -total.atb[1] , -total.atb[2] , -total.atb[3] , -total.atb[4] , -total.atb[5] };
+
+						if ( !solve ( total.ata , rhs , x ) )
+						{
+							break;
+						}
+
+						Celer::Vector3<double> omega ( x[0] , x[1] , x[2] );
+						double angle = omega.length ( );
+						Celer::Quaternion<double> spin;
+						if ( angle > 0.0 )
+						{
+							double s = std::sin ( angle * 0.5 ) / angle;
+							spin = Celer::Quaternion<double> ( std::cos ( angle * 0.5 ) , omega.x * s , omega.y * s , omega.z * s );
+						}
+
+						Celer::Matrix3x3<double> m = spin.to3x3Matrix ( );
+						for ( int a = 0; a < 3; ++a )
+						{
+							for ( int b = 0; b < 3; ++b )
+							{
+								increment[a][b] = m[a][b];
+							}
+							d[a] = x[3 + a];
+						}
+					}
+					else
+					{
+						double inverse = 1.0 / total.count;
+						double pm[3] = { total.p[0] * inverse , total.p[1] * inverse , total.p[2] * inverse };
+						double qm[3] = { total.q[0] * inverse , total.q[1] * inverse , total.q[2] * inverse };
+
+						Celer::Matrix3x3<double> h;
+						for ( int a = 0; a < 3; ++a )
+						{
+							for ( int b = 0; b < 3; ++b )
+							{
+								h[a][b] = total.pq[3 * a + b] * inverse - pm[a] * qm[b];
+							}
+						}
+
+						if ( !solveRotation ( h , increment ) )
+						{
+							break;
+						}
+
+						for ( int a = 0; a < 3; ++a )
+						{
+							d[a] = qm[a] - ( increment[a][0] * pm[0] + increment[a][1] * pm[1] + increment[a][2] * pm[2] );
+						}
+					}
+
+					// Back to the world frame and composed with the current transform.
+					double nr[3][3];
+					double nt[3];
+					for ( int a = 0; a < 3; ++a )
+					{
+						for ( int b = 0; b < 3; ++b )
+						{
+							nr[a][b] = increment[a][0] * r[0][b] + increment[a][1] * r[1][b] + increment[a][2] * r[2][b];
+						}
+						nt[a] = increment[a][0] * ( t[0] - c[0] ) + increment[a][1] * ( t[1] - c[1] ) + increment[a][2] * ( t[2] - c[2] ) + d[a] + c[a];
+					}
+					std::copy ( &nr[0][0] , &nr[0][0] + 9 , &r[0][0] );
+					std::copy ( nt , nt + 3 , t );
+
+					double trace = increment[0][0] + increment[1][1] + increment[2][2];
+					double angle = std::acos ( std::max ( -1.0 , std::min ( 1.0 , ( trace - 1.0 ) * 0.5 ) ) );
+					double move = std::sqrt ( d[0] * d[0] + d[1] * d[1] + d[2] * d[2] );
+
+					if ( ( angle < rotationTolerance_ && move < translationTolerance_ ) ||
+					     ( previous >= 0.0 && std::fabs ( previous - rms_ ) <= errorTolerance_ * previous ) )
+					{
+						converged_ = true;
+					}
+
+					previous = rms_;
+				}
+
+				for ( int a = 0; a < 3; ++a )
+				{
+					for ( int b = 0; b < 3; ++b )
+					{
+						rotation[a][b] = static_cast<Real> ( r[a][b] );
+					}
+					translation[a] = static_cast<Real> ( t[a] );
+				}
+
+				elapsed_ = timer.elapsed ( );
+
+				return converged_;
+			}
+
+			bool align ( const std::vector<Vector3>& source , Matrix3x3& rotation , Vector3& translation )
+			{
+				return align ( source.empty ( ) ? 0 : &source[0] , source.size ( ) , rotation , translation );
+			}
+
+			/// Iterations run by the last align ( ).
+			unsigned int iterations ( ) const
+			{
+				return iterations_;
+			}
+
+			/// Pairs accepted in the last iteration.
+			std::size_t correspondences ( ) const
+			{
+				return correspondences_;
+			}
+
+			/// RMS pair distance measured in the last iteration.
+			Real rms ( ) const
+			{
+				return rms_;
+			}
+
+			bool converged ( ) const
+			{
+				return converged_;
+			}
+
+			/// Seconds spent iterating by the last align ( ), normal estimation excluded.
+			double elapsed ( ) const
+			{
+				return elapsed_;
+			}
+
+			double iterationsPerSecond ( ) const
+			{
+				return ( elapsed_ > 0.0 ) ? iterations_ / elapsed_ : 0.0;
+			}
+
+			~IterativeClosestPoint ( )
+			{
+
+			}
+	};
+
+#if defined(__SSE__)
+	/// SSE version of the point-to-point sums: 15 float lanes, flushed to double once per block.
+	template < >
+	inline void IterativeClosestPoint<float>::accumulate ( const Block& block , std::size_t n , Accumulator& sum )
+	{
+		__m128 p[3] , q[3] , pq[9];
+
+		for ( int a = 0; a < 3; ++a )
+		{
+			p[a] = q[a] = _mm_setzero_ps ( );
+		}
+		for ( int a = 0; a < 9; ++a )
+		{
+			pq[a] = _mm_setzero_ps ( );
+		}
+
+		std::size_t i = 0;
+		for ( ; i + 4 <= n; i += 4 )
+		{
+			__m128 vp[3] = { _mm_loadu_ps ( block.px + i ) , _mm_loadu_ps ( block.py + i ) , _mm_loadu_ps ( block.pz + i ) };
+			__m128 vq[3] = { _mm_loadu_ps ( block.qx + i ) , _mm_loadu_ps ( block.qy + i ) , _mm_loadu_ps ( block.qz + i ) };
+
+			for ( int a = 0; a < 3; ++a )
+			{
+				p[a] = _mm_add_ps ( p[a] , vp[a] );
+				q[a] = _mm_add_ps ( q[a] , vq[a] );
+
+				for ( int b = 0; b < 3; ++b )
+				{
+					pq[3 * a + b] = _mm_add_ps ( pq[3 * a + b] , _mm_mul_ps ( vp[a] , vq[b] ) );
+				}
+			}
+		}
+
+		float lanes[4];
+		for ( int a = 0; a < 3; ++a )
+		{
+			_mm_storeu_ps ( lanes , p[a] );
+			sum.p[a] += ( double ( lanes[0] ) + lanes[1] ) + ( double ( lanes[2] ) + lanes[3] );
+			_mm_storeu_ps ( lanes , q[a] );
+			sum.q[a] += ( double ( lanes[0] ) + lanes[1] ) + ( double ( lanes[2] ) + lanes[3] );
+		}
+		for ( int a = 0; a < 9; ++a )
+		{
+			_mm_storeu_ps ( lanes , pq[a] );
+			sum.pq[a] += ( double ( lanes[0] ) + lanes[1] ) + ( double ( lanes[2] ) + lanes[3] );
+		}
+
+		// Tail of the block.
+		for ( ; i < n; ++i )
+		{
+			double vp[3] = { block.px[i] , block.py[i] , block.pz[i] };
+			double vq[3] = { block.qx[i] , block.qy[i] , block.qz[i] };
+
+			for ( int a = 0; a < 3; ++a )
+			{
+				sum.p[a] += vp[a];
+				sum.q[a] += vq[a];
+
+				for ( int b = 0; b < 3; ++b )
+				{
+					sum.pq[3 * a + b] += vp[a] * vq[b];
+				}
+			}
+		}
+	}
+
+	/// SSE version of the point-to-plane sums: 27 float lanes , flushed to double once per block.
+	template < >
+	inline void IterativeClosestPoint<float>::accumulatePlane ( const Block& block , std::size_t n , Accumulator& sum )
+	{
+		__m128 ata[21] , atb[6];
+
+		for ( int k = 0; k < 21; ++k )
+		{
+			ata[k] = _mm_setzero_ps ( );
+		}
+		for ( int r = 0; r < 6; ++r )
+		{
+			atb[r] = _mm_setzero_ps ( );
+		}
+
+		std::size_t i = 0;
+		for ( ; i + 4 <= n; i += 4 )
+		{
+			__m128 px = _mm_loadu_ps ( block.px + i ) , py = _mm_loadu_ps ( block.py + i ) , pz = _mm_loadu_ps ( block.pz + i );
+			__m128 nx = _mm_loadu_ps ( block.nx + i ) , ny = _mm_loadu_ps ( block.ny + i ) , nz = _mm_loadu_ps ( block.nz + i );
+
+			// Row of the Jacobian: [ p x n , n ].
+			__m128 a[6] = { _mm_sub_ps ( _mm_mul_ps ( py , nz ) , _mm_mul_ps ( pz , ny ) ) ,
+			                _mm_sub_ps ( _mm_mul_ps ( pz , nx ) , _mm_mul_ps ( px , nz ) ) ,
+			                _mm_sub_ps ( _mm_mul_ps ( px , ny ) , _mm_mul_ps ( py , nx ) ) ,
+			                nx , ny , nz };
+			__m128 b = _mm_add_ps ( _mm_add_ps ( _mm_mul_ps ( _mm_sub_ps ( px , _mm_loadu_ps ( block.qx + i ) ) , nx ) ,
+			                                     _mm_mul_ps ( _mm_sub_ps ( py , _mm_loadu_ps ( block.qy + i ) ) , ny ) ) ,
+			                        _mm_mul_ps ( _mm_sub_ps ( pz , _mm_loadu_ps ( block.qz + i ) ) , nz ) );
+
+			int k = 0;
+			for ( int r = 0; r < 6; ++r )
+			{
+				for ( int c = r; c < 6; ++c )
+				{
+					ata[k] = _mm_add_ps ( ata[k] , _mm_mul_ps ( a[r] , a[c] ) );
+					++k;
+				}
+				atb[r] = _mm_add_ps ( atb[r] , _mm_mul_ps ( a[r] , b ) );
+			}
+		}
+
+		float lanes[4];
+		int k = 0;
+		for ( int r = 0; r < 6; ++r )
+		{
+			for ( int c = r; c < 6; ++c )
+			{
+				_mm_storeu_ps ( lanes , ata[k++] );
+				sum.ata[r][c] += ( double ( lanes[0] ) + lanes[1] ) + ( double ( lanes[2] ) + lanes[3] );
+			}
+			_mm_storeu_ps ( lanes , atb[r] );
+			sum.atb[r] += ( double ( lanes[0] ) + lanes[1] ) + ( double ( lanes[2] ) + lanes[3] );
+		}
+
+		// Tail of the block.
+		for ( ; i < n; ++i )
+		{
+			double px = block.px[i] , py = block.py[i] , pz = block.pz[i];
+			double nx = block.nx[i] , ny = block.ny[i] , nz = block.nz[i];
+
+			double a[6] = { py * nz - pz * ny , pz * nx - px * nz , px * ny - py * nx , nx , ny , nz };
+			double b = ( px - block.qx[i] ) * nx + ( py - block.qy[i] ) * ny + ( pz - block.qz[i] ) * nz;
+
+			for ( int r = 0; r < 6; ++r )
+			{
+				for ( int c = r; c < 6; ++c )
+				{
+					sum.ata[r][c] += a[r] * a[c];
+				}
+				sum.atb[r] += a[r] * b;
+			}
+		}
+	}
+#endif
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_ITERATIVECLOSESTPOINT_HPP_ */
@@ -0,0 +1,325 @@
+#ifndef CELER_KDTREE_HPP_
+#define CELER_KDTREE_HPP_
+
+//- Celer/Core/Geometry/PointCloud/KdTree.hpp - KdTree.hpp Module -----------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Point Cloud Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the KdTree class, a static
+//        nearest neighbour index over a Vector3 point set.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class KdTree.
+	 *@brief Static kd-tree for nearest and k-nearest neighbour queries.
+	 *@details The tree keeps its own copy of the points, sorted in leaf order, so
+	 * a query touches contiguous memory once it reaches a leaf. Nodes are split at
+	 * the median of the widest axis of their bounding box. The queries are const
+	 * and can be issued from many threads at once.
+	 */
+	template < class Real >
+	class KdTree
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+		private:
+
+			struct Node
+			{
+				unsigned int 	begin;	///< First point of the node, in leaf order.
+				unsigned int 	end;	///< One past the last point.
+				unsigned int 	right;	///< Index of the right child, the left one is the next node.
+				int 		axis;	///< Split axis, -1 for a leaf.
+				Real 		split;	///< Split coordinate.
+			};
+
+			/// Node waiting to be visited and its squared distance to the query.
+			struct Pending
+			{
+				unsigned int 	node;
+				Real 		distance;
+			};
+
+			std::vector<Node> 		nodes_;
+			std::vector<Vector3> 		points_;	///< Points in leaf order.
+			std::vector<unsigned int> 	indices_;	///< Original index of each point.
+			unsigned int 			leafSize_;
+
+			struct AxisOrder
+			{
+				const Vector3* 	points;
+				int 		axis;
+
+				bool operator ( ) ( unsigned int a , unsigned int b ) const
+				{
+					return points[a][axis] < points[b][axis];
+				}
+			};
+
+			unsigned int split ( const Vector3* points , unsigned int begin , unsigned int end )
+			{
+				unsigned int node = static_cast<unsigned int> ( nodes_.size ( ) );
+				nodes_.push_back ( Node ( ) );
+				nodes_[node].begin = begin;
+				nodes_[node].end = end;
+				nodes_[node].right = 0;
+				nodes_[node].axis = -1;
+				nodes_[node].split = static_cast<Real> ( 0 );
+
+				if ( end - begin <= leafSize_ )
+				{
+					return node;
+				}
+
+				Vector3 lower = points[indices_[begin]];
+				Vector3 upper = lower;
+
+				for ( unsigned int i = begin + 1; i < end; ++i )
+				{
+					const Vector3& p = points[indices_[i]];
+					lower.set ( std::min ( lower.x , p.x ) , std::min ( lower.y , p.y ) , std::min ( lower.z , p.z ) );
+					upper.set ( std::max ( upper.x , p.x ) , std::max ( upper.y , p.y ) , std::max ( upper.z , p.z ) );
+				}
+
+				Vector3 extent = upper - lower;
+				int axis = ( extent.x > extent.y ) ? ( ( extent.x > extent.z ) ? 0 : 2 ) : ( ( extent.y > extent.z ) ? 1 : 2 );
+
+				unsigned int middle = begin + ( end - begin ) / 2;
+				AxisOrder order = { points , axis };
+				std::nth_element ( indices_.begin ( ) + begin , indices_.begin ( ) + middle , indices_.begin ( ) + end , order );
+
+				nodes_[node].axis = axis;
+				nodes_[node].split = points[indices_[middle]][axis];
+
+				split ( points , begin , middle );
+				unsigned int right = split ( points , middle , end );
+				nodes_[node].right = right;
+
+				return node;
+			}
+
+			static Real distanceSquared ( const Vector3& a , const Vector3& b )
+			{
+				Real dx = a.x - b.x;
+				Real dy = a.y - b.y;
+				Real dz = a.z - b.z;
+
+				return dx * dx + dy * dy + dz * dz;
+			}
+
+			/// Pushes the children of node, the near one on top.
+			void descend ( unsigned int node , const Vector3& query , Pending* stack , int& top ) const
+			{
+				const Node& parent = nodes_[node];
+				Real delta = query[parent.axis] - parent.split;
+
+				Pending near;
+				Pending far;
+				near.node = ( delta < 0 ) ? node + 1 : parent.right;
+				near.distance = static_cast<Real> ( 0 );
+				far.node = ( delta < 0 ) ? parent.right : node + 1;
+				far.distance = delta * delta;
+
+				stack[top++] = far;
+				stack[top++] = near;
+			}
+
+		public:
+
+			KdTree ( )
+			{
+				leafSize_ = 8;
+			}
+
+			/*!@brief Builds the tree.
+			 * @param[in] points Point set, copied into the tree.
+			 * @param[in] count Number of points.
+			 * @param[in] leaf_size Maximum number of points in a leaf.
+			 */
+			void build ( const Vector3* points , std::size_t count , unsigned int leaf_size = 8 )
+			{
+				leafSize_ = std::max ( leaf_size , 1u );
+
+				nodes_.clear ( );
+				indices_.resize ( count );
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					indices_[i] = static_cast<unsigned int> ( i );
+				}
+
+				if ( count != 0 )
+				{
+					nodes_.reserve ( 2 * count / leafSize_ + 1 );
+					split ( points , 0 , static_cast<unsigned int> ( count ) );
+				}
+
+				points_.resize ( count );
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					points_[i] = points[indices_[i]];
+				}
+			}
+
+			void build ( const std::vector<Vector3>& points , unsigned int leaf_size = 8 )
+			{
+				build ( points.empty ( ) ? 0 : &points[0] , points.size ( ) , leaf_size );
+			}
+
+			std::size_t size ( ) const
+			{
+				return points_.size ( );
+			}
+
+			/*!@brief Nearest neighbour of query.
+			 * @param[in] query Query point.
+			 * @param[in] max_distance_squared Points this far or farther are ignored.
+			 * @param[out] index Index of the nearest point in the set given to build ( ).
+			 * @param[out] distance_squared Squared distance to it.
+			 * @return false if no point lies inside max_distance_squared.
+			 */
+			bool nearest ( const Vector3& query , Real max_distance_squared , unsigned int& index , Real& distance_squared ) const
+			{
+				if ( nodes_.empty ( ) )
+				{
+					return false;
+				}
+
+				Pending stack[128];
+				int top = 0;
+				stack[top].node = 0;
+				stack[top++].distance = static_cast<Real> ( 0 );
+
+				Real best = max_distance_squared;
+				unsigned int found = ~0u;
+
+				while ( top > 0 )
+				{
+					Pending pending = stack[--top];
+
+					if ( pending.distance >= best )
+					{
+						continue;
+					}
+
+					const Node& node = nodes_[pending.node];
+
+					if ( node.axis >= 0 )
+					{
+						descend ( pending.node , query , stack , top );
+						continue;
+					}
+
+					for ( unsigned int i = node.begin; i < node.end; ++i )
+					{
+						Real d = distanceSquared ( query , points_[i] );
+						if ( d < best )
+						{
+							best = d;
+							found = i;
+						}
+					}
+				}
+
+				if ( found == ~0u )
+				{
+					return false;
+				}
+
+				index = indices_[found];
+				distance_squared = best;
+
+				return true;
+			}
+
+			/*!@brief The k nearest neighbours of query, closest first.
+			 * @param[in] query Query point.
+			 * @param[in] k Number of neighbours.
+			 * @param[out] neighbours Indices in the set given to build ( ), at most k.
+			 */
+			void nearest ( const Vector3& query , unsigned int k , std::vector<unsigned int>& neighbours ) const
+			{
+				neighbours.clear ( );
+
+				if ( nodes_.empty ( ) || k == 0 )
+				{
+					return;
+				}
+
+				// Sorted by distance, the last one is the current k-th neighbour.
+				std::vector<std::pair<Real , unsigned int> > best;
+				best.reserve ( k + 1 );
+
+				Pending stack[128];
+				int top = 0;
+				stack[top].node = 0;
+				stack[top++].distance = static_cast<Real> ( 0 );
+
+				while ( top > 0 )
+				{
+					Pending pending = stack[--top];
+
+					if ( best.size ( ) == k && pending.distance >= best.back ( ).first )
+					{
+						continue;
+					}
+
+					const Node& node = nodes_[pending.node];
+
+					if ( node.axis >= 0 )
+					{
+						descend ( pending.node , query , stack , top );
+						continue;
+					}
+
+					for ( unsigned int i = node.begin; i < node.end; ++i )
+					{
+						Real d = distanceSquared ( query , points_[i] );
+						if ( best.size ( ) < k || d < best.back ( ).first )
+						{
+							std::pair<Real , unsigned int> entry ( d , i );
+							best.insert ( std::upper_bound ( best.begin ( ) , best.end ( ) , entry ) , entry );
+							if ( best.size ( ) > k )
+							{
+								best.pop_back ( );
+							}
+						}
+					}
+				}
+
+				neighbours.resize ( best.size ( ) );
+				for ( std::size_t i = 0; i < best.size ( ); ++i )
+				{
+					neighbours[i] = indices_[best[i].second];
+				}
+			}
+
+			~KdTree ( )
+			{
+
+			}
+	};
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_KDTREE_HPP_ */
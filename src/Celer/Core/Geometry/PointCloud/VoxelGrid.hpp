@@ -0,0 +1,457 @@
+#ifndef CELER_VOXELGRID_HPP_
+#define CELER_VOXELGRID_HPP_
+
+//- Celer/Core/Geometry/PointCloud/VoxelGrid.hpp - VoxelGrid.hpp Module -----//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Point Cloud Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the VoxelGrid class which
+//        thins point clouds and welds duplicated vertices by hashing the
+//        quantized coordinates of each point.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+/// Celer Library
+#include <Celer/Base/Parallel.hpp>
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class VoxelGrid.
+	 *@brief Voxel grid filter over Vector3 point sets.
+	 *@details The space is split in cubic cells of side leafSize ( ). Every point
+	 * is quantized to the integer coordinates of its cell, which are hashed into
+	 * an open addressing table. Each thread fills its own table over a static
+	 * chunk of the input and the tables are merged at the end, so no locking
+	 * happens while points are being hashed.
+	 *
+	 * The output is ordered by the first input point of each cell, so the result
+	 * does not depend on the number of threads.
+	 *
+	 * \code
+	 * Celer::VoxelGrid<float> grid ( 0.01f );
+	 * grid.downsample ( cloud , thinned );
+	 * std::cout << grid.throughput ( ) << " Mpoints/s" << std::endl;
+	 * \endcode
+	 *
+	 * Points which are closer than leafSize ( ) but fall on different sides of a
+	 * cell face are not merged.
+	 */
+	template < class Real >
+	class VoxelGrid
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			/// How the point which represents a cell is chosen.
+			enum Representative
+			{
+				CENTROID,	///< Average of all points in the cell.
+				FIRST_POINT	///< The point with the smallest index in the cell.
+			};
+
+		private:
+
+			struct Cell
+			{
+				int 		key[3];		///< Integer coordinates of the cell.
+				double 		sum[3];		///< Sum of the points, used by CENTROID.
+				unsigned int	count;		///< Number of points, 0 marks an empty slot.
+				unsigned int	first;		///< Smallest input index falling in the cell.
+				unsigned int	index;		///< Output index, assigned after the merge.
+			};
+
+			/// Open addressing hash table with linear probing.
+			class CellTable
+			{
+				private:
+
+					std::vector<Cell>	slots_;
+					std::size_t		mask_;
+					std::size_t		size_;
+
+					static std::size_t hash ( const int key[3] )
+					{
+						unsigned long long h = static_cast<unsigned int> ( key[0] ) * 73856093ull ^
+						                       static_cast<unsigned int> ( key[1] ) * 19349663ull ^
+						                       static_cast<unsigned int> ( key[2] ) * 83492791ull;
+						// Mix the high bits down, the table is indexed by the low ones.
+						h ^= h >> 33;
+						h *= 0xff51afd7ed558ccdull;
+						h ^= h >> 33;
+						return static_cast<std::size_t> ( h );
+					}
+
+					static bool equal ( const Cell& cell , const int key[3] )
+					{
+						return ( cell.key[0] == key[0] ) && ( cell.key[1] == key[1] ) && ( cell.key[2] == key[2] );
+					}
+
+					void rehash ( std::size_t capacity )
+					{
+						std::vector<Cell> old;
+						old.swap ( slots_ );
+						allocate ( capacity );
+
+						for ( std::size_t i = 0; i < old.size ( ); ++i )
+						{
+							if ( old[i].count != 0 )
+							{
+								slots_[probe ( old[i].key )] = old[i];
+								++size_;
+							}
+						}
+					}
+
+					void allocate ( std::size_t capacity )
+					{
+						Cell empty = Cell ( );
+						slots_.assign ( capacity , empty );
+						mask_ = capacity - 1;
+						size_ = 0;
+					}
+
+					/// Slot holding key, or the empty slot where it would go.
+					std::size_t probe ( const int key[3] ) const
+					{
+						std::size_t slot = hash ( key ) & mask_;
+
+						while ( slots_[slot].count != 0 && !equal ( slots_[slot] , key ) )
+						{
+							slot = ( slot + 1 ) & mask_;
+						}
+
+						return slot;
+					}
+
+				public:
+
+					CellTable ( )
+					{
+						allocate ( 64 );
+					}
+
+					void reserve ( std::size_t cells )
+					{
+						std::size_t capacity = 64;
+
+						while ( capacity < cells * 2 )
+						{
+							capacity *= 2;
+						}
+
+						if ( capacity > slots_.size ( ) )
+						{
+							rehash ( capacity );
+						}
+					}
+
+					/// Returns the cell of key, creating it empty if needed.
+					Cell& insert ( const int key[3] )
+					{
+						// Keep the load factor under 1/2.
+						if ( ( size_ + 1 ) * 2 > slots_.size ( ) )
+						{
+							rehash ( slots_.size ( ) * 2 );
+						}
+
+						Cell& cell = slots_[probe ( key )];
+
+						if ( cell.count == 0 )
+						{
+							cell.key[0] = key[0];
+							cell.key[1] = key[1];
+							cell.key[2] = key[2];
+							cell.sum[0] = cell.sum[1] = cell.sum[2] = 0.0;
+							cell.first = ~0u;
+							++size_;
+						}
+
+						return cell;
+					}
+
+					const Cell* find ( const int key[3] ) const
+					{
+						const Cell& cell = slots_[probe ( key )];
+
+						return ( cell.count != 0 ) ? &cell : 0;
+					}
+
+					std::size_t size ( ) const
+					{
+						return size_;
+					}
+
+					std::vector<Cell>& slots ( )
+					{
+						return slots_;
+					}
+			};
+
+			struct FirstIndexOrder
+			{
+				bool operator ( ) ( const Cell* a , const Cell* b ) const
+				{
+					return a->first < b->first;
+				}
+			};
+
+			Real 			leafSize_;
+			Representative 		representative_;
+			CellTable 		table_;
+			std::vector<Cell*> 	cells_;		///< Occupied cells in output order.
+
+			double 			elapsed_;
+			std::size_t 		processed_;
+
+			/// Truncation corrected towards minus infinity, std::floor is a call without SSE4.1.
+			static int floorToInt ( Real value )
+			{
+				int truncated = static_cast<int> ( value );
+
+				return truncated - ( value < static_cast<Real> ( truncated ) );
+			}
+
+			void quantize ( const Vector3& point , int key[3] ) const
+			{
+				Real inverse = static_cast<Real> ( 1 ) / leafSize_;
+
+				key[0] = floorToInt ( point.x * inverse );
+				key[1] = floorToInt ( point.y * inverse );
+				key[2] = floorToInt ( point.z * inverse );
+			}
+
+			/// Hashes every point and leaves the occupied cells in cells_.
+			void build ( const Vector3* points , std::size_t count )
+			{
+				int threads = Celer::Parallel::maxThreads ( );
+				std::vector<CellTable> local ( threads );
+				long n = static_cast<long> ( count );
+
+				#pragma omp parallel
+				{
+					CellTable& table = local[Celer::Parallel::threadIndex ( )];
+					table.reserve ( count / Celer::Parallel::threadCount ( ) / 4 );
+
+					#pragma omp for schedule(static)
+					for ( long i = 0; i < n; ++i )
+					{
+						int key[3];
+						quantize ( points[i] , key );
+
+						Cell& cell = table.insert ( key );
+						cell.sum[0] += points[i].x;
+						cell.sum[1] += points[i].y;
+						cell.sum[2] += points[i].z;
+						cell.count += 1;
+						cell.first = std::min ( cell.first , static_cast<unsigned int> ( i ) );
+					}
+				}
+
+				std::size_t total = 0;
+				for ( int t = 0; t < threads; ++t )
+				{
+					total += local[t].size ( );
+				}
+
+				table_ = CellTable ( );
+				table_.reserve ( total );
+
+				for ( int t = 0; t < threads; ++t )
+				{
+					std::vector<Cell>& slots = local[t].slots ( );
+
+					for ( std::size_t i = 0; i < slots.size ( ); ++i )
+					{
+						if ( slots[i].count == 0 )
+						{
+							continue;
+						}
+
+						Cell& cell = table_.insert ( slots[i].key );
+						cell.sum[0] += slots[i].sum[0];
+						cell.sum[1] += slots[i].sum[1];
+						cell.sum[2] += slots[i].sum[2];
+						cell.count += slots[i].count;
+						cell.first = std::min ( cell.first , slots[i].first );
+					}
+				}
+
+				cells_.clear ( );
+				cells_.reserve ( table_.size ( ) );
+
+				std::vector<Cell>& slots = table_.slots ( );
+				for ( std::size_t i = 0; i < slots.size ( ); ++i )
+				{
+					if ( slots[i].count != 0 )
+					{
+						cells_.push_back ( &slots[i] );
+					}
+				}
+
+				std::sort ( cells_.begin ( ) , cells_.end ( ) , FirstIndexOrder ( ) );
+
+				for ( std::size_t i = 0; i < cells_.size ( ); ++i )
+				{
+					cells_[i]->index = static_cast<unsigned int> ( i );
+				}
+			}
+
+			Vector3 pick ( const Cell& cell , const Vector3* points ) const
+			{
+				if ( representative_ == CENTROID )
+				{
+					double inverse = 1.0 / cell.count;
+
+					return Vector3 ( static_cast<Real> ( cell.sum[0] * inverse ) ,
+					                 static_cast<Real> ( cell.sum[1] * inverse ) ,
+					                 static_cast<Real> ( cell.sum[2] * inverse ) );
+				}
+
+				return points[cell.first];
+			}
+
+			void collect ( const Vector3* points , std::vector<Vector3>& output ) const
+			{
+				output.resize ( cells_.size ( ) );
+				long n = static_cast<long> ( cells_.size ( ) );
+
+				#pragma omp parallel for schedule(static)
+				for ( long i = 0; i < n; ++i )
+				{
+					output[i] = pick ( *cells_[i] , points );
+				}
+			}
+
+		public:
+
+			VoxelGrid ( const Real& leaf_size , Representative representative = CENTROID )
+			{
+				leafSize_ = leaf_size;
+				representative_ = representative;
+				elapsed_ = 0.0;
+				processed_ = 0;
+			}
+
+			void setLeafSize ( const Real& leaf_size )
+			{
+				leafSize_ = leaf_size;
+			}
+
+			Real leafSize ( ) const
+			{
+				return leafSize_;
+			}
+
+			void setRepresentative ( Representative representative )
+			{
+				representative_ = representative;
+			}
+
+			Representative representative ( ) const
+			{
+				return representative_;
+			}
+
+			/*!@brief Keeps one point per occupied cell.
+			 * @param[in] points Input point set.
+			 * @param[in] count Number of points.
+			 * @param[out] output One point per occupied cell.
+			 * @return Number of output points.
+			 */
+			std::size_t downsample ( const Vector3* points , std::size_t count , std::vector<Vector3>& output )
+			{
+				Celer::Timer timer;
+
+				build ( points , count );
+				collect ( points , output );
+
+				elapsed_ = timer.elapsed ( );
+				processed_ = count;
+
+				return output.size ( );
+			}
+
+			std::size_t downsample ( const std::vector<Vector3>& points , std::vector<Vector3>& output )
+			{
+				return downsample ( points.empty ( ) ? 0 : &points[0] , points.size ( ) , output );
+			}
+
+			/*!@brief Welds the vertices falling in the same cell.
+			 * @param[in] vertices Input vertices.
+			 * @param[in] count Number of vertices.
+			 * @param[out] welded One vertex per occupied cell.
+			 * @param[out] remap For each input vertex, the index of its welded vertex.
+			 *             Index buffers are fixed with index = remap[index].
+			 * @return Number of welded vertices.
+			 */
+			std::size_t weld ( const Vector3* vertices , std::size_t count ,
+			                   std::vector<Vector3>& welded ,
+			                   std::vector<unsigned int>& remap )
+			{
+				Celer::Timer timer;
+
+				build ( vertices , count );
+				collect ( vertices , welded );
+
+				remap.resize ( count );
+				long n = static_cast<long> ( count );
+
+				#pragma omp parallel for schedule(static)
+				for ( long i = 0; i < n; ++i )
+				{
+					int key[3];
+					quantize ( vertices[i] , key );
+					remap[i] = table_.find ( key )->index;
+				}
+
+				elapsed_ = timer.elapsed ( );
+				processed_ = count;
+
+				return welded.size ( );
+			}
+
+			std::size_t weld ( const std::vector<Vector3>& vertices ,
+			                   std::vector<Vector3>& welded ,
+			                   std::vector<unsigned int>& remap )
+			{
+				return weld ( vertices.empty ( ) ? 0 : &vertices[0] , vertices.size ( ) , welded , remap );
+			}
+
+			/// Seconds spent by the last downsample ( ) or weld ( ).
+			double elapsed ( ) const
+			{
+				return elapsed_;
+			}
+
+			/// Input points processed per second by the last call, in millions.
+			double throughput ( ) const
+			{
+				return ( elapsed_ > 0.0 ) ? ( processed_ / elapsed_ ) * 1e-6 : 0.0;
+			}
+
+			~VoxelGrid ( )
+			{
+
+			}
+	};
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_VOXELGRID_HPP_ */
@@ -1,8 +0,0 @@
-/*
- * BoundingBox3.cpp
- *
- *  Created on: Jan 6, 2011
- *      Author: fmc
- */
-
-#include <Celer/Core/Physics/BoundingBox3.hpp>
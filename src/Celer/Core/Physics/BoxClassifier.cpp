@@ -0,0 +1,7 @@
+/*
+ * BoxClassifier.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/BoxClassifier.hpp>
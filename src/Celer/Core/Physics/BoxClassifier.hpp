@@ -0,0 +1,382 @@
+#ifndef CELER_BOXCLASSIFIER_HPP_
+#define CELER_BOXCLASSIFIER_HPP_
+
+//- Celer/Core/Physics/BoxClassifier.hpp - Batched point in box tests -----//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the BoxClassifier class,
+//        point spans tested against one or many boxes at once.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class BoxClassifier.
+	 *@brief Point in box tests over point arrays.
+	 *@details The same half open test as BoundingBox3::intersect ( point ),
+	 * min <= p < max on each axis, so a point on a face shared by two cells
+	 * falls in exactly one of them. The results come as:
+	 *
+	 * - classify: one bit per point , point i in bit i % 32 of word i / 32.
+	 * - select: the indices of the points inside , in increasing order.
+	 * - classify over up to 64 boxes: one 64 bit word per point , box b in bit b.
+	 * - assign: the first box holding each point , -1 for none.
+	 *
+	 * For float four points are tested per SIMD::Float4 , loaded straight
+	 * from the packed Vector3 array. Inputs longer than one block are split
+	 * over the OpenMP threads.
+	 *
+	 * \code
+	 * std::vector<unsigned int> inside;
+	 * Celer::BoxClassifier<float>::select ( roi , &cloud[0] , cloud.size ( ) , inside );
+	 * \endcode
+	 */
+	template < class Real >
+	class BoxClassifier
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 		Vector3;
+			typedef Celer::BoundingBox3<Real> 	BoundingBox3;
+
+			/// Words of mask needed for count points.
+			static std::size_t words ( std::size_t count )
+			{
+				return ( count + 31 ) / 32;
+			}
+
+			/// Sets bit i of mask for the points inside box , returns how many.
+			static std::size_t classify ( const BoundingBox3& box , const Vector3* points , std::size_t count , unsigned int* mask );
+
+			/// Indices of the points inside box.
+			static std::size_t select ( const BoundingBox3& box , const Vector3* points , std::size_t count , std::vector<unsigned int>& indices );
+
+			/// masks[i] gets bit b set when point i is inside boxes[b]. boxCount
+			/// must be at most 64 , asserted , use assign ( ) for more.
+			static void classify ( const BoundingBox3* boxes , std::size_t boxCount , const Vector3* points , std::size_t count , unsigned long long* masks );
+
+			/// box[i] gets the index of the first box holding point i , or -1.
+			static void assign ( const BoundingBox3* boxes , std::size_t boxCount , const Vector3* points , std::size_t count , int* box );
+
+		private:
+
+			enum
+			{
+				kBlock = 4096 ,	///< Points per thread task , a multiple of 32.
+				kMaxBoxes = 64
+			};
+
+			template < class T >
+			static typename SIMD::Traits<T>::Mask inside ( const T& x , const T& y , const T& z , const T low[3] , const T high[3] )
+			{
+				return ( x >= low[0] ) & ( x < high[0] ) & ( y >= low[1] ) & ( y < high[1] ) & ( z >= low[2] ) & ( z < high[2] );
+			}
+
+			static bool inside ( const Vector3& p , const BoundingBox3& box )
+			{
+				return box.intersect ( p );
+			}
+
+			/// Points [first , last) , first a multiple of 32.
+			static std::size_t classifyRange ( const BoundingBox3& box , const Vector3* points , std::size_t first , std::size_t last , unsigned int* mask );
+			static void classifyRange ( const BoundingBox3* boxes , std::size_t boxCount , const Vector3* points , std::size_t first , std::size_t last , unsigned long long* masks );
+	};
+
+	template < class Real >
+	std::size_t BoxClassifier<Real>::classifyRange ( const BoundingBox3& box , const Vector3* points , std::size_t first , std::size_t last , unsigned int* mask )
+	{
+		std::size_t count = 0;
+
+		for ( std::size_t w = first; w < last; w += 32 )
+		{
+			std::size_t end = std::min<std::size_t> ( w + 32 , last );
+			unsigned int word = 0;
+
+			for ( std::size_t i = w; i < end; ++i )
+			{
+				if ( inside ( points[i] , box ) )
+				{
+					word |= 1u << ( i - w );
+					++count;
+				}
+			}
+			mask[w / 32] = word;
+		}
+
+		return count;
+	}
+
+	template < class Real >
+	void BoxClassifier<Real>::classifyRange ( const BoundingBox3* boxes , std::size_t boxCount , const Vector3* points , std::size_t first , std::size_t last , unsigned long long* masks )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			unsigned long long word = 0;
+
+			for ( std::size_t b = 0; b < boxCount; ++b )
+			{
+				if ( inside ( points[i] , boxes[b] ) )
+				{
+					word |= 1ULL << b;
+				}
+			}
+			masks[i] = word;
+		}
+	}
+
+	template < >
+	inline std::size_t BoxClassifier<float>::classifyRange ( const BoundingBox3& box , const Vector3* points , std::size_t first , std::size_t last , unsigned int* mask )
+	{
+		const SIMD::Float4 low[3] = { SIMD::Float4 ( box.box_min ( ).x ) , SIMD::Float4 ( box.box_min ( ).y ) , SIMD::Float4 ( box.box_min ( ).z ) };
+		const SIMD::Float4 high[3] = { SIMD::Float4 ( box.box_max ( ).x ) , SIMD::Float4 ( box.box_max ( ).y ) , SIMD::Float4 ( box.box_max ( ).z ) };
+
+		std::size_t count = 0;
+
+		for ( std::size_t w = first; w < last; w += 32 )
+		{
+			std::size_t end = std::min<std::size_t> ( w + 32 , last );
+			unsigned int word = 0;
+			std::size_t i = w;
+
+			for ( ; i + 4 <= end; i += 4 )
+			{
+				SIMD::Float4 x , y , z;
+				SIMD::loadPoints ( &points[i].x , x , y , z );
+
+				word |= static_cast<unsigned int> ( inside ( x , y , z , low , high ).bits ( ) ) << ( i - w );
+			}
+
+			for ( ; i < end; ++i )
+			{
+				if ( inside ( points[i] , box ) )
+				{
+					word |= 1u << ( i - w );
+				}
+			}
+
+			mask[w / 32] = word;
+
+			/// Bit count of the word.
+			for ( unsigned int v = word; v; v &= v - 1 )
+			{
+				++count;
+			}
+		}
+
+		return count;
+	}
+
+	template < >
+	inline void BoxClassifier<float>::classifyRange ( const BoundingBox3* boxes , std::size_t boxCount , const Vector3* points , std::size_t first , std::size_t last , unsigned long long* masks )
+	{
+		SIMD::Float4 low[kMaxBoxes][3];
+		SIMD::Float4 high[kMaxBoxes][3];
+
+		for ( std::size_t b = 0; b < boxCount; ++b )
+		{
+			for ( int k = 0; k < 3; ++k )
+			{
+				low[b][k] = SIMD::Float4 ( boxes[b].box_min ( )[k] );
+				high[b][k] = SIMD::Float4 ( boxes[b].box_max ( )[k] );
+			}
+		}
+
+		std::size_t i = first;
+
+		for ( ; i + 4 <= last; i += 4 )
+		{
+			SIMD::Float4 x , y , z;
+			SIMD::loadPoints ( &points[i].x , x , y , z );
+
+			unsigned long long lanes[4] = { 0 , 0 , 0 , 0 };
+
+			for ( std::size_t b = 0; b < boxCount; ++b )
+			{
+				int bits = inside ( x , y , z , low[b] , high[b] ).bits ( );
+
+				for ( int lane = 0; bits; ++lane , bits >>= 1 )
+				{
+					lanes[lane] |= static_cast<unsigned long long> ( bits & 1 ) << b;
+				}
+			}
+
+			masks[i] = lanes[0];
+			masks[i + 1] = lanes[1];
+			masks[i + 2] = lanes[2];
+			masks[i + 3] = lanes[3];
+		}
+
+		for ( ; i < last; ++i )
+		{
+			unsigned long long word = 0;
+
+			for ( std::size_t b = 0; b < boxCount; ++b )
+			{
+				if ( inside ( points[i] , boxes[b] ) )
+				{
+					word |= 1ULL << b;
+				}
+			}
+			masks[i] = word;
+		}
+	}
+
+	template < class Real >
+	std::size_t BoxClassifier<Real>::classify ( const BoundingBox3& box , const Vector3* points , std::size_t count , unsigned int* mask )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		long total = 0;
+
+		#pragma omp parallel for schedule(static) reduction(+:total) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			total += static_cast<long> ( classifyRange ( box , points , first , last , mask ) );
+		}
+
+		return static_cast<std::size_t> ( total );
+	}
+
+	template < class Real >
+	std::size_t BoxClassifier<Real>::select ( const BoundingBox3& box , const Vector3* points , std::size_t count , std::vector<unsigned int>& indices )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		std::vector<unsigned int> mask ( words ( count ) );
+		std::vector<std::size_t> offset ( blocks + 1 , 0 );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			offset[b + 1] = classifyRange ( box , points , first , last , &mask[0] );
+		}
+
+		for ( long b = 0; b < blocks; ++b )
+		{
+			offset[b + 1] += offset[b];
+		}
+
+		indices.resize ( offset[blocks] );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			std::size_t out = offset[b];
+
+			for ( std::size_t w = first; w < last; w += 32 )
+			{
+				unsigned int word = mask[w / 32];
+
+				for ( unsigned int i = static_cast<unsigned int> ( w ); word; ++i , word >>= 1 )
+				{
+					if ( word & 1u )
+					{
+						indices[out++] = i;
+					}
+				}
+			}
+		}
+
+		return indices.size ( );
+	}
+
+	template < class Real >
+	void BoxClassifier<Real>::classify ( const BoundingBox3* boxes , std::size_t boxCount , const Vector3* points , std::size_t count , unsigned long long* masks )
+	{
+		/// More boxes do not fit the mask , assign ( ) takes any number.
+		assert ( boxCount <= kMaxBoxes );
+
+		/// Release builds must still not write past the kernel's box arrays.
+		boxCount = std::min<std::size_t> ( boxCount , kMaxBoxes );
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			classifyRange ( boxes , boxCount , points , first , last , masks );
+		}
+	}
+
+	template < class Real >
+	void BoxClassifier<Real>::assign ( const BoundingBox3* boxes , std::size_t boxCount , const Vector3* points , std::size_t count , int* box )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			std::fill ( box + first , box + last , -1 );
+
+			/// Groups of 64 boxes , the first group holding a point wins.
+			std::vector<unsigned long long> masks ( last - first );
+
+			for ( std::size_t group = 0; group < boxCount; group += kMaxBoxes )
+			{
+				std::size_t size = std::min<std::size_t> ( boxCount - group , kMaxBoxes );
+				classifyRange ( boxes + group , size , points + first , 0 , last - first , &masks[0] );
+
+				bool pending = false;
+
+				for ( std::size_t i = first; i < last; ++i )
+				{
+					if ( box[i] >= 0 )
+					{
+						continue;
+					}
+
+					unsigned long long word = masks[i - first];
+
+					if ( word == 0 )
+					{
+						pending = true;
+						continue;
+					}
+
+					int k = 0;
+					while ( !( word & 1ULL ) )
+					{
+						word >>= 1;
+						++k;
+					}
+					box[i] = static_cast<int> ( group ) + k;
+				}
+
+				if ( !pending )
+				{
+					break;
+				}
+			}
+		}
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_BOXCLASSIFIER_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * ContactSolver.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/ContactSolver.hpp>
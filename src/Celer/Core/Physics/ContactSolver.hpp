@@ -0,0 +1,842 @@
+#ifndef CELER_CONTACTSOLVER_HPP_
+#define CELER_CONTACTSOLVER_HPP_
+
+//- Celer/Core/Physics/ContactSolver.hpp - Sequential impulse solver ------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the ContactSolver class, a
+//        sequential impulse solver over islands of touching bodies.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix3x3.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Physics/RigidBodySystem.hpp>
+#include <Celer/Core/Physics/Narrowphase.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class ContactSolver.
+	 *@brief Sequential impulse contact solver with friction and warm starting.
+	 *@details Contacts are added every step and solve ( ) changes the
+	 * velocities of a RigidBodySystem so they stop approaching. Call it after
+	 * the forces of the step are applied and before RigidBodySystem::integrate:
+	 * the solver works on the velocities the step will end with and takes the
+	 * forces out again , so integrate ( ) arrives at the constrained ones.
+	 *
+	 * Scheduling:
+	 * - Islands: bodies joined through contacts , by union find. Static bodies
+	 *   do not join islands, the floor does not make one island of a scene.
+	 * - Islands with few contacts are solved whole , one per thread.
+	 * - Contacts of large islands are coloured so no two of a colour share a
+	 *   dynamic body. A colour is solved in parallel without locks, and for
+	 *   float four contacts at a time in the lanes of SIMD::Float4.
+	 *
+	 * The per contact data is stored one array per field in solving order, so
+	 * the lanes load with one instruction. The impulses of a step are kept by
+	 * body pair and feature to start the next step with , which takes body
+	 * indices below kMaxBodies.
+	 */
+	template < class Real >
+	class ContactSolver
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 				Vector3;
+			typedef Celer::Matrix3x3<Real> 				Matrix3x3;
+			typedef Celer::RigidBodySystem<Real> 		RigidBodySystem;
+			typedef typename Narrowphase<Real>::Contact Contact;
+
+			/// Body indices fit 24 bits of the warm start key.
+			enum
+			{
+				kMaxBodies = 1 << 24
+			};
+
+			struct ContactPoint
+			{
+				unsigned int 	bodyA;
+				unsigned int 	bodyB;
+				unsigned int 	feature;	///< Tells apart the points of one pair between steps.
+				Vector3 		point;		///< World position.
+				Vector3 		normal;		///< From A to B.
+				Real 			separation;	///< Negative when penetrating.
+			};
+
+			/// Seconds spent per phase in the last solve ( ).
+			struct Timings
+			{
+				double islands;
+				double colouring;
+				double prepare;
+				double warmStart;
+				double iterations;
+				double store;
+			};
+
+			ContactSolver ( int iterations = 8 );
+
+			/// Contacts of the coming solve ( ).
+			void clear ( )
+			{
+				input_.clear ( );
+			}
+
+			void add ( const ContactPoint& contact )
+			{
+				input_.push_back ( contact );
+			}
+
+			/// A Narrowphase result between two bodies.
+			void add ( unsigned int bodyA , unsigned int bodyB , const Contact& contact , unsigned int feature = 0 )
+			{
+				ContactPoint c;
+				c.bodyA = bodyA;
+				c.bodyB = bodyB;
+				c.feature = feature;
+				c.point = ( contact.pointA + contact.pointB ) * static_cast<Real> ( 0.5 );
+				c.normal = contact.normal;
+				c.separation = contact.distance;
+				input_.push_back ( c );
+			}
+
+			void solve ( RigidBodySystem& bodies , Real dt );
+
+			void setIterations ( int iterations )
+			{
+				iterations_ = iterations;
+			}
+
+			/// Coulomb friction coefficient of every contact.
+			void setFriction ( Real friction )
+			{
+				friction_ = friction;
+			}
+
+			void setRestitution ( Real restitution )
+			{
+				restitution_ = restitution;
+			}
+
+			/// Fraction of the penetration beyond slop removed per step.
+			void setBaumgarte ( Real factor , Real slop )
+			{
+				baumgarte_ = factor;
+				slop_ = slop;
+			}
+
+			const Timings& timings ( ) const
+			{
+				return timings_;
+			}
+
+			std::size_t islands ( ) const
+			{
+				return islandCount_;
+			}
+
+			std::size_t colours ( ) const
+			{
+				return colourCount_;
+			}
+
+		private:
+
+			/// Field layout , kRowFields per solver row: the normal and two tangents.
+			enum
+			{
+				kDirection = 0 ,
+				kAngularA = 3 ,
+				kAngularB = 6 ,
+				kInertiaA = 9 ,
+				kInertiaB = 12 ,
+				kMass = 15 ,
+				kImpulse = 16 ,
+				kRowFields = 17 ,
+				kInverseMassA = 3 * kRowFields ,
+				kInverseMassB ,
+				kBias ,
+				kFriction ,
+				kFields
+			};
+
+			enum
+			{
+				kLargeIsland = 128 ,
+				kMaxColours = 64 ,
+				kBatch = 64
+			};
+
+			struct Range
+			{
+				std::size_t first;
+				std::size_t last;
+			};
+
+			struct Cached
+			{
+				unsigned long long 	key;
+				Real 				impulse[3];
+
+				bool operator< ( const Cached& other ) const
+				{
+					return key < other.key;
+				}
+			};
+
+			static unsigned long long key ( const ContactPoint& c )
+			{
+				/// Larger indices would mix up the impulses of different pairs.
+				assert ( c.bodyA < static_cast<unsigned int> ( kMaxBodies ) && c.bodyB < static_cast<unsigned int> ( kMaxBodies ) );
+				return ( static_cast<unsigned long long> ( c.bodyA ) << 40 ) | ( static_cast<unsigned long long> ( c.bodyB ) << 16 ) | ( c.feature & 0xFFFF );
+			}
+
+			Real* field ( int f )
+			{
+				return &data_[static_cast<std::size_t> ( f ) * stride_];
+			}
+
+			/// Lanes of a field , one value for scalars and four for Float4.
+			static void fetchLanes ( const Real* p , Real& out )
+			{
+				out = *p;
+			}
+
+			static void fetchLanes ( const float* p , SIMD::Float4& out )
+			{
+				out = SIMD::Float4::load ( p );
+			}
+
+			static void storeLanes ( Real* p , const Real& value )
+			{
+				*p = value;
+			}
+
+			static void storeLanes ( float* p , const SIMD::Float4& value )
+			{
+				value.store ( p );
+			}
+
+			std::size_t find ( std::size_t body );
+
+			void schedule ( const RigidBodySystem& bodies );
+			void prepare ( const RigidBodySystem& bodies , Real dt );
+
+			void warmStart ( std::size_t first , std::size_t last );
+
+			template < class T >
+			void kernel ( std::size_t i , T vA[3] , T wA[3] , T vB[3] , T wB[3] );
+
+			void solveSerial ( std::size_t first , std::size_t last );
+			void solveBatch ( std::size_t first , std::size_t last );
+
+			std::vector<ContactPoint> 	input_;
+
+			/// Contacts in solving order and their fields.
+			std::vector<ContactPoint> 	contacts_;
+			std::vector<Real> 			data_;
+			std::size_t 				stride_;
+
+			std::vector<Range> 			smallIslands_;
+			std::vector<Range> 			colourRanges_;
+			Range 						overflow_;
+
+			std::vector<std::size_t> 	parent_;
+			std::vector<Cached> 		cache_;
+
+			Vector3* 					linear_;
+			Vector3* 					angular_;
+			const Real* 				inverseMass_;
+
+			int 		iterations_;
+			Real 		friction_;
+			Real 		restitution_;
+			Real 		baumgarte_;
+			Real 		slop_;
+			std::size_t islandCount_;
+			std::size_t colourCount_;
+			Timings 	timings_;
+	};
+
+	template < class Real >
+	ContactSolver<Real>::ContactSolver ( int iterations ) :
+		stride_ ( 0 ) , linear_ ( 0 ) , angular_ ( 0 ) , inverseMass_ ( 0 ) ,
+		iterations_ ( iterations ) , friction_ ( static_cast<Real> ( 0.5 ) ) , restitution_ ( 0 ) ,
+		baumgarte_ ( static_cast<Real> ( 0.2 ) ) , slop_ ( static_cast<Real> ( 0.005 ) ) ,
+		islandCount_ ( 0 ) , colourCount_ ( 0 )
+	{
+		overflow_.first = overflow_.last = 0;
+		timings_.islands = timings_.colouring = timings_.prepare = 0.0;
+		timings_.warmStart = timings_.iterations = timings_.store = 0.0;
+	}
+
+	template < class Real >
+	std::size_t ContactSolver<Real>::find ( std::size_t body )
+	{
+		while ( parent_[body] != body )
+		{
+			parent_[body] = parent_[parent_[body]];
+			body = parent_[body];
+		}
+		return body;
+	}
+
+	template < class Real >
+	void ContactSolver<Real>::schedule ( const RigidBodySystem& bodies )
+	{
+		Celer::Timer timer;
+
+		const std::vector<Real>& inverseMass = bodies.inverseMasses ( );
+		std::size_t bodyCount = bodies.size ( );
+
+		/// Islands over the dynamic bodies.
+		parent_.resize ( bodyCount );
+		for ( std::size_t b = 0; b < bodyCount; ++b )
+		{
+			parent_[b] = b;
+		}
+
+		std::vector<ContactPoint> active;
+		active.reserve ( input_.size ( ) );
+
+		for ( std::size_t i = 0; i < input_.size ( ); ++i )
+		{
+			const ContactPoint& c = input_[i];
+			bool dynamicA = inverseMass[c.bodyA] > static_cast<Real> ( 0 );
+			bool dynamicB = inverseMass[c.bodyB] > static_cast<Real> ( 0 );
+
+			if ( dynamicA && dynamicB )
+			{
+				std::size_t ra = find ( c.bodyA );
+				std::size_t rb = find ( c.bodyB );
+				if ( ra != rb )
+				{
+					parent_[std::max ( ra , rb )] = std::min ( ra , rb );
+				}
+			}
+			if ( dynamicA || dynamicB )
+			{
+				active.push_back ( c );
+			}
+		}
+
+		/// Counting sort of the contacts by island root.
+		std::vector<std::size_t> island ( active.size ( ) );
+		std::vector<std::size_t> count ( bodyCount + 1 , 0 );
+
+		for ( std::size_t i = 0; i < active.size ( ); ++i )
+		{
+			std::size_t body = ( inverseMass[active[i].bodyA] > static_cast<Real> ( 0 ) ) ? active[i].bodyA : active[i].bodyB;
+			island[i] = find ( body );
+			++count[island[i] + 1];
+		}
+		for ( std::size_t b = 0; b < bodyCount; ++b )
+		{
+			count[b + 1] += count[b];
+		}
+
+		std::vector<ContactPoint> grouped ( active.size ( ) );
+		std::vector<std::size_t> offset ( count.begin ( ) , count.end ( ) - 1 );
+		for ( std::size_t i = 0; i < active.size ( ); ++i )
+		{
+			grouped[offset[island[i]]++] = active[i];
+		}
+
+		/// Small islands keep their ranges , large ones go to colouring.
+		contacts_.clear ( );
+		contacts_.reserve ( grouped.size ( ) );
+		smallIslands_.clear ( );
+		islandCount_ = 0;
+
+		std::vector<ContactPoint> large;
+		for ( std::size_t b = 0; b < bodyCount; ++b )
+		{
+			std::size_t size = count[b + 1] - count[b];
+			if ( size == 0 )
+			{
+				continue;
+			}
+			++islandCount_;
+
+			if ( size < kLargeIsland )
+			{
+				Range range;
+				range.first = contacts_.size ( );
+				contacts_.insert ( contacts_.end ( ) , grouped.begin ( ) + count[b] , grouped.begin ( ) + count[b + 1] );
+				range.last = contacts_.size ( );
+				smallIslands_.push_back ( range );
+			}
+			else
+			{
+				large.insert ( large.end ( ) , grouped.begin ( ) + count[b] , grouped.begin ( ) + count[b + 1] );
+			}
+		}
+
+		timings_.islands = timer.lap ( );
+
+		/// Greedy colouring , one bit per colour used by each dynamic body.
+		std::vector<unsigned long long> used ( bodyCount , 0 );
+		std::vector<int> colour ( large.size ( ) );
+		std::vector<std::size_t> colourCount ( kMaxColours + 1 , 0 );
+
+		for ( std::size_t i = 0; i < large.size ( ); ++i )
+		{
+			const ContactPoint& c = large[i];
+			unsigned long long taken = used[c.bodyA] | used[c.bodyB];
+
+			int k = 0;
+			while ( k < kMaxColours && ( taken & ( 1ULL << k ) ) )
+			{
+				++k;
+			}
+			colour[i] = k;
+			++colourCount[k];
+
+			if ( k < kMaxColours )
+			{
+				used[c.bodyA] |= ( inverseMass[c.bodyA] > static_cast<Real> ( 0 ) ) ? ( 1ULL << k ) : 0ULL;
+				used[c.bodyB] |= ( inverseMass[c.bodyB] > static_cast<Real> ( 0 ) ) ? ( 1ULL << k ) : 0ULL;
+			}
+		}
+
+		std::vector<std::size_t> colourOffset ( kMaxColours + 1 );
+		std::size_t base = contacts_.size ( );
+		colourRanges_.clear ( );
+		for ( int k = 0; k <= kMaxColours; ++k )
+		{
+			colourOffset[k] = base;
+			Range range;
+			range.first = base;
+			range.last = base + colourCount[k];
+			if ( k < kMaxColours && range.last > range.first )
+			{
+				colourRanges_.push_back ( range );
+			}
+			else if ( k == kMaxColours )
+			{
+				/// Contacts that ran out of colours are solved in order.
+				overflow_ = range;
+			}
+			base = range.last;
+		}
+		colourCount_ = colourRanges_.size ( );
+
+		contacts_.resize ( base );
+		for ( std::size_t i = 0; i < large.size ( ); ++i )
+		{
+			contacts_[colourOffset[colour[i]]++] = large[i];
+		}
+
+		timings_.colouring = timer.lap ( );
+	}
+
+	template < class Real >
+	void ContactSolver<Real>::prepare ( const RigidBodySystem& bodies , Real dt )
+	{
+		const std::vector<Vector3>& position = bodies.positions ( );
+		const std::vector<Real>& inverseMass = bodies.inverseMasses ( );
+		const std::vector<Matrix3x3>& inverseInertia = bodies.inverseInertias ( );
+
+		/// Padded to whole lanes so SIMD loads past the end stay inside.
+		stride_ = ( contacts_.size ( ) + 3 ) & ~static_cast<std::size_t> ( 3 );
+		data_.assign ( static_cast<std::size_t> ( kFields ) * stride_ , static_cast<Real> ( 0 ) );
+
+		long n = static_cast<long> ( contacts_.size ( ) );
+
+		#pragma omp parallel for schedule(static)
+		for ( long i = 0; i < n; ++i )
+		{
+			const ContactPoint& c = contacts_[i];
+
+			Vector3 rA = c.point - position[c.bodyA];
+			Vector3 rB = c.point - position[c.bodyB];
+			Real massA = inverseMass[c.bodyA];
+			Real massB = inverseMass[c.bodyB];
+
+			/// Tangents from the axis least aligned with the normal.
+			Vector3 n = c.normal;
+			Vector3 axis = ( std::fabs ( n.x ) < static_cast<Real> ( 0.57735 ) ) ? Vector3 ( 1 , 0 , 0 ) : Vector3 ( 0 , 1 , 0 );
+			Vector3 t1 = n ^ axis;
+			t1 /= std::sqrt ( t1 * t1 );
+			Vector3 t2 = n ^ t1;
+
+			const Vector3 direction[3] = { n , t1 , t2 };
+
+			/// Impulses of the same point in the previous step.
+			Cached probe;
+			probe.key = key ( c );
+			typename std::vector<Cached>::const_iterator hit = std::lower_bound ( cache_.begin ( ) , cache_.end ( ) , probe );
+			bool warm = hit != cache_.end ( ) && hit->key == probe.key;
+
+			for ( int r = 0; r < 3; ++r )
+			{
+				const Vector3& d = direction[r];
+				Vector3 angularA = rA ^ d;
+				Vector3 angularB = rB ^ d;
+				/// Static bodies do not turn , whatever inertia they were given.
+				Vector3 inertiaA = ( massA > static_cast<Real> ( 0 ) ) ? inverseInertia[c.bodyA] * angularA : Vector3 ( 0 , 0 , 0 );
+				Vector3 inertiaB = ( massB > static_cast<Real> ( 0 ) ) ? inverseInertia[c.bodyB] * angularB : Vector3 ( 0 , 0 , 0 );
+
+				Real k = massA + massB + angularA * inertiaA + angularB * inertiaB;
+
+				int row = r * kRowFields;
+				for ( int a = 0; a < 3; ++a )
+				{
+					field ( row + kDirection + a )[i] = d[a];
+					field ( row + kAngularA + a )[i] = angularA[a];
+					field ( row + kAngularB + a )[i] = angularB[a];
+					field ( row + kInertiaA + a )[i] = inertiaA[a];
+					field ( row + kInertiaB + a )[i] = inertiaB[a];
+				}
+				field ( row + kMass )[i] = ( k > static_cast<Real> ( 0 ) ) ? static_cast<Real> ( 1 ) / k : static_cast<Real> ( 0 );
+				field ( row + kImpulse )[i] = warm ? hit->impulse[r] : static_cast<Real> ( 0 );
+			}
+
+			field ( kInverseMassA )[i] = massA;
+			field ( kInverseMassB )[i] = massB;
+			field ( kFriction )[i] = friction_;
+
+			/// Push out of penetration beyond slop , or bounce when approaching fast.
+			Real bias = baumgarte_ / dt * std::max ( -c.separation - slop_ , static_cast<Real> ( 0 ) );
+
+			Vector3 velocityA = linear_[c.bodyA] + ( angular_[c.bodyA] ^ rA );
+			Vector3 velocityB = linear_[c.bodyB] + ( angular_[c.bodyB] ^ rB );
+			Real approach = ( velocityB - velocityA ) * n;
+			if ( approach < -static_cast<Real> ( 1 ) )
+			{
+				bias = std::max ( bias , -restitution_ * approach );
+			}
+			field ( kBias )[i] = bias;
+		}
+	}
+
+	template < class Real >
+	void ContactSolver<Real>::warmStart ( std::size_t first , std::size_t last )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			const ContactPoint& c = contacts_[i];
+			Real massA = field ( kInverseMassA )[i];
+			Real massB = field ( kInverseMassB )[i];
+
+			for ( int r = 0; r < 3; ++r )
+			{
+				int row = r * kRowFields;
+				Real impulse = field ( row + kImpulse )[i];
+
+				/// Static bodies are shared between threads and stay untouched.
+				for ( int a = 0; a < 3; ++a )
+				{
+					Real d = field ( row + kDirection + a )[i] * impulse;
+					if ( massA > static_cast<Real> ( 0 ) )
+					{
+						linear_[c.bodyA][a] -= d * massA;
+						angular_[c.bodyA][a] -= field ( row + kInertiaA + a )[i] * impulse;
+					}
+					if ( massB > static_cast<Real> ( 0 ) )
+					{
+						linear_[c.bodyB][a] += d * massB;
+						angular_[c.bodyB][a] += field ( row + kInertiaB + a )[i] * impulse;
+					}
+				}
+			}
+		}
+	}
+
+	/// Normal then friction rows of the contacts at i , body velocities given.
+	template < class Real >
+	template < class T >
+	inline void ContactSolver<Real>::kernel ( std::size_t i , T vA[3] , T wA[3] , T vB[3] , T wB[3] )
+	{
+		T massA;
+		T massB;
+		T normalImpulse;
+		fetchLanes ( field ( kInverseMassA ) + i , massA );
+		fetchLanes ( field ( kInverseMassB ) + i , massB );
+
+		for ( int r = 0; r < 3; ++r )
+		{
+			int row = r * kRowFields;
+
+			T d[3];
+			T relative ( static_cast<Real> ( 0 ) );
+			for ( int a = 0; a < 3; ++a )
+			{
+				T angularA;
+				T angularB;
+				fetchLanes ( field ( row + kDirection + a ) + i , d[a] );
+				fetchLanes ( field ( row + kAngularA + a ) + i , angularA );
+				fetchLanes ( field ( row + kAngularB + a ) + i , angularB );
+				relative += d[a] * ( vB[a] - vA[a] ) + angularB * wB[a] - angularA * wA[a];
+			}
+
+			T mass;
+			T old;
+			fetchLanes ( field ( row + kMass ) + i , mass );
+			fetchLanes ( field ( row + kImpulse ) + i , old );
+
+			T impulse;
+			if ( r == 0 )
+			{
+				T bias;
+				fetchLanes ( field ( kBias ) + i , bias );
+				impulse = SIMD::max ( old + mass * ( bias - relative ) , T ( static_cast<Real> ( 0 ) ) );
+				normalImpulse = impulse;
+			}
+			else
+			{
+				T friction;
+				fetchLanes ( field ( kFriction ) + i , friction );
+				T limit = friction * normalImpulse;
+				impulse = SIMD::min ( SIMD::max ( old - mass * relative , -limit ) , limit );
+			}
+			storeLanes ( field ( row + kImpulse ) + i , impulse );
+
+			T delta = impulse - old;
+			for ( int a = 0; a < 3; ++a )
+			{
+				T inertiaA;
+				T inertiaB;
+				fetchLanes ( field ( row + kInertiaA + a ) + i , inertiaA );
+				fetchLanes ( field ( row + kInertiaB + a ) + i , inertiaB );
+
+				vA[a] -= d[a] * delta * massA;
+				vB[a] += d[a] * delta * massB;
+				wA[a] -= inertiaA * delta;
+				wB[a] += inertiaB * delta;
+			}
+		}
+	}
+
+	template < class Real >
+	void ContactSolver<Real>::solveSerial ( std::size_t first , std::size_t last )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			const ContactPoint& c = contacts_[i];
+			Vector3& la = linear_[c.bodyA];
+			Vector3& aa = angular_[c.bodyA];
+			Vector3& lb = linear_[c.bodyB];
+			Vector3& ab = angular_[c.bodyB];
+
+			Real vA[3] = { la.x , la.y , la.z };
+			Real wA[3] = { aa.x , aa.y , aa.z };
+			Real vB[3] = { lb.x , lb.y , lb.z };
+			Real wB[3] = { ab.x , ab.y , ab.z };
+
+			kernel<Real> ( i , vA , wA , vB , wB );
+
+			if ( inverseMass_[c.bodyA] > static_cast<Real> ( 0 ) )
+			{
+				la = Vector3 ( vA[0] , vA[1] , vA[2] );
+				aa = Vector3 ( wA[0] , wA[1] , wA[2] );
+			}
+			if ( inverseMass_[c.bodyB] > static_cast<Real> ( 0 ) )
+			{
+				lb = Vector3 ( vB[0] , vB[1] , vB[2] );
+				ab = Vector3 ( wB[0] , wB[1] , wB[2] );
+			}
+		}
+	}
+
+	template < class Real >
+	void ContactSolver<Real>::solveBatch ( std::size_t first , std::size_t last )
+	{
+		solveSerial ( first , last );
+	}
+
+	/// Contacts of one colour share no dynamic body , four go in the lanes.
+	template < >
+	inline void ContactSolver<float>::solveBatch ( std::size_t first , std::size_t last )
+	{
+		std::size_t i = first;
+
+		for ( ; i + 4 <= last; i += 4 )
+		{
+			SIMD::Float4 vA[3];
+			SIMD::Float4 wA[3];
+			SIMD::Float4 vB[3];
+			SIMD::Float4 wB[3];
+
+			const ContactPoint* c = &contacts_[i];
+			for ( int a = 0; a < 3; ++a )
+			{
+				vA[a] = SIMD::Float4 ( linear_[c[0].bodyA][a] , linear_[c[1].bodyA][a] , linear_[c[2].bodyA][a] , linear_[c[3].bodyA][a] );
+				wA[a] = SIMD::Float4 ( angular_[c[0].bodyA][a] , angular_[c[1].bodyA][a] , angular_[c[2].bodyA][a] , angular_[c[3].bodyA][a] );
+				vB[a] = SIMD::Float4 ( linear_[c[0].bodyB][a] , linear_[c[1].bodyB][a] , linear_[c[2].bodyB][a] , linear_[c[3].bodyB][a] );
+				wB[a] = SIMD::Float4 ( angular_[c[0].bodyB][a] , angular_[c[1].bodyB][a] , angular_[c[2].bodyB][a] , angular_[c[3].bodyB][a] );
+			}
+
+			kernel<SIMD::Float4> ( i , vA , wA , vB , wB );
+
+			float lanes[12][4];
+			for ( int a = 0; a < 3; ++a )
+			{
+				vA[a].store ( lanes[a] );
+				wA[a].store ( lanes[3 + a] );
+				vB[a].store ( lanes[6 + a] );
+				wB[a].store ( lanes[9 + a] );
+			}
+
+			for ( int lane = 0; lane < 4; ++lane )
+			{
+				if ( inverseMass_[c[lane].bodyA] > 0.0f )
+				{
+					linear_[c[lane].bodyA] = Vector3 ( lanes[0][lane] , lanes[1][lane] , lanes[2][lane] );
+					angular_[c[lane].bodyA] = Vector3 ( lanes[3][lane] , lanes[4][lane] , lanes[5][lane] );
+				}
+				if ( inverseMass_[c[lane].bodyB] > 0.0f )
+				{
+					linear_[c[lane].bodyB] = Vector3 ( lanes[6][lane] , lanes[7][lane] , lanes[8][lane] );
+					angular_[c[lane].bodyB] = Vector3 ( lanes[9][lane] , lanes[10][lane] , lanes[11][lane] );
+				}
+			}
+		}
+
+		solveSerial ( i , last );
+	}
+
+	template < class Real >
+	void ContactSolver<Real>::solve ( RigidBodySystem& bodies , Real dt )
+	{
+		Celer::Timer timer;
+
+		schedule ( bodies );
+
+		timer.start ( );
+
+		std::vector<Vector3>& linear = bodies.linearVelocities ( );
+		std::vector<Vector3>& angular = bodies.angularVelocities ( );
+		const std::vector<Real>& inverseMass = bodies.inverseMasses ( );
+		const std::vector<Matrix3x3>& inverseInertia = bodies.inverseInertias ( );
+		const std::vector<Vector3>& force = bodies.forces ( );
+		const std::vector<Vector3>& torque = bodies.torques ( );
+
+		if ( linear.empty ( ) )
+		{
+			return;
+		}
+
+		linear_ = &linear[0];
+		angular_ = &angular[0];
+		inverseMass_ = &inverseMass[0];
+
+		/// Velocities the step will end with before contacts , taken out again below.
+		long bodyCount = static_cast<long> ( bodies.size ( ) );
+		std::vector<Vector3> external ( bodies.size ( ) );
+		std::vector<Vector3> externalAngular ( bodies.size ( ) );
+
+		#pragma omp parallel for schedule(static)
+		for ( long b = 0; b < bodyCount; ++b )
+		{
+			if ( inverseMass[b] > static_cast<Real> ( 0 ) )
+			{
+				external[b] = ( bodies.gravity ( ) + force[b] * inverseMass[b] ) * dt;
+				externalAngular[b] = inverseInertia[b] * torque[b] * dt;
+				linear[b] += external[b];
+				angular[b] += externalAngular[b];
+			}
+		}
+
+		prepare ( bodies , dt );
+		timings_.prepare = timer.lap ( );
+
+		long small = static_cast<long> ( smallIslands_.size ( ) );
+
+		#pragma omp parallel for schedule(dynamic, 16)
+		for ( long s = 0; s < small; ++s )
+		{
+			warmStart ( smallIslands_[s].first , smallIslands_[s].last );
+		}
+		for ( std::size_t k = 0; k < colourRanges_.size ( ); ++k )
+		{
+			const Range& range = colourRanges_[k];
+			long batches = static_cast<long> ( ( range.last - range.first + kBatch - 1 ) / kBatch );
+
+			#pragma omp parallel for schedule(static)
+			for ( long b = 0; b < batches; ++b )
+			{
+				std::size_t first = range.first + static_cast<std::size_t> ( b ) * kBatch;
+				warmStart ( first , std::min<std::size_t> ( first + kBatch , range.last ) );
+			}
+		}
+		warmStart ( overflow_.first , overflow_.last );
+
+		timings_.warmStart = timer.lap ( );
+
+		/// Small islands run all their iterations independently.
+		#pragma omp parallel for schedule(dynamic, 16)
+		for ( long s = 0; s < small; ++s )
+		{
+			for ( int iteration = 0; iteration < iterations_; ++iteration )
+			{
+				solveSerial ( smallIslands_[s].first , smallIslands_[s].last );
+			}
+		}
+
+		for ( int iteration = 0; iteration < iterations_; ++iteration )
+		{
+			for ( std::size_t k = 0; k < colourRanges_.size ( ); ++k )
+			{
+				const Range& range = colourRanges_[k];
+				long batches = static_cast<long> ( ( range.last - range.first + kBatch - 1 ) / kBatch );
+
+				#pragma omp parallel for schedule(static)
+				for ( long b = 0; b < batches; ++b )
+				{
+					std::size_t first = range.first + static_cast<std::size_t> ( b ) * kBatch;
+					solveBatch ( first , std::min<std::size_t> ( first + kBatch , range.last ) );
+				}
+			}
+			solveSerial ( overflow_.first , overflow_.last );
+		}
+
+		timings_.iterations = timer.lap ( );
+
+		#pragma omp parallel for schedule(static)
+		for ( long b = 0; b < bodyCount; ++b )
+		{
+			if ( inverseMass[b] > static_cast<Real> ( 0 ) )
+			{
+				linear[b] -= external[b];
+				angular[b] -= externalAngular[b];
+			}
+		}
+
+		/// Impulses for the next step , sorted by key for lookup.
+		cache_.resize ( contacts_.size ( ) );
+		for ( std::size_t i = 0; i < contacts_.size ( ); ++i )
+		{
+			cache_[i].key = key ( contacts_[i] );
+			for ( int r = 0; r < 3; ++r )
+			{
+				cache_[i].impulse[r] = field ( r * kRowFields + kImpulse )[i];
+			}
+		}
+		std::sort ( cache_.begin ( ) , cache_.end ( ) );
+
+		timings_.store = timer.lap ( );
+	}
+
+}
+
+#endif /* CELER_CONTACTSOLVER_HPP_ */
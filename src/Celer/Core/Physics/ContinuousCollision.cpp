@@ -0,0 +1,7 @@
+/*
+ * ContinuousCollision.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/ContinuousCollision.hpp>
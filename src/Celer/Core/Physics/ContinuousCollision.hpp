@@ -0,0 +1,504 @@
+#ifndef CELER_CONTINUOUSCOLLISION_HPP_
+#define CELER_CONTINUOUSCOLLISION_HPP_
+
+//- Celer/Core/Physics/ContinuousCollision.hpp - Time of impact queries ---//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the ContinuousCollision
+//        class, swept bounds and time of impact of moving convex shapes.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix3x3.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+#include <Celer/Core/Physics/SupportMapping.hpp>
+#include <Celer/Core/Physics/Narrowphase.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class ContinuousCollision.
+	 *@brief Time of impact of moving shapes over one step.
+	 *@details BoundingBox3::intersect only tells whether two boxes overlap at
+	 * the end of a step, so a fast body can pass through a thin one between
+	 * two steps. These queries parametrize the step by t in [0,1] and return
+	 * the first t of contact:
+	 *
+	 * - sweep of a box against a box , slab test on the Minkowski sum.
+	 * - sweep of a sphere against a sphere , both moving.
+	 * - timeOfImpact of two convex shapes with linear and angular motion , by
+	 *   conservative advancement over Narrowphase distances.
+	 *
+	 * The batch versions take parallel arrays , query i tests the i-th entry of
+	 * each , and write toi[i] in [0,1] on a hit and noHit ( ) otherwise. An
+	 * UNRESOLVED timeOfImpact counts as a hit at its safe time , so a body
+	 * stopped there does not tunnel. For
+	 * float they run four queries per SIMD::Float4 and split blocks over the
+	 * OpenMP threads.
+	 */
+	template < class Real >
+	class ContinuousCollision
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 					Vector3;
+			typedef Celer::Matrix3x3<Real> 					Matrix3x3;
+			typedef Celer::BoundingBox3<Real> 				BoundingBox3;
+			typedef Celer::Narrowphase<Real> 				Narrowphase;
+			typedef typename Narrowphase::Contact 			Contact;
+			typedef typename Narrowphase::Pair 				Pair;
+
+			/// Placement of a shape at the start of the step and its velocities,
+			/// the step being one unit of time.
+			struct Motion
+			{
+				Matrix3x3 	rotation;
+				Vector3 	position;
+				Vector3 	linear;
+				Vector3 	angular;
+
+				Motion ( ) : rotation ( 1 , 0 , 0 , 0 , 1 , 0 , 0 , 0 , 1 )
+				{
+				}
+
+				Motion ( const Vector3& position , const Vector3& linear ) :
+					rotation ( 1 , 0 , 0 , 0 , 1 , 0 , 0 , 0 , 1 ) , position ( position ) , linear ( linear )
+				{
+				}
+
+				/// Rotation at time t , the angular velocity integrated exactly.
+				Matrix3x3 rotationAt ( Real t ) const;
+			};
+
+			static Real noHit ( )
+			{
+				return std::numeric_limits<Real>::max ( );
+			}
+
+			/// Outcome of timeOfImpact.
+			enum Impact
+			{
+				MISS , 		///< No contact in the step.
+				HIT , 		///< In contact at toi.
+				UNRESOLVED 	///< Out of iterations while still closing in.
+			};
+
+			/// Box moving by displacement against a box at rest; for two moving
+			/// boxes pass the difference of the displacements. normal is the face
+			/// of target first touched.
+			static bool sweep ( const BoundingBox3& moving , const Vector3& displacement , const BoundingBox3& target , Real& toi , Vector3& normal );
+
+			/// Two spheres , each moving by its displacement.
+			static bool sweep ( const Vector3& center , Real radius , const Vector3& displacement ,
+			                    const Vector3& otherCenter , Real otherRadius , const Vector3& otherDisplacement , Real& toi );
+
+			/// Two convex shapes , given in local coordinates , moving by their
+			/// motions. HIT: toi is the first t where they come within tolerance
+			/// and contact is the contact there. UNRESOLVED: maxIterations steps
+			/// did not get there , toi is the last t they are known to be apart ,
+			/// safe to advance to , and contact is the one at toi , with distance
+			/// above tolerance. MISS: no contact in the step , toi is untouched.
+			template < class ShapeA , class ShapeB >
+			static Impact timeOfImpact ( const ShapeA& a , const Motion& motionA , const ShapeB& b , const Motion& motionB ,
+			                           Real& toi , Contact& contact , Real tolerance = Real ( 1e-3 ) , int maxIterations = 32 );
+
+			static void sweep ( const BoundingBox3* moving , const Vector3* displacements , const BoundingBox3* targets , std::size_t count , Real* toi );
+
+			static void sweep ( const Vector3* centers , const Real* radii , const Vector3* displacements ,
+			                    const Vector3* otherCenters , const Real* otherRadii , const Vector3* otherDisplacements ,
+			                    std::size_t count , Real* toi );
+
+			template < class ShapeA , class ShapeB >
+			static void timeOfImpact ( const ShapeA* a , const Motion* motionsA , const ShapeB* b , const Motion* motionsB ,
+			                           const Pair* pairs , std::size_t count , Real* toi , Real tolerance = Real ( 1e-3 ) );
+
+		private:
+
+			enum
+			{
+				kBlock = 256
+			};
+
+			template < class T >
+			static T boxKernel ( const T minA[3] , const T maxA[3] , const T d[3] , const T minB[3] , const T maxB[3] );
+
+			template < class T >
+			static T sphereKernel ( const T s[3] , const T v[3] , const T& radius );
+
+			static void sweepBoxes ( const BoundingBox3* moving , const Vector3* displacements , const BoundingBox3* targets ,
+			                         std::size_t first , std::size_t last , Real* toi );
+
+			static void sweepSpheres ( const Vector3* centers , const Real* radii , const Vector3* displacements ,
+			                           const Vector3* otherCenters , const Real* otherRadii , const Vector3* otherDisplacements ,
+			                           std::size_t first , std::size_t last , Real* toi );
+
+			/// Radius around the local origin bounding the shape.
+			template < class Shape >
+			static Real extent ( const Shape& shape );
+	};
+
+	template < class Real >
+	typename ContinuousCollision<Real>::Matrix3x3 ContinuousCollision<Real>::Motion::rotationAt ( Real t ) const
+	{
+		Vector3 w = angular * t;
+		Real angle = std::sqrt ( w * w );
+
+		if ( angle <= std::numeric_limits<Real>::epsilon ( ) )
+		{
+			return rotation;
+		}
+
+		/// Rodrigues: I + sin ( angle ) K + ( 1 - cos ( angle ) ) K^2.
+		Vector3 k = w / angle;
+		Real s = std::sin ( angle );
+		Real c = static_cast<Real> ( 1 ) - std::cos ( angle );
+
+		Matrix3x3 r ( static_cast<Real> ( 1 ) - c * ( k.y * k.y + k.z * k.z ) , c * k.x * k.y - s * k.z , c * k.x * k.z + s * k.y ,
+		              c * k.x * k.y + s * k.z , static_cast<Real> ( 1 ) - c * ( k.x * k.x + k.z * k.z ) , c * k.y * k.z - s * k.x ,
+		              c * k.x * k.z - s * k.y , c * k.y * k.z + s * k.x , static_cast<Real> ( 1 ) - c * ( k.x * k.x + k.y * k.y ) );
+
+		return r * rotation;
+	}
+
+	template < class Real >
+	template < class T >
+	inline T ContinuousCollision<Real>::boxKernel ( const T minA[3] , const T maxA[3] , const T d[3] , const T minB[3] , const T maxB[3] )
+	{
+		typedef typename SIMD::Traits<T>::Mask Mask;
+
+		const T big ( noHit ( ) );
+		const T zero ( static_cast<Real> ( 0 ) );
+		const T one ( static_cast<Real> ( 1 ) );
+
+		T enter = -big;
+		T exit = big;
+
+		for ( int k = 0; k < 3; ++k )
+		{
+			/// An axis without motion either always or never overlaps.
+			Mask still = SIMD::abs ( d[k] ) <= T ( std::numeric_limits<Real>::min ( ) );
+			Mask apart = ( maxA[k] < minB[k] ) | ( minA[k] > maxB[k] );
+
+			T inverse = one / SIMD::select ( still , one , d[k] );
+			T t0 = ( minB[k] - maxA[k] ) * inverse;
+			T t1 = ( maxB[k] - minA[k] ) * inverse;
+
+			T low = SIMD::select ( still , SIMD::select ( apart , big , -big ) , SIMD::min ( t0 , t1 ) );
+			T high = SIMD::select ( still , SIMD::select ( apart , -big , big ) , SIMD::max ( t0 , t1 ) );
+
+			enter = SIMD::max ( enter , low );
+			exit = SIMD::min ( exit , high );
+		}
+
+		Mask hit = ( enter <= exit ) & ( enter <= one ) & ( exit >= zero );
+		return SIMD::select ( hit , SIMD::max ( enter , zero ) , big );
+	}
+
+	template < class Real >
+	template < class T >
+	inline T ContinuousCollision<Real>::sphereKernel ( const T s[3] , const T v[3] , const T& radius )
+	{
+		typedef typename SIMD::Traits<T>::Mask Mask;
+
+		const T big ( noHit ( ) );
+		const T zero ( static_cast<Real> ( 0 ) );
+		const T one ( static_cast<Real> ( 1 ) );
+
+		/// | s + v t | = radius , s and v relative to the first sphere.
+		T a = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+		T b = s[0] * v[0] + s[1] * v[1] + s[2] * v[2];
+		T c = s[0] * s[0] + s[1] * s[1] + s[2] * s[2] - radius * radius;
+		T discriminant = b * b - a * c;
+
+		Mask moving = a > zero;
+		T t = ( -b - SIMD::sqrt ( SIMD::max ( discriminant , zero ) ) ) / SIMD::select ( moving , a , one );
+
+		Mask hit = moving & ( b < zero ) & ( discriminant >= zero ) & ( t <= one );
+		Mask inside = c <= zero;
+
+		return SIMD::select ( inside , zero , SIMD::select ( hit , SIMD::max ( t , zero ) , big ) );
+	}
+
+	template < class Real >
+	bool ContinuousCollision<Real>::sweep ( const BoundingBox3& moving , const Vector3& displacement , const BoundingBox3& target , Real& toi , Vector3& normal )
+	{
+		const Vector3& minA = moving.box_min ( );
+		const Vector3& maxA = moving.box_max ( );
+		const Vector3& minB = target.box_min ( );
+		const Vector3& maxB = target.box_max ( );
+
+		Real a0[3] = { minA.x , minA.y , minA.z };
+		Real a1[3] = { maxA.x , maxA.y , maxA.z };
+		Real b0[3] = { minB.x , minB.y , minB.z };
+		Real b1[3] = { maxB.x , maxB.y , maxB.z };
+		Real d[3] = { displacement.x , displacement.y , displacement.z };
+
+		toi = boxKernel<Real> ( a0 , a1 , d , b0 , b1 );
+		if ( toi == noHit ( ) )
+		{
+			return false;
+		}
+
+		/// The last axis whose slabs start to overlap.
+		normal = Vector3 ( 0 , 0 , 0 );
+		Real latest = -noHit ( );
+		for ( int k = 0; k < 3; ++k )
+		{
+			if ( d[k] != static_cast<Real> ( 0 ) )
+			{
+				Real enter = ( d[k] > static_cast<Real> ( 0 ) ) ? ( b0[k] - a1[k] ) / d[k] : ( b1[k] - a0[k] ) / d[k];
+				if ( enter > latest )
+				{
+					latest = enter;
+					normal = Vector3 ( 0 , 0 , 0 );
+					normal[k] = ( d[k] > static_cast<Real> ( 0 ) ) ? static_cast<Real> ( -1 ) : static_cast<Real> ( 1 );
+				}
+			}
+		}
+		return true;
+	}
+
+	template < class Real >
+	bool ContinuousCollision<Real>::sweep ( const Vector3& center , Real radius , const Vector3& displacement ,
+	                                        const Vector3& otherCenter , Real otherRadius , const Vector3& otherDisplacement , Real& toi )
+	{
+		Vector3 s = otherCenter - center;
+		Vector3 v = otherDisplacement - displacement;
+
+		Real ss[3] = { s.x , s.y , s.z };
+		Real vv[3] = { v.x , v.y , v.z };
+
+		toi = sphereKernel<Real> ( ss , vv , radius + otherRadius );
+		return toi != noHit ( );
+	}
+
+	template < class Real >
+	void ContinuousCollision<Real>::sweepBoxes ( const BoundingBox3* moving , const Vector3* displacements , const BoundingBox3* targets ,
+	                                             std::size_t first , std::size_t last , Real* toi )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			Vector3 normal;
+			if ( !sweep ( moving[i] , displacements[i] , targets[i] , toi[i] , normal ) )
+			{
+				toi[i] = noHit ( );
+			}
+		}
+	}
+
+	template < class Real >
+	void ContinuousCollision<Real>::sweepSpheres ( const Vector3* centers , const Real* radii , const Vector3* displacements ,
+	                                               const Vector3* otherCenters , const Real* otherRadii , const Vector3* otherDisplacements ,
+	                                               std::size_t first , std::size_t last , Real* toi )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			sweep ( centers[i] , radii[i] , displacements[i] , otherCenters[i] , otherRadii[i] , otherDisplacements[i] , toi[i] );
+		}
+	}
+
+	/// Four queries per kernel call , gathered into the lanes of Float4.
+	template < >
+	inline void ContinuousCollision<float>::sweepBoxes ( const BoundingBox3* moving , const Vector3* displacements , const BoundingBox3* targets ,
+	                                                     std::size_t first , std::size_t last , float* toi )
+	{
+		std::size_t i = first;
+
+		for ( ; i + 4 <= last; i += 4 )
+		{
+			/// The box corners are x y z 0 registers , four of them transpose to one register per axis.
+			SIMD::Float4 minA[4] = { moving[i].lower ( ) , moving[i + 1].lower ( ) , moving[i + 2].lower ( ) , moving[i + 3].lower ( ) };
+			SIMD::Float4 maxA[4] = { moving[i].upper ( ) , moving[i + 1].upper ( ) , moving[i + 2].upper ( ) , moving[i + 3].upper ( ) };
+			SIMD::Float4 minB[4] = { targets[i].lower ( ) , targets[i + 1].lower ( ) , targets[i + 2].lower ( ) , targets[i + 3].lower ( ) };
+			SIMD::Float4 maxB[4] = { targets[i].upper ( ) , targets[i + 1].upper ( ) , targets[i + 2].upper ( ) , targets[i + 3].upper ( ) };
+			SIMD::Float4 d[3];
+
+			SIMD::transpose ( minA[0] , minA[1] , minA[2] , minA[3] );
+			SIMD::transpose ( maxA[0] , maxA[1] , maxA[2] , maxA[3] );
+			SIMD::transpose ( minB[0] , minB[1] , minB[2] , minB[3] );
+			SIMD::transpose ( maxB[0] , maxB[1] , maxB[2] , maxB[3] );
+
+			for ( int k = 0; k < 3; ++k )
+			{
+				d[k] = SIMD::Float4 ( displacements[i][k] , displacements[i + 1][k] , displacements[i + 2][k] , displacements[i + 3][k] );
+			}
+
+			boxKernel<SIMD::Float4> ( minA , maxA , d , minB , maxB ).store ( toi + i );
+		}
+
+		for ( ; i < last; ++i )
+		{
+			Vector3 normal;
+			if ( !sweep ( moving[i] , displacements[i] , targets[i] , toi[i] , normal ) )
+			{
+				toi[i] = noHit ( );
+			}
+		}
+	}
+
+	template < >
+	inline void ContinuousCollision<float>::sweepSpheres ( const Vector3* centers , const float* radii , const Vector3* displacements ,
+	                                                       const Vector3* otherCenters , const float* otherRadii , const Vector3* otherDisplacements ,
+	                                                       std::size_t first , std::size_t last , float* toi )
+	{
+		std::size_t i = first;
+
+		for ( ; i + 4 <= last; i += 4 )
+		{
+			SIMD::Float4 s[3];
+			SIMD::Float4 v[3];
+
+			for ( int k = 0; k < 3; ++k )
+			{
+				s[k] = SIMD::Float4 ( otherCenters[i][k] - centers[i][k] , otherCenters[i + 1][k] - centers[i + 1][k] ,
+				                      otherCenters[i + 2][k] - centers[i + 2][k] , otherCenters[i + 3][k] - centers[i + 3][k] );
+				v[k] = SIMD::Float4 ( otherDisplacements[i][k] - displacements[i][k] , otherDisplacements[i + 1][k] - displacements[i + 1][k] ,
+				                      otherDisplacements[i + 2][k] - displacements[i + 2][k] , otherDisplacements[i + 3][k] - displacements[i + 3][k] );
+			}
+
+			SIMD::Float4 radius = SIMD::Float4::load ( radii + i ) + SIMD::Float4::load ( otherRadii + i );
+			sphereKernel<SIMD::Float4> ( s , v , radius ).store ( toi + i );
+		}
+
+		for ( ; i < last; ++i )
+		{
+			sweep ( centers[i] , radii[i] , displacements[i] , otherCenters[i] , otherRadii[i] , otherDisplacements[i] , toi[i] );
+		}
+	}
+
+	template < class Real >
+	void ContinuousCollision<Real>::sweep ( const BoundingBox3* moving , const Vector3* displacements , const BoundingBox3* targets , std::size_t count , Real* toi )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			sweepBoxes ( moving , displacements , targets , first , last , toi );
+		}
+	}
+
+	template < class Real >
+	void ContinuousCollision<Real>::sweep ( const Vector3* centers , const Real* radii , const Vector3* displacements ,
+	                                        const Vector3* otherCenters , const Real* otherRadii , const Vector3* otherDisplacements ,
+	                                        std::size_t count , Real* toi )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+			sweepSpheres ( centers , radii , displacements , otherCenters , otherRadii , otherDisplacements , first , last , toi );
+		}
+	}
+
+	template < class Real >
+	template < class Shape >
+	Real ContinuousCollision<Real>::extent ( const Shape& shape )
+	{
+		/// Farthest corner of the box spanned by the six axis supports.
+		Real squared = static_cast<Real> ( 0 );
+		for ( int k = 0; k < 3; ++k )
+		{
+			Vector3 axis ( 0 , 0 , 0 );
+			axis[k] = static_cast<Real> ( 1 );
+			Real reach = std::max ( std::fabs ( shape.support ( axis )[k] ) , std::fabs ( shape.support ( -axis )[k] ) );
+			squared += reach * reach;
+		}
+		return std::sqrt ( squared ) + shape.radius ( );
+	}
+
+	template < class Real >
+	template < class ShapeA , class ShapeB >
+	typename ContinuousCollision<Real>::Impact ContinuousCollision<Real>::timeOfImpact ( const ShapeA& a , const Motion& motionA , const ShapeB& b , const Motion& motionB ,
+	                                                                                     Real& toi , Contact& contact , Real tolerance , int maxIterations )
+	{
+		typedef Celer::TransformedSupport<ShapeA , Real> PlacedA;
+		typedef Celer::TransformedSupport<ShapeB , Real> PlacedB;
+
+		/// Upper bound of the rotational speed of any surface point.
+		Real spin = std::sqrt ( motionA.angular * motionA.angular ) * extent ( a ) +
+		            std::sqrt ( motionB.angular * motionB.angular ) * extent ( b );
+
+		Vector3 relative = motionA.linear - motionB.linear;
+		typename Narrowphase::Simplex cache;
+		Real t = static_cast<Real> ( 0 );
+
+		/// The last pass only measures , so contact always belongs to toi.
+		for ( int iteration = 0; ; ++iteration )
+		{
+			PlacedA placedA ( a , motionA.rotationAt ( t ) , motionA.position + motionA.linear * t );
+			PlacedB placedB ( b , motionB.rotationAt ( t ) , motionB.position + motionB.linear * t );
+
+			Narrowphase::collide ( placedA , placedB , cache , contact );
+
+			if ( contact.distance <= tolerance )
+			{
+				toi = t;
+				return HIT;
+			}
+
+			if ( iteration >= maxIterations )
+			{
+				toi = t;
+				return UNRESOLVED;
+			}
+
+			/// No point can close the gap faster than this.
+			Real speed = relative * contact.normal + spin;
+			if ( speed <= static_cast<Real> ( 0 ) )
+			{
+				return MISS;
+			}
+
+			t += contact.distance / speed;
+			if ( t > static_cast<Real> ( 1 ) )
+			{
+				return MISS;
+			}
+		}
+	}
+
+	template < class Real >
+	template < class ShapeA , class ShapeB >
+	void ContinuousCollision<Real>::timeOfImpact ( const ShapeA* a , const Motion* motionsA , const ShapeB* b , const Motion* motionsB ,
+	                                               const Pair* pairs , std::size_t count , Real* toi , Real tolerance )
+	{
+		long n = static_cast<long> ( count );
+
+		#pragma omp parallel for schedule(dynamic, 16)
+		for ( long i = 0; i < n; ++i )
+		{
+			const Pair& pair = pairs[i];
+			Contact contact;
+			if ( timeOfImpact ( a[pair.first] , motionsA[pair.first] , b[pair.second] , motionsB[pair.second] , toi[i] , contact , tolerance ) == MISS )
+			{
+				toi[i] = noHit ( );
+			}
+		}
+	}
+
+}
+
+#endif /* CELER_CONTINUOUSCOLLISION_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * ExpandingPolytope.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/ExpandingPolytope.hpp>
@@ -0,0 +1,392 @@
+#ifndef CELER_EXPANDINGPOLYTOPE_HPP_
+#define CELER_EXPANDINGPOLYTOPE_HPP_
+
+//- Celer/Core/Physics/ExpandingPolytope.hpp - EPA penetration ------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the ExpandingPolytope class,
+//        the penetration depth of two intersecting convex support mappings.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cmath>
+#include <limits>
+#include <algorithm>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Physics/GilbertJohnsonKeerthi.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class ExpandingPolytope.
+	 *@brief EPA penetration depth between the cores of two convex shapes.
+	 *@details Starts from the simplex GilbertJohnsonKeerthi::distance left
+	 * enclosing the origin and grows a polytope inside A - B towards its
+	 * boundary. The polytope lives in fixed arrays on the stack , so a query
+	 * never allocates; when they fill up the best face found so far is used.
+	 *
+	 * The normal points from A to B: translating A by -depth * normal leaves
+	 * the cores touching.
+	 */
+	template < class Real >
+	class ExpandingPolytope
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 					Vector3;
+			typedef Celer::GilbertJohnsonKeerthi<Real> 		GJK;
+			typedef typename GJK::Vertex 					Vertex;
+			typedef typename GJK::Simplex 					Simplex;
+
+			enum
+			{
+				kMaxVertices = 64 ,
+				kMaxFaces = 128 ,
+				kMaxEdges = 96
+			};
+
+			struct Result
+			{
+				Real 	depth;
+				Vector3 normal;
+				Vector3 pointA;		///< Deepest point of A inside B.
+				Vector3 pointB;		///< Deepest point of B inside A.
+				int 	iterations;
+			};
+
+			/// Returns false when A - B is flat , then result is not set.
+			template < class ShapeA , class ShapeB >
+			static bool penetration ( const ShapeA& a , const ShapeB& b , const Simplex& simplex , Result& result , int maxIterations = 64 );
+
+		private:
+
+			struct Face
+			{
+				int 	vertex[3];
+				Vector3 normal;
+				Real 	distance;
+			};
+
+			struct Polytope
+			{
+				Vertex 	vertex[kMaxVertices];
+				Face 	face[kMaxFaces];
+				int 	vertices;
+				int 	faces;
+			};
+
+			static bool makeFace ( Polytope& polytope , int a , int b , int c );
+
+			template < class ShapeA , class ShapeB >
+			static bool enclose ( const ShapeA& a , const ShapeB& b , Polytope& polytope );
+	};
+
+	template < class Real >
+	bool ExpandingPolytope<Real>::makeFace ( Polytope& p , int a , int b , int c )
+	{
+		if ( p.faces == kMaxFaces )
+		{
+			return false;
+		}
+
+		Face& f = p.face[p.faces++];
+		f.vertex[0] = a;
+		f.vertex[1] = b;
+		f.vertex[2] = c;
+
+		const Vector3& w = p.vertex[a].w;
+		f.normal = ( p.vertex[b].w - w ) ^ ( p.vertex[c].w - w );
+
+		Real length = std::sqrt ( f.normal * f.normal );
+		if ( length > std::numeric_limits<Real>::min ( ) )
+		{
+			f.normal /= length;
+			f.distance = f.normal * w;
+		}
+		else
+		{
+			/// A sliver , never picked as the closest face.
+			f.distance = std::numeric_limits<Real>::max ( );
+		}
+		return true;
+	}
+
+	/// Grows the simplex to a tetrahedron while it still has the origin ,
+	/// GJK may stop on a point , segment or triangle touching it.
+	template < class Real >
+	template < class ShapeA , class ShapeB >
+	bool ExpandingPolytope<Real>::enclose ( const ShapeA& a , const ShapeB& b , Polytope& p )
+	{
+		static const Real axes[3][3] = { { 1 , 0 , 0 } , { 0 , 1 , 0 } , { 0 , 0 , 1 } };
+
+		Real scale = std::numeric_limits<Real>::min ( );
+		for ( int i = 0; i < p.vertices; ++i )
+		{
+			scale = std::max ( scale , std::sqrt ( p.vertex[i].w * p.vertex[i].w ) );
+		}
+		const Real tolerance = GJK::tolerance ( );
+
+		while ( p.vertices < 4 )
+		{
+			Vector3 candidates[6];
+			int count = 0;
+
+			if ( p.vertices == 1 )
+			{
+				for ( int k = 0; k < 3; ++k )
+				{
+					candidates[count++] = Vector3 ( axes[k][0] , axes[k][1] , axes[k][2] );
+				}
+			}
+			else if ( p.vertices == 2 )
+			{
+				Vector3 d = p.vertex[1].w - p.vertex[0].w;
+				for ( int k = 0; k < 3; ++k )
+				{
+					candidates[count++] = d ^ Vector3 ( axes[k][0] , axes[k][1] , axes[k][2] );
+				}
+			}
+			else
+			{
+				candidates[count++] = ( p.vertex[1].w - p.vertex[0].w ) ^ ( p.vertex[2].w - p.vertex[0].w );
+			}
+
+			bool grown = false;
+			for ( int i = 0; i < count && !grown; ++i )
+			{
+				for ( int sign = 0; sign < 2 && !grown; ++sign )
+				{
+					Vector3 d = sign ? -candidates[i] : candidates[i];
+					if ( d * d <= std::numeric_limits<Real>::min ( ) )
+					{
+						continue;
+					}
+
+					Vertex v = GJK::support ( a , b , d );
+
+					/// Distance of v from the affine hull of the current vertices.
+					Vector3 offset = v.w - p.vertex[0].w;
+					Real height;
+					if ( p.vertices == 1 )
+					{
+						height = std::sqrt ( offset * offset );
+					}
+					else if ( p.vertices == 2 )
+					{
+						Vector3 e = p.vertex[1].w - p.vertex[0].w;
+						Vector3 c = offset ^ e;
+						height = std::sqrt ( ( c * c ) / ( e * e ) );
+					}
+					else
+					{
+						Vector3 n = candidates[0];
+						height = std::fabs ( offset * n ) / std::sqrt ( n * n );
+					}
+
+					if ( height > tolerance * scale )
+					{
+						p.vertex[p.vertices++] = v;
+						scale = std::max ( scale , std::sqrt ( v.w * v.w ) );
+						grown = true;
+					}
+				}
+			}
+
+			if ( !grown )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template < class Real >
+	template < class ShapeA , class ShapeB >
+	bool ExpandingPolytope<Real>::penetration ( const ShapeA& a , const ShapeB& b , const Simplex& simplex , Result& result , int maxIterations )
+	{
+		Polytope p;
+		p.vertices = 0;
+		p.faces = 0;
+
+		for ( int i = 0; i < simplex.count && i < 4; ++i )
+		{
+			p.vertex[p.vertices++] = simplex.vertex[i];
+		}
+		if ( p.vertices == 0 )
+		{
+			Vector3 direction = a.center ( ) - b.center ( );
+			p.vertex[p.vertices++] = GJK::support ( a , b , ( direction * direction > static_cast<Real> ( 0 ) ) ? direction : Vector3 ( 1 , 0 , 0 ) );
+		}
+
+		if ( !enclose ( a , b , p ) )
+		{
+			return false;
+		}
+
+		/// Faces wound counter clockwise seen from outside.
+		const Vector3& w0 = p.vertex[0].w;
+		if ( ( ( p.vertex[1].w - w0 ) ^ ( p.vertex[2].w - w0 ) ) * ( p.vertex[3].w - w0 ) > static_cast<Real> ( 0 ) )
+		{
+			Vertex swap = p.vertex[1];
+			p.vertex[1] = p.vertex[2];
+			p.vertex[2] = swap;
+		}
+		makeFace ( p , 0 , 1 , 2 );
+		makeFace ( p , 0 , 3 , 1 );
+		makeFace ( p , 1 , 3 , 2 );
+		makeFace ( p , 2 , 3 , 0 );
+
+		const Real tolerance = GJK::tolerance ( );
+		int closest = 0;
+		Face best = p.face[0];
+		bool full = false;
+
+		for ( result.iterations = 0; result.iterations < maxIterations; ++result.iterations )
+		{
+			closest = 0;
+			for ( int f = 1; f < p.faces; ++f )
+			{
+				if ( p.face[f].distance < p.face[closest].distance )
+				{
+					closest = f;
+				}
+			}
+
+			/// A copy , the faces v sees are removed below.
+			best = p.face[closest];
+			if ( best.distance == std::numeric_limits<Real>::max ( ) )
+			{
+				return false;
+			}
+
+			Vertex v = GJK::support ( a , b , best.normal );
+			Real gain = v.w * best.normal - best.distance;
+
+			if ( gain <= tolerance * std::max ( best.distance , static_cast<Real> ( 1 ) ) || p.vertices == kMaxVertices )
+			{
+				break;
+			}
+
+			int index = p.vertices++;
+			p.vertex[index] = v;
+
+			/// Remove the faces v sees and keep the edges bordering them once.
+			int edges[kMaxEdges][2];
+			int edgeCount = 0;
+			bool overflow = false;
+
+			for ( int f = 0; f < p.faces; )
+			{
+				const Face& face = p.face[f];
+				if ( face.normal * ( v.w - p.vertex[face.vertex[0]].w ) > static_cast<Real> ( 0 ) )
+				{
+					for ( int e = 0; e < 3; ++e )
+					{
+						int from = face.vertex[e];
+						int to = face.vertex[( e + 1 ) % 3];
+
+						int twin = -1;
+						for ( int k = 0; k < edgeCount; ++k )
+						{
+							if ( edges[k][0] == to && edges[k][1] == from )
+							{
+								twin = k;
+								break;
+							}
+						}
+
+						if ( twin >= 0 )
+						{
+							edges[twin][0] = edges[edgeCount - 1][0];
+							edges[twin][1] = edges[edgeCount - 1][1];
+							--edgeCount;
+						}
+						else if ( edgeCount < kMaxEdges )
+						{
+							edges[edgeCount][0] = from;
+							edges[edgeCount][1] = to;
+							++edgeCount;
+						}
+						else
+						{
+							overflow = true;
+						}
+					}
+					p.face[f] = p.face[--p.faces];
+				}
+				else
+				{
+					++f;
+				}
+			}
+
+			/// Out of storage , the polytope has lost faces: use the best one so far.
+			if ( overflow || p.faces + edgeCount > kMaxFaces )
+			{
+				full = true;
+				break;
+			}
+
+			for ( int e = 0; e < edgeCount; ++e )
+			{
+				makeFace ( p , edges[e][0] , edges[e][1] , index );
+			}
+		}
+
+		if ( !full )
+		{
+			closest = 0;
+			for ( int f = 1; f < p.faces; ++f )
+			{
+				if ( p.face[f].distance < p.face[closest].distance )
+				{
+					closest = f;
+				}
+			}
+			best = p.face[closest];
+		}
+
+		/// Barycentric coordinates of the origin projected onto the face.
+		const Vertex& va = p.vertex[best.vertex[0]];
+		const Vertex& vb = p.vertex[best.vertex[1]];
+		const Vertex& vc = p.vertex[best.vertex[2]];
+
+		Vector3 q = best.normal * best.distance;
+		Real u = ( ( vb.w - q ) ^ ( vc.w - q ) ) * best.normal;
+		Real v = ( ( vc.w - q ) ^ ( va.w - q ) ) * best.normal;
+		Real w = ( ( va.w - q ) ^ ( vb.w - q ) ) * best.normal;
+		Real sum = u + v + w;
+
+		if ( sum > std::numeric_limits<Real>::min ( ) )
+		{
+			u /= sum;
+			v /= sum;
+			w /= sum;
+		}
+		else
+		{
+			u = v = w = static_cast<Real> ( 1 ) / static_cast<Real> ( 3 );
+		}
+
+		result.depth = best.distance;
+		result.normal = best.normal;
+		result.pointA = va.a * u + vb.a * v + vc.a * w;
+		result.pointB = va.b * u + vb.b * v + vc.b * w;
+
+		return true;
+	}
+
+}
+
+#endif /* CELER_EXPANDINGPOLYTOPE_HPP_ */
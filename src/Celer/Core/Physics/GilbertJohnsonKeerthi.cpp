@@ -0,0 +1,7 @@
+/*
+ * GilbertJohnsonKeerthi.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/GilbertJohnsonKeerthi.hpp>
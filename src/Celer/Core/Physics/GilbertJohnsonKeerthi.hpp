@@ -0,0 +1,444 @@
+#ifndef CELER_GILBERTJOHNSONKEERTHI_HPP_
+#define CELER_GILBERTJOHNSONKEERTHI_HPP_
+
+//- Celer/Core/Physics/GilbertJohnsonKeerthi.hpp - GJK distance -----------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the GilbertJohnsonKeerthi
+//        class, the distance between two convex support mappings.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cmath>
+#include <limits>
+#include <algorithm>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class GilbertJohnsonKeerthi.
+	 *@brief GJK distance between the cores of two convex shapes.
+	 *@details The shapes are any types with the interface described in
+	 * SupportMapping.hpp and are resolved at compile time. The simplex left by
+	 * a query is kept by the caller and passed to the next query of the same
+	 * pair: its vertices are recomputed from the stored search directions with
+	 * the new placement, so slowly moving pairs converge in one or two steps.
+	 *
+	 * The closest point of each simplex to the origin is found by Voronoi
+	 * region tests as in Ericson , "Real-Time Collision Detection" 5.1.
+	 *
+	 * \code
+	 * Celer::GilbertJohnsonKeerthi<float>::Simplex cache;
+	 * Celer::GilbertJohnsonKeerthi<float>::Result result;
+	 * Celer::GilbertJohnsonKeerthi<float>::distance ( box , hull , cache , result );
+	 * \endcode
+	 */
+	template < class Real >
+	class GilbertJohnsonKeerthi
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			/// Point of the Minkowski difference A - B.
+			struct Vertex
+			{
+				Vector3 a;		///< Support point of A.
+				Vector3 b;		///< Support point of B.
+				Vector3 w;		///< a - b
+				Vector3 direction;	///< Search direction which produced it.
+			};
+
+			/// Up to four vertices and the barycentric weights of the closest point.
+			struct Simplex
+			{
+				Vertex 	vertex[4];
+				Real 	lambda[4];
+				int 	count;
+
+				Simplex ( ) : count ( 0 )
+				{
+				}
+
+				void clear ( )
+				{
+					count = 0;
+				}
+			};
+
+			struct Result
+			{
+				bool 	overlap;	///< The cores intersect , distance is 0.
+				Real 	distance;
+				Vector3 pointA;		///< Closest point on A.
+				Vector3 pointB;		///< Closest point on B.
+				int 	iterations;
+			};
+
+			/// Distance between the cores of a and b , seeded by simplex which is
+			/// updated for the next call. Returns result.overlap.
+			template < class ShapeA , class ShapeB >
+			static bool distance ( const ShapeA& a , const ShapeB& b , Simplex& simplex , Result& result , int maxIterations = 32 );
+
+			/// The closest point of simplex to the origin. Vertices with no weight
+			/// are dropped. A tetrahedron containing the origin is kept whole ,
+			/// weighted so its points give a point common to both cores.
+			static Vector3 solve ( Simplex& simplex );
+
+			template < class ShapeA , class ShapeB >
+			static Vertex support ( const ShapeA& a , const ShapeB& b , const Vector3& direction )
+			{
+				Vertex v;
+				v.a = a.support ( direction );
+				v.b = b.support ( -direction );
+				v.w = v.a - v.b;
+				v.direction = direction;
+				return v;
+			}
+
+			static Real tolerance ( )
+			{
+				return static_cast<Real> ( 100 ) * std::numeric_limits<Real>::epsilon ( );
+			}
+
+		private:
+
+			static Vector3 solveSegment ( Simplex& simplex );
+			static Vector3 solveTriangle ( Simplex& simplex );
+			static Vector3 solveTetrahedron ( Simplex& simplex );
+
+			static void keep ( Simplex& simplex , int i , Real li );
+			static void keep ( Simplex& simplex , int i , Real li , int j , Real lj );
+			static void keep ( Simplex& simplex , int i , Real li , int j , Real lj , int k , Real lk );
+	};
+
+	template < class Real >
+	void GilbertJohnsonKeerthi<Real>::keep ( Simplex& s , int i , Real li )
+	{
+		s.vertex[0] = s.vertex[i];
+		s.lambda[0] = li;
+		s.count = 1;
+	}
+
+	template < class Real >
+	void GilbertJohnsonKeerthi<Real>::keep ( Simplex& s , int i , Real li , int j , Real lj )
+	{
+		Vertex vi = s.vertex[i];
+		Vertex vj = s.vertex[j];
+		s.vertex[0] = vi;
+		s.vertex[1] = vj;
+		s.lambda[0] = li;
+		s.lambda[1] = lj;
+		s.count = 2;
+	}
+
+	template < class Real >
+	void GilbertJohnsonKeerthi<Real>::keep ( Simplex& s , int i , Real li , int j , Real lj , int k , Real lk )
+	{
+		Vertex vi = s.vertex[i];
+		Vertex vj = s.vertex[j];
+		Vertex vk = s.vertex[k];
+		s.vertex[0] = vi;
+		s.vertex[1] = vj;
+		s.vertex[2] = vk;
+		s.lambda[0] = li;
+		s.lambda[1] = lj;
+		s.lambda[2] = lk;
+		s.count = 3;
+	}
+
+	template < class Real >
+	typename GilbertJohnsonKeerthi<Real>::Vector3 GilbertJohnsonKeerthi<Real>::solveSegment ( Simplex& s )
+	{
+		const Vector3& a = s.vertex[0].w;
+		Vector3 ab = s.vertex[1].w - a;
+		Real length = ab * ab;
+
+		Real t = ( length > static_cast<Real> ( 0 ) ) ? -( a * ab ) / length : static_cast<Real> ( 0 );
+
+		if ( t <= static_cast<Real> ( 0 ) )
+		{
+			keep ( s , 0 , static_cast<Real> ( 1 ) );
+			return s.vertex[0].w;
+		}
+		if ( t >= static_cast<Real> ( 1 ) )
+		{
+			keep ( s , 1 , static_cast<Real> ( 1 ) );
+			return s.vertex[0].w;
+		}
+
+		s.lambda[0] = static_cast<Real> ( 1 ) - t;
+		s.lambda[1] = t;
+		return a + ab * t;
+	}
+
+	template < class Real >
+	typename GilbertJohnsonKeerthi<Real>::Vector3 GilbertJohnsonKeerthi<Real>::solveTriangle ( Simplex& s )
+	{
+		const Vector3& a = s.vertex[0].w;
+		const Vector3& b = s.vertex[1].w;
+		const Vector3& c = s.vertex[2].w;
+		const Real zero = static_cast<Real> ( 0 );
+		const Real one = static_cast<Real> ( 1 );
+
+		Vector3 ab = b - a;
+		Vector3 ac = c - a;
+
+		Real d1 = -( ab * a );
+		Real d2 = -( ac * a );
+		if ( d1 <= zero && d2 <= zero )
+		{
+			keep ( s , 0 , one );
+			return s.vertex[0].w;
+		}
+
+		Real d3 = -( ab * b );
+		Real d4 = -( ac * b );
+		if ( d3 >= zero && d4 <= d3 )
+		{
+			keep ( s , 1 , one );
+			return s.vertex[0].w;
+		}
+
+		Real vc = d1 * d4 - d3 * d2;
+		if ( vc <= zero && d1 >= zero && d3 <= zero )
+		{
+			Real t = ( d1 - d3 > zero ) ? d1 / ( d1 - d3 ) : zero;
+			keep ( s , 0 , one - t , 1 , t );
+			return s.vertex[0].w + ( s.vertex[1].w - s.vertex[0].w ) * t;
+		}
+
+		Real d5 = -( ab * c );
+		Real d6 = -( ac * c );
+		if ( d6 >= zero && d5 <= d6 )
+		{
+			keep ( s , 2 , one );
+			return s.vertex[0].w;
+		}
+
+		Real vb = d5 * d2 - d1 * d6;
+		if ( vb <= zero && d2 >= zero && d6 <= zero )
+		{
+			Real t = ( d2 - d6 > zero ) ? d2 / ( d2 - d6 ) : zero;
+			keep ( s , 0 , one - t , 2 , t );
+			return s.vertex[0].w + ( s.vertex[1].w - s.vertex[0].w ) * t;
+		}
+
+		Real va = d3 * d6 - d5 * d4;
+		if ( va <= zero && ( d4 - d3 ) >= zero && ( d5 - d6 ) >= zero )
+		{
+			Real t = ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) );
+			keep ( s , 1 , one - t , 2 , t );
+			return s.vertex[0].w + ( s.vertex[1].w - s.vertex[0].w ) * t;
+		}
+
+		Real sum = va + vb + vc;
+		if ( sum <= zero )
+		{
+			/// Degenerate triangle , the closest of its edges.
+			static const int edges[3][2] = { { 0 , 1 } , { 0 , 2 } , { 1 , 2 } };
+
+			Simplex best;
+			Vector3 closest;
+			Real distance = std::numeric_limits<Real>::max ( );
+
+			for ( int e = 0; e < 3; ++e )
+			{
+				Simplex segment;
+				segment.vertex[0] = s.vertex[edges[e][0]];
+				segment.vertex[1] = s.vertex[edges[e][1]];
+				segment.count = 2;
+
+				Vector3 q = solveSegment ( segment );
+				if ( q * q < distance )
+				{
+					distance = q * q;
+					closest = q;
+					best = segment;
+				}
+			}
+			s = best;
+			return closest;
+		}
+
+		Real v = vb / sum;
+		Real w = vc / sum;
+		s.lambda[0] = one - v - w;
+		s.lambda[1] = v;
+		s.lambda[2] = w;
+		return a + ab * v + ac * w;
+	}
+
+	template < class Real >
+	typename GilbertJohnsonKeerthi<Real>::Vector3 GilbertJohnsonKeerthi<Real>::solveTetrahedron ( Simplex& s )
+	{
+		static const int faces[4][4] = { { 0 , 1 , 2 , 3 } , { 0 , 3 , 1 , 2 } , { 0 , 2 , 3 , 1 } , { 1 , 3 , 2 , 0 } };
+
+		Vector3 a = s.vertex[0].w;
+		Real volume = ( ( s.vertex[1].w - a ) ^ ( s.vertex[2].w - a ) ) * ( s.vertex[3].w - a );
+		bool flat = std::fabs ( volume ) <= tolerance ( ) * ( a * a + s.vertex[3].w * s.vertex[3].w );
+
+		Simplex best;
+		Vector3 closest;
+		Real distance = std::numeric_limits<Real>::max ( );
+		bool outside = false;
+
+		for ( int f = 0; f < 4; ++f )
+		{
+			const Vector3& p = s.vertex[faces[f][0]].w;
+			Vector3 n = ( s.vertex[faces[f][1]].w - p ) ^ ( s.vertex[faces[f][2]].w - p );
+			Real opposite = n * ( s.vertex[faces[f][3]].w - p );
+			Real origin = -( n * p );
+
+			/// The origin is on the other side of the face from the fourth vertex.
+			if ( flat || origin * opposite < static_cast<Real> ( 0 ) )
+			{
+				outside = true;
+
+				Simplex triangle;
+				triangle.vertex[0] = s.vertex[faces[f][0]];
+				triangle.vertex[1] = s.vertex[faces[f][1]];
+				triangle.vertex[2] = s.vertex[faces[f][2]];
+				triangle.count = 3;
+
+				Vector3 q = solveTriangle ( triangle );
+				if ( q * q < distance )
+				{
+					distance = q * q;
+					closest = q;
+					best = triangle;
+				}
+			}
+		}
+
+		/// The origin is inside , its barycentric weights by Cramer's rule.
+		if ( !outside )
+		{
+			Vector3 e1 = s.vertex[1].w - a;
+			Vector3 e2 = s.vertex[2].w - a;
+			Vector3 e3 = s.vertex[3].w - a;
+			Vector3 p = -a;
+
+			s.lambda[1] = ( p * ( e2 ^ e3 ) ) / volume;
+			s.lambda[2] = ( e1 * ( p ^ e3 ) ) / volume;
+			s.lambda[3] = ( e1 * ( e2 ^ p ) ) / volume;
+			s.lambda[0] = static_cast<Real> ( 1 ) - s.lambda[1] - s.lambda[2] - s.lambda[3];
+			return Vector3 ( 0 , 0 , 0 );
+		}
+
+		s = best;
+		return closest;
+	}
+
+	template < class Real >
+	typename GilbertJohnsonKeerthi<Real>::Vector3 GilbertJohnsonKeerthi<Real>::solve ( Simplex& s )
+	{
+		switch ( s.count )
+		{
+			case 1:
+				s.lambda[0] = static_cast<Real> ( 1 );
+				return s.vertex[0].w;
+			case 2:
+				return solveSegment ( s );
+			case 3:
+				return solveTriangle ( s );
+			default:
+				return solveTetrahedron ( s );
+		}
+	}
+
+	template < class Real >
+	template < class ShapeA , class ShapeB >
+	bool GilbertJohnsonKeerthi<Real>::distance ( const ShapeA& a , const ShapeB& b , Simplex& simplex , Result& result , int maxIterations )
+	{
+		/// Warm start: the cached directions against the new placement.
+		for ( int i = 0; i < simplex.count; ++i )
+		{
+			simplex.vertex[i] = support ( a , b , simplex.vertex[i].direction );
+		}
+
+		if ( simplex.count == 0 )
+		{
+			Vector3 direction = a.center ( ) - b.center ( );
+			if ( direction * direction <= static_cast<Real> ( 0 ) )
+			{
+				direction = Vector3 ( 1 , 0 , 0 );
+			}
+			simplex.vertex[0] = support ( a , b , -direction );
+			simplex.count = 1;
+		}
+
+		Vector3 v = solve ( simplex );
+		Real vv = v * v;
+
+		result.overlap = false;
+		result.iterations = 0;
+
+		while ( result.iterations < maxIterations )
+		{
+			++result.iterations;
+
+			Real scale = std::numeric_limits<Real>::min ( );
+			for ( int i = 0; i < simplex.count; ++i )
+			{
+				scale = std::max ( scale , simplex.vertex[i].w * simplex.vertex[i].w );
+			}
+
+			if ( simplex.count == 4 || vv <= tolerance ( ) * scale )
+			{
+				result.overlap = true;
+				break;
+			}
+
+			Vertex w = support ( a , b , -v );
+
+			/// No point of A - B is closer than v in this direction.
+			if ( vv - v * w.w <= tolerance ( ) * vv )
+			{
+				break;
+			}
+
+			Simplex previous = simplex;
+			simplex.vertex[simplex.count] = w;
+			++simplex.count;
+
+			Vector3 next = solve ( simplex );
+			Real nn = next * next;
+
+			if ( nn >= vv && simplex.count < 4 )
+			{
+				simplex = previous;
+				break;
+			}
+
+			v = next;
+			vv = nn;
+		}
+
+		result.pointA = Vector3 ( 0 , 0 , 0 );
+		result.pointB = Vector3 ( 0 , 0 , 0 );
+		for ( int i = 0; i < simplex.count; ++i )
+		{
+			result.pointA += simplex.vertex[i].a * simplex.lambda[i];
+			result.pointB += simplex.vertex[i].b * simplex.lambda[i];
+		}
+		result.distance = result.overlap ? static_cast<Real> ( 0 ) : std::sqrt ( vv );
+
+		return result.overlap;
+	}
+
+}
+
+#endif /* CELER_GILBERTJOHNSONKEERTHI_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * Narrowphase.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/Narrowphase.hpp>
@@ -0,0 +1,163 @@
+#ifndef CELER_NARROWPHASE_HPP_
+#define CELER_NARROWPHASE_HPP_
+
+//- Celer/Core/Physics/Narrowphase.hpp - Convex contact queries -----------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the Narrowphase class, the
+//        contact between pairs of convex shapes by GJK and EPA.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cmath>
+#include <cstddef>
+#include <limits>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Physics/GilbertJohnsonKeerthi.hpp>
+#include <Celer/Core/Physics/ExpandingPolytope.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class Narrowphase.
+	 *@brief Contact between two convex shapes, separated or penetrating.
+	 *@details The cores are queried with GilbertJohnsonKeerthi; when they
+	 * overlap ExpandingPolytope gives the penetration. The shape margins
+	 * (sphere and capsule radii) are then added, so round shapes only reach
+	 * EPA when their cores intersect.
+	 *
+	 * The batch entry point takes two shape arrays of fixed types and a list
+	 * of index pairs, as produced by a broadphase. One GJK simplex per pair
+	 * can be kept between frames to warm start the next query.
+	 *
+	 * \code
+	 * typedef Celer::Narrowphase<float> Narrowphase;
+	 * std::vector<Narrowphase::Contact> contacts ( pairs.size ( ) );
+	 * Narrowphase::collide ( &boxes[0] , &spheres[0] , &pairs[0] , pairs.size ( ) , &cache[0] , &contacts[0] );
+	 * \endcode
+	 */
+	template < class Real >
+	class Narrowphase
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 					Vector3;
+			typedef Celer::GilbertJohnsonKeerthi<Real> 		GJK;
+			typedef Celer::ExpandingPolytope<Real> 			EPA;
+			typedef typename GJK::Simplex 					Simplex;
+
+			struct Contact
+			{
+				bool 	overlap;
+				Real 	distance;	///< Signed gap , negative when penetrating.
+				Vector3 normal;		///< From A to B.
+				Vector3 pointA;		///< Closest or deepest point on the surface of A.
+				Vector3 pointB;		///< Closest or deepest point on the surface of B.
+			};
+
+			struct Pair
+			{
+				unsigned int first;	///< Index into the A shapes.
+				unsigned int second;	///< Index into the B shapes.
+			};
+
+			template < class ShapeA , class ShapeB >
+			static bool collide ( const ShapeA& a , const ShapeB& b , Simplex& cache , Contact& contact );
+
+			template < class ShapeA , class ShapeB >
+			static bool collide ( const ShapeA& a , const ShapeB& b , Contact& contact )
+			{
+				Simplex cache;
+				return collide ( a , b , cache , contact );
+			}
+
+			/// Contacts of count pairs into contacts. cache holds one simplex per
+			/// pair and may be null.
+			template < class ShapeA , class ShapeB >
+			static void collide ( const ShapeA* a , const ShapeB* b , const Pair* pairs , std::size_t count , Simplex* cache , Contact* contacts );
+	};
+
+	template < class Real >
+	template < class ShapeA , class ShapeB >
+	bool Narrowphase<Real>::collide ( const ShapeA& a , const ShapeB& b , Simplex& cache , Contact& contact )
+	{
+		typename GJK::Result separation;
+
+		Real radiusA = a.radius ( );
+		Real radiusB = b.radius ( );
+
+		if ( !GJK::distance ( a , b , cache , separation ) )
+		{
+			Vector3 normal = separation.pointB - separation.pointA;
+			normal /= separation.distance;
+
+			contact.distance = separation.distance - radiusA - radiusB;
+			contact.normal = normal;
+			contact.pointA = separation.pointA + normal * radiusA;
+			contact.pointB = separation.pointB - normal * radiusB;
+			contact.overlap = contact.distance < static_cast<Real> ( 0 );
+
+			return contact.overlap;
+		}
+
+		typename EPA::Result penetration;
+
+		if ( EPA::penetration ( a , b , cache , penetration ) )
+		{
+			contact.distance = -( penetration.depth + radiusA + radiusB );
+			contact.normal = penetration.normal;
+			contact.pointA = penetration.pointA + penetration.normal * radiusA;
+			contact.pointB = penetration.pointB - penetration.normal * radiusB;
+		}
+		else
+		{
+			/// Flat cores , such as two spheres at the same center.
+			Vector3 normal = b.center ( ) - a.center ( );
+			Real length = std::sqrt ( normal * normal );
+			normal = ( length > std::numeric_limits<Real>::min ( ) ) ? normal / length : Vector3 ( 0 , 0 , 1 );
+
+			contact.distance = -( radiusA + radiusB );
+			contact.normal = normal;
+			contact.pointA = separation.pointA + normal * radiusA;
+			contact.pointB = separation.pointB - normal * radiusB;
+		}
+		contact.overlap = true;
+
+		return true;
+	}
+
+	template < class Real >
+	template < class ShapeA , class ShapeB >
+	void Narrowphase<Real>::collide ( const ShapeA* a , const ShapeB* b , const Pair* pairs , std::size_t count , Simplex* cache , Contact* contacts )
+	{
+		long n = static_cast<long> ( count );
+
+		#pragma omp parallel for schedule(dynamic, 64)
+		for ( long i = 0; i < n; ++i )
+		{
+			const Pair& pair = pairs[i];
+			if ( cache )
+			{
+				collide ( a[pair.first] , b[pair.second] , cache[i] , contacts[i] );
+			}
+			else
+			{
+				collide ( a[pair.first] , b[pair.second] , contacts[i] );
+			}
+		}
+	}
+
+}
+
+#endif /* CELER_NARROWPHASE_HPP_ */
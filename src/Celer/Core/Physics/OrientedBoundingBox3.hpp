@@ -8,7 +8,7 @@
 #ifndef ORIENTEDBOUNDINGBOX3_HPP_
 #define ORIENTEDBOUNDINGBOX3_HPP_
 
-#include <Celer/Core/Physics/BoundingBox3.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
 
 namespace Celer {
 
@@ -0,0 +1,7 @@
+/*
+ * PositionBasedDynamics.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/PositionBasedDynamics.hpp>
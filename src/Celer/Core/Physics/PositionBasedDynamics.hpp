@@ -0,0 +1,613 @@
+#ifndef CELER_POSITIONBASEDDYNAMICS_HPP_
+#define CELER_POSITIONBASEDDYNAMICS_HPP_
+
+//- Celer/Core/Physics/PositionBasedDynamics.hpp - XPBD particles ---------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the PositionBasedDynamics
+//        class, particles with distance constraints for cloth and ropes.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class PositionBasedDynamics.
+	 *@brief XPBD particle solver for cloth and ropes.
+	 *@details Particles carry a position , a velocity and an inverse mass ,
+	 * zero pins them. Constraints keep the distance between two particles,
+	 * with a compliance ( inverse stiffness , 0 is rigid ) that makes the
+	 * result independent of the step and iteration count:
+	 *
+	 * - addDistance: stretch and shear springs.
+	 * - addBending: a softer distance across a fold , between the vertices
+	 *   opposite a shared edge or two apart along a grid line.
+	 *
+	 * A step is split in substeps of one projection each, which converges
+	 * better than iterations of one step. Constraints are greedily coloured so
+	 * no two of a colour share a particle; a colour is projected in parallel
+	 * without locks and , for float , four constraints per SIMD::Float4.
+	 * Particles are then pushed out of the box and sphere colliders.
+	 *
+	 * \code
+	 * Celer::PositionBasedDynamics<float> cloth;
+	 * cloth.addCloth ( corner , side * Celer::Vector3<float>::UNIT_X , side * Celer::Vector3<float>::UNIT_Z , 320 , 320 , 1.0f );
+	 * cloth.addCollider ( center , radius );
+	 * cloth.step ( 1.0f / 60.0f );
+	 * \endcode
+	 */
+	template < class Real >
+	class PositionBasedDynamics
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 		Vector3;
+			typedef Celer::BoundingBox3<Real> 	BoundingBox3;
+
+			PositionBasedDynamics ( int substeps = 8 );
+
+			std::size_t addParticle ( const Vector3& position , Real inverseMass );
+
+			/// Keeps particles i and j at their current distance.
+			void addDistance ( std::size_t i , std::size_t j , Real compliance = 0 );
+
+			void addBending ( std::size_t i , std::size_t j , Real compliance )
+			{
+				addDistance ( i , j , compliance );
+			}
+
+			/// A nu by nv grid spanning corner to corner + u + v with stretch ,
+			/// shear and bending constraints. Returns the first particle; the
+			/// particle of column x and row y is first + y * nu + x.
+			std::size_t addCloth ( const Vector3& corner , const Vector3& u , const Vector3& v , std::size_t nu , std::size_t nv ,
+			                       Real mass , Real stretchCompliance = 0 , Real bendCompliance = static_cast<Real> ( 1e-3 ) );
+
+			void addCollider ( const BoundingBox3& box )
+			{
+				boxes_.push_back ( box );
+			}
+
+			void addCollider ( const Vector3& center , Real radius )
+			{
+				sphereCenters_.push_back ( center );
+				sphereRadii_.push_back ( radius );
+			}
+
+			void clearColliders ( )
+			{
+				boxes_.clear ( );
+				sphereCenters_.clear ( );
+				sphereRadii_.clear ( );
+			}
+
+			void step ( Real dt );
+
+			void setGravity ( const Vector3& gravity )
+			{
+				gravity_ = gravity;
+			}
+
+			/// Distance particles keep from the colliders.
+			void setThickness ( Real thickness )
+			{
+				thickness_ = thickness;
+			}
+
+			/// Share of the tangential motion removed on collider contact.
+			void setFriction ( Real friction )
+			{
+				friction_ = friction;
+			}
+
+			void setSubsteps ( int substeps )
+			{
+				substeps_ = substeps;
+			}
+
+			std::size_t size ( ) const
+			{
+				return position_.size ( );
+			}
+
+			std::vector<Vector3>& positions ( )
+			{
+				return position_;
+			}
+
+			std::vector<Vector3>& velocities ( )
+			{
+				return velocity_;
+			}
+
+			const std::vector<Vector3>& positions ( ) const
+			{
+				return position_;
+			}
+
+			const std::vector<Vector3>& velocities ( ) const
+			{
+				return velocity_;
+			}
+
+			const std::vector<Real>& inverseMasses ( ) const
+			{
+				return inverseMass_;
+			}
+
+			std::size_t constraints ( ) const
+			{
+				return first_.size ( );
+			}
+
+			std::size_t colours ( ) const
+			{
+				return colours_.size ( ) ? colours_.size ( ) - 1 : 0;
+			}
+
+			/// Seconds spent in the last step ( ).
+			double elapsed ( ) const
+			{
+				return elapsed_;
+			}
+
+		private:
+
+			enum
+			{
+				kMaxColours = 64 ,
+				kBatch = 256
+			};
+
+			template < class T >
+			static void kernel ( T a[3] , T b[3] , const T& wa , const T& wb , const T& rest , const T& alpha , T& lambda );
+
+			void colour ( );
+			void project ( std::size_t first , std::size_t last , Real alpha );
+			void projectBatch ( std::size_t first , std::size_t last , Real alpha );
+			void collide ( std::size_t first , std::size_t last );
+
+			std::vector<Vector3> 		position_;
+			std::vector<Vector3> 		previous_;
+			std::vector<Vector3> 		velocity_;
+			std::vector<Real> 			inverseMass_;
+
+			/// Constraints one array per field , in colour order after colour ( ).
+			std::vector<unsigned int> 	first_;
+			std::vector<unsigned int> 	second_;
+			std::vector<Real> 			rest_;
+			std::vector<Real> 			compliance_;
+			std::vector<Real> 			lambda_;
+			std::vector<std::size_t> 	colours_;
+			bool 						overflow_;
+			bool 						dirty_;
+
+			std::vector<BoundingBox3> 	boxes_;
+			std::vector<Vector3> 		sphereCenters_;
+			std::vector<Real> 			sphereRadii_;
+
+			Vector3 	gravity_;
+			Real 		thickness_;
+			Real 		friction_;
+			int 		substeps_;
+			double 		elapsed_;
+	};
+
+	template < class Real >
+	PositionBasedDynamics<Real>::PositionBasedDynamics ( int substeps ) :
+		overflow_ ( false ) , dirty_ ( false ) , gravity_ ( 0 , static_cast<Real> ( -9.81 ) , 0 ) , thickness_ ( static_cast<Real> ( 0.01 ) ) ,
+		friction_ ( static_cast<Real> ( 0.2 ) ) , substeps_ ( substeps ) , elapsed_ ( 0.0 )
+	{
+	}
+
+	template < class Real >
+	std::size_t PositionBasedDynamics<Real>::addParticle ( const Vector3& position , Real inverseMass )
+	{
+		position_.push_back ( position );
+		previous_.push_back ( position );
+		velocity_.push_back ( Vector3 ( 0 , 0 , 0 ) );
+		inverseMass_.push_back ( inverseMass );
+		return position_.size ( ) - 1;
+	}
+
+	template < class Real >
+	void PositionBasedDynamics<Real>::addDistance ( std::size_t i , std::size_t j , Real compliance )
+	{
+		Vector3 d = position_[i] - position_[j];
+
+		first_.push_back ( static_cast<unsigned int> ( i ) );
+		second_.push_back ( static_cast<unsigned int> ( j ) );
+		rest_.push_back ( std::sqrt ( d * d ) );
+		compliance_.push_back ( compliance );
+		lambda_.push_back ( static_cast<Real> ( 0 ) );
+		dirty_ = true;
+	}
+
+	template < class Real >
+	std::size_t PositionBasedDynamics<Real>::addCloth ( const Vector3& corner , const Vector3& u , const Vector3& v , std::size_t nu , std::size_t nv ,
+	                                                    Real mass , Real stretchCompliance , Real bendCompliance )
+	{
+		std::size_t first = position_.size ( );
+		Real inverseMass = static_cast<Real> ( nu * nv ) / mass;
+
+		for ( std::size_t y = 0; y < nv; ++y )
+		{
+			for ( std::size_t x = 0; x < nu; ++x )
+			{
+				Real s = ( nu > 1 ) ? static_cast<Real> ( x ) / static_cast<Real> ( nu - 1 ) : static_cast<Real> ( 0 );
+				Real t = ( nv > 1 ) ? static_cast<Real> ( y ) / static_cast<Real> ( nv - 1 ) : static_cast<Real> ( 0 );
+				addParticle ( corner + u * s + v * t , inverseMass );
+			}
+		}
+
+		for ( std::size_t y = 0; y < nv; ++y )
+		{
+			for ( std::size_t x = 0; x < nu; ++x )
+			{
+				std::size_t p = first + y * nu + x;
+
+				if ( x + 1 < nu )
+				{
+					addDistance ( p , p + 1 , stretchCompliance );
+				}
+				if ( y + 1 < nv )
+				{
+					addDistance ( p , p + nu , stretchCompliance );
+				}
+				if ( x + 1 < nu && y + 1 < nv )
+				{
+					addDistance ( p , p + nu + 1 , stretchCompliance );
+					addDistance ( p + 1 , p + nu , stretchCompliance );
+				}
+				if ( x + 2 < nu )
+				{
+					addBending ( p , p + 2 , bendCompliance );
+				}
+				if ( y + 2 < nv )
+				{
+					addBending ( p , p + 2 * nu , bendCompliance );
+				}
+			}
+		}
+
+		return first;
+	}
+
+	template < class Real >
+	void PositionBasedDynamics<Real>::colour ( )
+	{
+		std::size_t count = first_.size ( );
+
+		std::vector<unsigned long long> used ( position_.size ( ) , 0 );
+		std::vector<int> colour ( count );
+		std::vector<std::size_t> offset ( kMaxColours + 2 , 0 );
+
+		for ( std::size_t c = 0; c < count; ++c )
+		{
+			unsigned long long taken = used[first_[c]] | used[second_[c]];
+
+			int k = 0;
+			while ( k < kMaxColours && ( taken & ( 1ULL << k ) ) )
+			{
+				++k;
+			}
+			colour[c] = k;
+			++offset[k + 1];
+
+			if ( k < kMaxColours )
+			{
+				used[first_[c]] |= 1ULL << k;
+				used[second_[c]] |= 1ULL << k;
+			}
+		}
+
+		for ( int k = 0; k <= kMaxColours; ++k )
+		{
+			offset[k + 1] += offset[k];
+		}
+
+		std::vector<unsigned int> first ( count );
+		std::vector<unsigned int> second ( count );
+		std::vector<Real> rest ( count );
+		std::vector<Real> compliance ( count );
+		std::vector<std::size_t> cursor ( offset.begin ( ) , offset.end ( ) - 1 );
+
+		for ( std::size_t c = 0; c < count; ++c )
+		{
+			std::size_t slot = cursor[colour[c]]++;
+			first[slot] = first_[c];
+			second[slot] = second_[c];
+			rest[slot] = rest_[c];
+			compliance[slot] = compliance_[c];
+		}
+
+		first_.swap ( first );
+		second_.swap ( second );
+		rest_.swap ( rest );
+		compliance_.swap ( compliance );
+
+		/// Boundaries of the used colours , the overflow colour last.
+		colours_.clear ( );
+		colours_.push_back ( 0 );
+		for ( int k = 0; k <= kMaxColours; ++k )
+		{
+			if ( offset[k + 1] > offset[k] )
+			{
+				colours_.push_back ( offset[k + 1] );
+			}
+		}
+
+		overflow_ = offset[kMaxColours + 1] > offset[kMaxColours];
+		dirty_ = false;
+	}
+
+	template < class Real >
+	template < class T >
+	inline void PositionBasedDynamics<Real>::kernel ( T a[3] , T b[3] , const T& wa , const T& wb , const T& rest , const T& alpha , T& lambda )
+	{
+		T d[3] = { a[0] - b[0] , a[1] - b[1] , a[2] - b[2] };
+		T squared = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+
+		/// Coincident particles have no direction to push along.
+		typename SIMD::Traits<T>::Mask apart = squared > T ( std::numeric_limits<Real>::min ( ) );
+		T inverse = SIMD::rsqrt ( SIMD::select ( apart , squared , T ( static_cast<Real> ( 1 ) ) ) );
+		T length = squared * inverse;
+
+		T weight = wa + wb + alpha;
+		T delta = SIMD::select ( apart & ( weight > T ( static_cast<Real> ( 0 ) ) ) ,
+		                         ( rest - length - alpha * lambda ) / SIMD::select ( weight > T ( static_cast<Real> ( 0 ) ) , weight , T ( static_cast<Real> ( 1 ) ) ) ,
+		                         T ( static_cast<Real> ( 0 ) ) );
+		lambda += delta;
+
+		for ( int k = 0; k < 3; ++k )
+		{
+			T n = d[k] * inverse * delta;
+			a[k] += n * wa;
+			b[k] -= n * wb;
+		}
+	}
+
+	template < class Real >
+	void PositionBasedDynamics<Real>::project ( std::size_t first , std::size_t last , Real alpha )
+	{
+		for ( std::size_t c = first; c < last; ++c )
+		{
+			Vector3& pa = position_[first_[c]];
+			Vector3& pb = position_[second_[c]];
+
+			Real a[3] = { pa.x , pa.y , pa.z };
+			Real b[3] = { pb.x , pb.y , pb.z };
+
+			kernel<Real> ( a , b , inverseMass_[first_[c]] , inverseMass_[second_[c]] , rest_[c] , compliance_[c] * alpha , lambda_[c] );
+
+			pa = Vector3 ( a[0] , a[1] , a[2] );
+			pb = Vector3 ( b[0] , b[1] , b[2] );
+		}
+	}
+
+	template < class Real >
+	void PositionBasedDynamics<Real>::projectBatch ( std::size_t first , std::size_t last , Real alpha )
+	{
+		project ( first , last , alpha );
+	}
+
+	/// Constraints of one colour share no particle , four go in the lanes.
+	template < >
+	inline void PositionBasedDynamics<float>::projectBatch ( std::size_t first , std::size_t last , float alpha )
+	{
+		std::size_t c = first;
+		const SIMD::Float4 scale ( alpha );
+
+		for ( ; c + 4 <= last; c += 4 )
+		{
+			const unsigned int* ia = &first_[c];
+			const unsigned int* ib = &second_[c];
+
+			SIMD::Float4 a[3];
+			SIMD::Float4 b[3];
+			for ( int k = 0; k < 3; ++k )
+			{
+				a[k] = SIMD::Float4 ( position_[ia[0]][k] , position_[ia[1]][k] , position_[ia[2]][k] , position_[ia[3]][k] );
+				b[k] = SIMD::Float4 ( position_[ib[0]][k] , position_[ib[1]][k] , position_[ib[2]][k] , position_[ib[3]][k] );
+			}
+			SIMD::Float4 wa ( inverseMass_[ia[0]] , inverseMass_[ia[1]] , inverseMass_[ia[2]] , inverseMass_[ia[3]] );
+			SIMD::Float4 wb ( inverseMass_[ib[0]] , inverseMass_[ib[1]] , inverseMass_[ib[2]] , inverseMass_[ib[3]] );
+			SIMD::Float4 lambda = SIMD::Float4::load ( &lambda_[c] );
+
+			kernel<SIMD::Float4> ( a , b , wa , wb , SIMD::Float4::load ( &rest_[c] ) , SIMD::Float4::load ( &compliance_[c] ) * scale , lambda );
+
+			lambda.store ( &lambda_[c] );
+
+			float la[3][4];
+			float lb[3][4];
+			for ( int k = 0; k < 3; ++k )
+			{
+				a[k].store ( la[k] );
+				b[k].store ( lb[k] );
+			}
+			for ( int lane = 0; lane < 4; ++lane )
+			{
+				position_[ia[lane]] = Vector3 ( la[0][lane] , la[1][lane] , la[2][lane] );
+				position_[ib[lane]] = Vector3 ( lb[0][lane] , lb[1][lane] , lb[2][lane] );
+			}
+		}
+
+		project ( c , last , alpha );
+	}
+
+	template < class Real >
+	void PositionBasedDynamics<Real>::collide ( std::size_t first , std::size_t last )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			if ( inverseMass_[i] <= static_cast<Real> ( 0 ) )
+			{
+				continue;
+			}
+
+			Vector3& p = position_[i];
+			bool hit = false;
+			Vector3 normal;
+
+			for ( std::size_t s = 0; s < sphereCenters_.size ( ); ++s )
+			{
+				Vector3 d = p - sphereCenters_[s];
+				Real reach = sphereRadii_[s] + thickness_;
+				Real squared = d * d;
+
+				if ( squared < reach * reach && squared > std::numeric_limits<Real>::min ( ) )
+				{
+					normal = d / std::sqrt ( squared );
+					p = sphereCenters_[s] + normal * reach;
+					hit = true;
+				}
+			}
+
+			for ( std::size_t b = 0; b < boxes_.size ( ); ++b )
+			{
+				const Vector3& lo = boxes_[b].box_min ( );
+				const Vector3& hi = boxes_[b].box_max ( );
+
+				/// Inside the grown box: out through the nearest face.
+				Real depth = std::numeric_limits<Real>::max ( );
+				int axis = -1;
+				Real target = 0;
+
+				for ( int k = 0; k < 3; ++k )
+				{
+					Real below = p[k] - ( lo[k] - thickness_ );
+					Real above = ( hi[k] + thickness_ ) - p[k];
+					if ( below <= static_cast<Real> ( 0 ) || above <= static_cast<Real> ( 0 ) )
+					{
+						axis = -2;
+						break;
+					}
+					if ( below < depth )
+					{
+						depth = below;
+						axis = k;
+						target = lo[k] - thickness_;
+					}
+					if ( above < depth )
+					{
+						depth = above;
+						axis = k;
+						target = hi[k] + thickness_;
+					}
+				}
+
+				if ( axis >= 0 )
+				{
+					normal = Vector3 ( 0 , 0 , 0 );
+					normal[axis] = ( target > p[axis] ) ? static_cast<Real> ( 1 ) : static_cast<Real> ( -1 );
+					p[axis] = target;
+					hit = true;
+				}
+			}
+
+			/// Friction: damp the motion along the surface of this substep.
+			if ( hit )
+			{
+				Vector3 motion = p - previous_[i];
+				Vector3 tangent = motion - normal * ( motion * normal );
+				p -= tangent * friction_;
+			}
+		}
+	}
+
+	template < class Real >
+	void PositionBasedDynamics<Real>::step ( Real dt )
+	{
+		Celer::Timer timer;
+
+		if ( dirty_ )
+		{
+			colour ( );
+		}
+
+		const Real h = dt / static_cast<Real> ( substeps_ );
+		const Real alpha = static_cast<Real> ( 1 ) / ( h * h );
+		const long particles = static_cast<long> ( position_.size ( ) );
+
+		for ( int substep = 0; substep < substeps_; ++substep )
+		{
+			#pragma omp parallel for schedule(static)
+			for ( long i = 0; i < particles; ++i )
+			{
+				previous_[i] = position_[i];
+				if ( inverseMass_[i] > static_cast<Real> ( 0 ) )
+				{
+					velocity_[i] += gravity_ * h;
+					position_[i] += velocity_[i] * h;
+				}
+			}
+
+			std::fill ( lambda_.begin ( ) , lambda_.end ( ) , static_cast<Real> ( 0 ) );
+
+			for ( std::size_t k = 0; k + 1 < colours_.size ( ); ++k )
+			{
+				std::size_t begin = colours_[k];
+				std::size_t end = colours_[k + 1];
+
+				/// The last range may hold the overflow colour , sharing particles.
+				if ( overflow_ && k + 2 == colours_.size ( ) )
+				{
+					project ( begin , end , alpha );
+					continue;
+				}
+
+				long batches = static_cast<long> ( ( end - begin + kBatch - 1 ) / kBatch );
+
+				#pragma omp parallel for schedule(static) if(batches > 1)
+				for ( long b = 0; b < batches; ++b )
+				{
+					std::size_t first = begin + static_cast<std::size_t> ( b ) * kBatch;
+					projectBatch ( first , std::min<std::size_t> ( first + kBatch , end ) , alpha );
+				}
+			}
+
+			long blocks = static_cast<long> ( ( position_.size ( ) + kBatch - 1 ) / kBatch );
+
+			#pragma omp parallel for schedule(static) if(blocks > 1)
+			for ( long b = 0; b < blocks; ++b )
+			{
+				std::size_t first = static_cast<std::size_t> ( b ) * kBatch;
+				std::size_t last = std::min<std::size_t> ( first + kBatch , position_.size ( ) );
+
+				if ( !boxes_.empty ( ) || !sphereCenters_.empty ( ) )
+				{
+					collide ( first , last );
+				}
+				for ( std::size_t i = first; i < last; ++i )
+				{
+					velocity_[i] = ( position_[i] - previous_[i] ) / h;
+				}
+			}
+		}
+
+		elapsed_ = timer.elapsed ( );
+	}
+
+}
+
+#endif /* CELER_POSITIONBASEDDYNAMICS_HPP_ */
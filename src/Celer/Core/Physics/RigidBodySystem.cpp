@@ -0,0 +1,7 @@
+/*
+ * RigidBodySystem.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/RigidBodySystem.hpp>
@@ -0,0 +1,576 @@
+#ifndef CELER_RIGIDBODYSYSTEM_HPP_
+#define CELER_RIGIDBODYSYSTEM_HPP_
+
+//- Celer/Core/Physics/RigidBodySystem.hpp - Rigid body state and stepping //
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the RigidBodySystem class,
+//        the state of many rigid bodies in separate arrays and its
+//        integration with a fixed time step.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix3x3.hpp>
+#include <Celer/Core/Geometry/Math/Quaternion.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class RigidBodySystem.
+	 *@brief Rigid bodies stored one array per attribute.
+	 *@details A body is an index. Each attribute lives in its own array, so
+	 * the integration streams through positions, velocities and orientations
+	 * separately and a solver touching only velocities does not drag the rest
+	 * through the cache.
+	 *
+	 * Bodies with zero inverse mass ignore forces and gravity , they keep the
+	 * velocity they are given , so a static body is one left at rest.
+	 * The inverse inertia is given in body coordinates and its world version is
+	 * refreshed from the orientation after every step , together with the
+	 * world BoundingBox3 of the local bounds.
+	 *
+	 * integrate ( ) advances by one semi-implicit Euler step: velocities first
+	 * from the accumulated forces , then positions and orientations from the
+	 * new velocities , with the orientation renormalized. step ( ) consumes
+	 * frame time in fixed steps and leaves the remainder for the next frame;
+	 * interpolation ( ) is that remainder as a fraction of a step, for
+	 * rendering in between.
+	 *
+	 * \code
+	 * Celer::RigidBodySystem<float> bodies ( 1.0f / 60.0f );
+	 * std::size_t box = bodies.add ( position , orientation , 1.0f / mass ,
+	 *                                Celer::RigidBodySystem<float>::boxInverseInertia ( mass , half ) ,
+	 *                                Celer::BoundingBox3<float> ( -half , half ) );
+	 * bodies.step ( frameSeconds );
+	 * \endcode
+	 */
+	template < class Real >
+	class RigidBodySystem
+	{
+		public:
+
+			typedef Celer::Vector3<Real> 		Vector3;
+			typedef Celer::Quaternion<Real> 	Quaternion;
+			typedef Celer::Matrix3x3<Real> 		Matrix3x3;
+			typedef Celer::BoundingBox3<Real> 	BoundingBox3;
+
+			RigidBodySystem ( Real timeStep = static_cast<Real> ( 1 ) / static_cast<Real> ( 60 ) , int maxSteps = 8 );
+
+			/// Returns the index of the new body. inverseMass 0 makes it static.
+			std::size_t add ( const Vector3& position , const Quaternion& orientation , Real inverseMass ,
+			                  const Matrix3x3& inverseInertia , const BoundingBox3& localBounds );
+
+			void reserve ( std::size_t count );
+			void clear ( );
+
+			std::size_t size ( ) const
+			{
+				return position_.size ( );
+			}
+
+			/// Forces and torques are summed until the next step.
+			void applyForce ( std::size_t body , const Vector3& force )
+			{
+				force_[body] += force;
+			}
+
+			void applyTorque ( std::size_t body , const Vector3& torque )
+			{
+				torque_[body] += torque;
+			}
+
+			/// Force at a world point , adding its torque about the center of mass.
+			void applyForce ( std::size_t body , const Vector3& force , const Vector3& point )
+			{
+				force_[body] += force;
+				torque_[body] += ( point - position_[body] ) ^ force;
+			}
+
+			/// Instant velocity change of an impulse at a world point.
+			void applyImpulse ( std::size_t body , const Vector3& impulse , const Vector3& point )
+			{
+				linearVelocity_[body] += impulse * inverseMass_[body];
+				angularVelocity_[body] += inverseInertiaWorld_[body] * ( ( point - position_[body] ) ^ impulse );
+			}
+
+			/// One semi-implicit Euler step of every body.
+			void integrate ( Real dt );
+
+			/// Advances by whole time steps covering elapsed plus the previous
+			/// remainder , at most maxSteps of them. Returns the steps taken.
+			int step ( Real elapsed );
+
+			/// Refreshes world inertia and bounds , needed after editing the
+			/// orientations or positions by hand.
+			void update ( );
+
+			Real interpolation ( ) const
+			{
+				return accumulator_ / timeStep_;
+			}
+
+			Real timeStep ( ) const
+			{
+				return timeStep_;
+			}
+
+			void setGravity ( const Vector3& gravity )
+			{
+				gravity_ = gravity;
+			}
+
+			const Vector3& gravity ( ) const
+			{
+				return gravity_;
+			}
+
+			/// Seconds spent in the last integrate ( ).
+			double elapsed ( ) const
+			{
+				return elapsed_;
+			}
+
+			std::vector<Vector3>& positions ( )
+			{
+				return position_;
+			}
+
+			std::vector<Quaternion>& orientations ( )
+			{
+				return orientation_;
+			}
+
+			std::vector<Vector3>& linearVelocities ( )
+			{
+				return linearVelocity_;
+			}
+
+			std::vector<Vector3>& angularVelocities ( )
+			{
+				return angularVelocity_;
+			}
+
+			const std::vector<Vector3>& positions ( ) const
+			{
+				return position_;
+			}
+
+			const std::vector<Quaternion>& orientations ( ) const
+			{
+				return orientation_;
+			}
+
+			const std::vector<Vector3>& linearVelocities ( ) const
+			{
+				return linearVelocity_;
+			}
+
+			const std::vector<Vector3>& angularVelocities ( ) const
+			{
+				return angularVelocity_;
+			}
+
+			/// Forces and torques summed since the last step.
+			const std::vector<Vector3>& forces ( ) const
+			{
+				return force_;
+			}
+
+			const std::vector<Vector3>& torques ( ) const
+			{
+				return torque_;
+			}
+
+			const std::vector<Real>& inverseMasses ( ) const
+			{
+				return inverseMass_;
+			}
+
+			const std::vector<Matrix3x3>& inverseInertias ( ) const
+			{
+				return inverseInertiaWorld_;
+			}
+
+			const std::vector<BoundingBox3>& bounds ( ) const
+			{
+				return bounds_;
+			}
+
+			/// Inverse inertia of a solid box of the given half extents.
+			static Matrix3x3 boxInverseInertia ( Real mass , const Vector3& halfExtents );
+
+			/// Inverse inertia of a solid sphere.
+			static Matrix3x3 sphereInverseInertia ( Real mass , Real radius );
+
+		private:
+
+			enum
+			{
+				kBlock = 512
+			};
+
+			template < class T >
+			static void kernel ( T p[3] , T v[3] , T w[3] , T q[4] , const T f[3] , const T tau[3] , const T& inverseMass ,
+			                     const T inertia[9] , const T g[3] , const T& dt );
+
+			void integrate ( std::size_t first , std::size_t last , Real dt );
+			void update ( std::size_t first , std::size_t last );
+
+			std::vector<Vector3> 		position_;
+			std::vector<Quaternion> 	orientation_;
+			std::vector<Vector3> 		linearVelocity_;
+			std::vector<Vector3> 		angularVelocity_;
+			std::vector<Vector3> 		force_;
+			std::vector<Vector3> 		torque_;
+			std::vector<Real> 			inverseMass_;
+			std::vector<Matrix3x3> 		inverseInertiaLocal_;
+			std::vector<Matrix3x3> 		inverseInertiaWorld_;
+			std::vector<BoundingBox3> 	localBounds_;
+			std::vector<BoundingBox3> 	bounds_;
+
+			Vector3 	gravity_;
+			Real 		timeStep_;
+			Real 		accumulator_;
+			int 		maxSteps_;
+			double 		elapsed_;
+	};
+
+	template < class Real >
+	RigidBodySystem<Real>::RigidBodySystem ( Real timeStep , int maxSteps ) :
+		gravity_ ( 0 , static_cast<Real> ( -9.81 ) , 0 ) , timeStep_ ( timeStep ) , accumulator_ ( 0 ) , maxSteps_ ( maxSteps ) , elapsed_ ( 0.0 )
+	{
+	}
+
+	template < class Real >
+	std::size_t RigidBodySystem<Real>::add ( const Vector3& position , const Quaternion& orientation , Real inverseMass ,
+	                                         const Matrix3x3& inverseInertia , const BoundingBox3& localBounds )
+	{
+		std::size_t body = position_.size ( );
+
+		position_.push_back ( position );
+		orientation_.push_back ( orientation );
+		linearVelocity_.push_back ( Vector3 ( 0 , 0 , 0 ) );
+		angularVelocity_.push_back ( Vector3 ( 0 , 0 , 0 ) );
+		force_.push_back ( Vector3 ( 0 , 0 , 0 ) );
+		torque_.push_back ( Vector3 ( 0 , 0 , 0 ) );
+		inverseMass_.push_back ( inverseMass );
+		inverseInertiaLocal_.push_back ( inverseInertia );
+		inverseInertiaWorld_.push_back ( inverseInertia );
+		localBounds_.push_back ( localBounds );
+		bounds_.push_back ( localBounds );
+
+		orientation_.back ( ).normalize ( );
+		update ( body , body + 1 );
+
+		return body;
+	}
+
+	template < class Real >
+	void RigidBodySystem<Real>::reserve ( std::size_t count )
+	{
+		position_.reserve ( count );
+		orientation_.reserve ( count );
+		linearVelocity_.reserve ( count );
+		angularVelocity_.reserve ( count );
+		force_.reserve ( count );
+		torque_.reserve ( count );
+		inverseMass_.reserve ( count );
+		inverseInertiaLocal_.reserve ( count );
+		inverseInertiaWorld_.reserve ( count );
+		localBounds_.reserve ( count );
+		bounds_.reserve ( count );
+	}
+
+	template < class Real >
+	void RigidBodySystem<Real>::clear ( )
+	{
+		position_.clear ( );
+		orientation_.clear ( );
+		linearVelocity_.clear ( );
+		angularVelocity_.clear ( );
+		force_.clear ( );
+		torque_.clear ( );
+		inverseMass_.clear ( );
+		inverseInertiaLocal_.clear ( );
+		inverseInertiaWorld_.clear ( );
+		localBounds_.clear ( );
+		bounds_.clear ( );
+		accumulator_ = static_cast<Real> ( 0 );
+	}
+
+	template < class Real >
+	typename RigidBodySystem<Real>::Matrix3x3 RigidBodySystem<Real>::boxInverseInertia ( Real mass , const Vector3& h )
+	{
+		/// I = m / 3 ( b^2 + c^2 ) for half extents.
+		Real k = static_cast<Real> ( 3 ) / mass;
+		return Matrix3x3 ( k / ( h.y * h.y + h.z * h.z ) , 0 , 0 ,
+		                   0 , k / ( h.x * h.x + h.z * h.z ) , 0 ,
+		                   0 , 0 , k / ( h.x * h.x + h.y * h.y ) );
+	}
+
+	template < class Real >
+	typename RigidBodySystem<Real>::Matrix3x3 RigidBodySystem<Real>::sphereInverseInertia ( Real mass , Real radius )
+	{
+		Real k = static_cast<Real> ( 2.5 ) / ( mass * radius * radius );
+		return Matrix3x3 ( k , 0 , 0 , 0 , k , 0 , 0 , 0 , k );
+	}
+
+	template < class Real >
+	template < class T >
+	inline void RigidBodySystem<Real>::kernel ( T p[3] , T v[3] , T w[3] , T q[4] , const T f[3] , const T tau[3] , const T& inverseMass ,
+	                                            const T inertia[9] , const T g[3] , const T& dt )
+	{
+		/// Static bodies have no inverse mass and get no gravity either.
+		typename SIMD::Traits<T>::Mask dynamic = inverseMass > T ( static_cast<Real> ( 0 ) );
+		T gravity = SIMD::select ( dynamic , dt , T ( static_cast<Real> ( 0 ) ) );
+
+		for ( int k = 0; k < 3; ++k )
+		{
+			v[k] += f[k] * inverseMass * dt + g[k] * gravity;
+			p[k] += v[k] * dt;
+		}
+
+		for ( int k = 0; k < 3; ++k )
+		{
+			w[k] += ( inertia[3 * k] * tau[0] + inertia[3 * k + 1] * tau[1] + inertia[3 * k + 2] * tau[2] ) * dt;
+		}
+
+		/// dq/dt = 1/2 ( 0 , w ) q , then back to unit length.
+		T h = dt * T ( static_cast<Real> ( 0.5 ) );
+		T qw = q[0] - h * ( w[0] * q[1] + w[1] * q[2] + w[2] * q[3] );
+		T qx = q[1] + h * ( w[0] * q[0] + w[1] * q[3] - w[2] * q[2] );
+		T qy = q[2] + h * ( w[1] * q[0] + w[2] * q[1] - w[0] * q[3] );
+		T qz = q[3] + h * ( w[2] * q[0] + w[0] * q[2] - w[1] * q[1] );
+
+		T scale = SIMD::rsqrt ( qw * qw + qx * qx + qy * qy + qz * qz );
+		q[0] = qw * scale;
+		q[1] = qx * scale;
+		q[2] = qy * scale;
+		q[3] = qz * scale;
+	}
+
+	template < class Real >
+	void RigidBodySystem<Real>::integrate ( std::size_t first , std::size_t last , Real dt )
+	{
+		const Real g[3] = { gravity_.x , gravity_.y , gravity_.z };
+
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			Real p[3] = { position_[i].x , position_[i].y , position_[i].z };
+			Real v[3] = { linearVelocity_[i].x , linearVelocity_[i].y , linearVelocity_[i].z };
+			Real w[3] = { angularVelocity_[i].x , angularVelocity_[i].y , angularVelocity_[i].z };
+			Real q[4] = { orientation_[i].w , orientation_[i].x , orientation_[i].y , orientation_[i].z };
+			Real f[3] = { force_[i].x , force_[i].y , force_[i].z };
+			Real tau[3] = { torque_[i].x , torque_[i].y , torque_[i].z };
+			Real inertia[9];
+			for ( int k = 0; k < 9; ++k )
+			{
+				inertia[k] = inverseInertiaWorld_[i][k / 3][k % 3];
+			}
+
+			kernel<Real> ( p , v , w , q , f , tau , inverseMass_[i] , inertia , g , dt );
+
+			position_[i] = Vector3 ( p[0] , p[1] , p[2] );
+			linearVelocity_[i] = Vector3 ( v[0] , v[1] , v[2] );
+			angularVelocity_[i] = Vector3 ( w[0] , w[1] , w[2] );
+			orientation_[i].w = q[0];
+			orientation_[i].x = q[1];
+			orientation_[i].y = q[2];
+			orientation_[i].z = q[3];
+		}
+	}
+
+	/// Four bodies per kernel call , gathered into the lanes of Float4.
+	template < >
+	inline void RigidBodySystem<float>::integrate ( std::size_t first , std::size_t last , float dt )
+	{
+		const SIMD::Float4 g[3] = { SIMD::Float4 ( gravity_.x ) , SIMD::Float4 ( gravity_.y ) , SIMD::Float4 ( gravity_.z ) };
+		const SIMD::Float4 step ( dt );
+
+		std::size_t i = first;
+		for ( ; i + 4 <= last; i += 4 )
+		{
+			SIMD::Float4 p[3];
+			SIMD::Float4 v[3];
+			SIMD::Float4 w[3];
+			SIMD::Float4 f[3];
+			SIMD::Float4 tau[3];
+			SIMD::Float4 q[4];
+			SIMD::Float4 inertia[9];
+
+			/// Vector3 arrays are packed xyz triples.
+			SIMD::loadPoints ( &position_[i].x , p[0] , p[1] , p[2] );
+			SIMD::loadPoints ( &linearVelocity_[i].x , v[0] , v[1] , v[2] );
+			SIMD::loadPoints ( &angularVelocity_[i].x , w[0] , w[1] , w[2] );
+			SIMD::loadPoints ( &force_[i].x , f[0] , f[1] , f[2] );
+			SIMD::loadPoints ( &torque_[i].x , tau[0] , tau[1] , tau[2] );
+
+			q[0] = SIMD::Float4 ( orientation_[i].w , orientation_[i + 1].w , orientation_[i + 2].w , orientation_[i + 3].w );
+			q[1] = SIMD::Float4 ( orientation_[i].x , orientation_[i + 1].x , orientation_[i + 2].x , orientation_[i + 3].x );
+			q[2] = SIMD::Float4 ( orientation_[i].y , orientation_[i + 1].y , orientation_[i + 2].y , orientation_[i + 3].y );
+			q[3] = SIMD::Float4 ( orientation_[i].z , orientation_[i + 1].z , orientation_[i + 2].z , orientation_[i + 3].z );
+
+			for ( int k = 0; k < 9; ++k )
+			{
+				inertia[k] = SIMD::Float4 ( inverseInertiaWorld_[i][k / 3][k % 3] , inverseInertiaWorld_[i + 1][k / 3][k % 3] ,
+				                            inverseInertiaWorld_[i + 2][k / 3][k % 3] , inverseInertiaWorld_[i + 3][k / 3][k % 3] );
+			}
+
+			kernel<SIMD::Float4> ( p , v , w , q , f , tau , SIMD::Float4::load ( &inverseMass_[i] ) , inertia , g , step );
+
+			float lanes[13][4];
+			for ( int k = 0; k < 3; ++k )
+			{
+				p[k].store ( lanes[k] );
+				v[k].store ( lanes[3 + k] );
+				w[k].store ( lanes[6 + k] );
+			}
+			for ( int k = 0; k < 4; ++k )
+			{
+				q[k].store ( lanes[9 + k] );
+			}
+
+			for ( int lane = 0; lane < 4; ++lane )
+			{
+				position_[i + lane] = Vector3 ( lanes[0][lane] , lanes[1][lane] , lanes[2][lane] );
+				linearVelocity_[i + lane] = Vector3 ( lanes[3][lane] , lanes[4][lane] , lanes[5][lane] );
+				angularVelocity_[i + lane] = Vector3 ( lanes[6][lane] , lanes[7][lane] , lanes[8][lane] );
+				orientation_[i + lane].w = lanes[9][lane];
+				orientation_[i + lane].x = lanes[10][lane];
+				orientation_[i + lane].y = lanes[11][lane];
+				orientation_[i + lane].z = lanes[12][lane];
+			}
+		}
+
+		const float gs[3] = { gravity_.x , gravity_.y , gravity_.z };
+		for ( ; i < last; ++i )
+		{
+			float p[3] = { position_[i].x , position_[i].y , position_[i].z };
+			float v[3] = { linearVelocity_[i].x , linearVelocity_[i].y , linearVelocity_[i].z };
+			float w[3] = { angularVelocity_[i].x , angularVelocity_[i].y , angularVelocity_[i].z };
+			float q[4] = { orientation_[i].w , orientation_[i].x , orientation_[i].y , orientation_[i].z };
+			float f[3] = { force_[i].x , force_[i].y , force_[i].z };
+			float tau[3] = { torque_[i].x , torque_[i].y , torque_[i].z };
+			float inertia[9];
+			for ( int k = 0; k < 9; ++k )
+			{
+				inertia[k] = inverseInertiaWorld_[i][k / 3][k % 3];
+			}
+
+			kernel<float> ( p , v , w , q , f , tau , inverseMass_[i] , inertia , gs , dt );
+
+			position_[i] = Vector3 ( p[0] , p[1] , p[2] );
+			linearVelocity_[i] = Vector3 ( v[0] , v[1] , v[2] );
+			angularVelocity_[i] = Vector3 ( w[0] , w[1] , w[2] );
+			orientation_[i].w = q[0];
+			orientation_[i].x = q[1];
+			orientation_[i].y = q[2];
+			orientation_[i].z = q[3];
+		}
+	}
+
+	template < class Real >
+	void RigidBodySystem<Real>::update ( std::size_t first , std::size_t last )
+	{
+		for ( std::size_t i = first; i < last; ++i )
+		{
+			Matrix3x3 r = orientation_[i].to3x3Matrix ( );
+
+			/// R I^-1 R^T
+			inverseInertiaWorld_[i] = r * inverseInertiaLocal_[i] * ( ~r );
+
+			/// World box of the rotated local box: center moved , extents through | R |.
+			Vector3 center = localBounds_[i].center ( );
+			Vector3 half = ( localBounds_[i].box_max ( ) - localBounds_[i].box_min ( ) ) * static_cast<Real> ( 0.5 );
+
+			Vector3 c = r * center + position_[i];
+			Vector3 e ( std::fabs ( r[0].x ) * half.x + std::fabs ( r[0].y ) * half.y + std::fabs ( r[0].z ) * half.z ,
+			            std::fabs ( r[1].x ) * half.x + std::fabs ( r[1].y ) * half.y + std::fabs ( r[1].z ) * half.z ,
+			            std::fabs ( r[2].x ) * half.x + std::fabs ( r[2].y ) * half.y + std::fabs ( r[2].z ) * half.z );
+
+			bounds_[i] = BoundingBox3 ( c - e , c + e );
+
+			force_[i] = Vector3 ( 0 , 0 , 0 );
+			torque_[i] = Vector3 ( 0 , 0 , 0 );
+		}
+	}
+
+	template < class Real >
+	void RigidBodySystem<Real>::update ( )
+	{
+		long blocks = static_cast<long> ( ( size ( ) + kBlock - 1 ) / kBlock );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , size ( ) );
+			update ( first , last );
+		}
+	}
+
+	template < class Real >
+	void RigidBodySystem<Real>::integrate ( Real dt )
+	{
+		Celer::Timer timer;
+
+		long blocks = static_cast<long> ( ( size ( ) + kBlock - 1 ) / kBlock );
+
+		/// Each block integrates and then refreshes its own bodies , so they are
+		/// still in cache for the second pass.
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = static_cast<std::size_t> ( b ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , size ( ) );
+			integrate ( first , last , dt );
+			update ( first , last );
+		}
+
+		elapsed_ = timer.elapsed ( );
+	}
+
+	template < class Real >
+	int RigidBodySystem<Real>::step ( Real elapsed )
+	{
+		accumulator_ += elapsed;
+
+		int steps = 0;
+		while ( accumulator_ >= timeStep_ && steps < maxSteps_ )
+		{
+			integrate ( timeStep_ );
+			accumulator_ -= timeStep_;
+			++steps;
+		}
+
+		/// Falling behind: drop the backlog rather than spiral.
+		if ( steps == maxSteps_ )
+		{
+			accumulator_ = std::min ( accumulator_ , timeStep_ );
+		}
+
+		return steps;
+	}
+
+}
+
+#endif /* CELER_RIGIDBODYSYSTEM_HPP_ */
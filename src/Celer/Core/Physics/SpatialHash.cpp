@@ -0,0 +1,7 @@
+/*
+ * SpatialHash.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/SpatialHash.hpp>
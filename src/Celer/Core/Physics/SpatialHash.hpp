@@ -0,0 +1,721 @@
+#ifndef CELER_SPATIALHASH_HPP_
+#define CELER_SPATIALHASH_HPP_
+
+//- Celer/Core/Physics/SpatialHash.hpp - Fixed radius neighbours ----------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the SpatialHash class, the
+//        cell grid which builds the neighbour lists of particle fluids.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class SpatialHash.
+	 *@brief Fixed radius neighbour lists rebuilt every step, for SPH.
+	 *@details Space is split in cubic cells of side radius ( ), so the
+	 * neighbours of a particle lie in the 27 cells around its own. Particles
+	 * are counting sorted by cell: a histogram, a prefix sum and a scatter,
+	 * all in parallel. Each cell is then a contiguous range of the sorted
+	 * order.
+	 *
+	 * Cells are numbered over the bounding box of the particles, row by row
+	 * ( LINEAR ) or along the Z-order curve ( MORTON ), which keeps the 27
+	 * cells around a particle closer in memory. When the box has too many
+	 * cells for the particle count , such as a few droplets far from the
+	 * fluid , the cell coordinates are hashed into a table of twice the
+	 * particle count instead , and the distance test drops the collisions.
+	 *
+	 * The neighbour lists index the sorted order , not the input one.
+	 * reorder ( ) applies the sort to every per-particle array , so the
+	 * solver reads neighbours from contiguous memory. Since particles move
+	 * little between steps , the next build finds them almost sorted.
+	 *
+	 * \code
+	 * Celer::SpatialHash<float> grid ( h );
+	 * grid.build ( &position[0] , position.size ( ) );
+	 * grid.reorder ( position );
+	 * grid.reorder ( velocity );
+	 * for ( std::size_t i = 0; i < grid.size ( ); ++i )
+	 *     for ( const unsigned int* j = grid.begin ( i ); j != grid.end ( i ); ++j )
+	 *         density[i] += kernel ( position[i] - position[*j] );
+	 * \endcode
+	 */
+	template < class Real >
+	class SpatialHash
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			/// How the cells of the bounding box are numbered.
+			enum Ordering
+			{
+				LINEAR ,	///< x first , then y , then z.
+				MORTON 		///< Interleaved coordinate bits , the Z-order curve.
+			};
+
+			SpatialHash ( Real radius , Ordering ordering = MORTON );
+
+			/*!@brief Sorts the particles by cell and builds their neighbour lists.
+			 * @param[in] positions Particle positions.
+			 * @param[in] count Number of particles.
+			 * The lists hold the particles closer than radius ( ) , without the
+			 * particle itself , as indices of the sorted order.
+			 */
+			void build ( const Vector3* positions , std::size_t count );
+
+			void build ( const std::vector<Vector3>& positions )
+			{
+				build ( positions.empty ( ) ? 0 : &positions[0] , positions.size ( ) );
+			}
+
+			/// Puts data , one value per particle , in the sorted order.
+			template < class T >
+			void reorder ( T* data ) const;
+
+			template < class T >
+			void reorder ( std::vector<T>& data ) const;
+
+			void setRadius ( Real radius )
+			{
+				radius_ = radius;
+			}
+
+			Real radius ( ) const
+			{
+				return radius_;
+			}
+
+			void setOrdering ( Ordering ordering )
+			{
+				ordering_ = ordering;
+			}
+
+			Ordering ordering ( ) const
+			{
+				return ordering_;
+			}
+
+			std::size_t size ( ) const
+			{
+				return permutation_.size ( );
+			}
+
+			/// First neighbour of the sorted particle i.
+			const unsigned int* begin ( std::size_t i ) const
+			{
+				return &neighbours_[0] + offsets_[i];
+			}
+
+			const unsigned int* end ( std::size_t i ) const
+			{
+				return &neighbours_[0] + offsets_[i + 1];
+			}
+
+			std::size_t neighbourCount ( std::size_t i ) const
+			{
+				return offsets_[i + 1] - offsets_[i];
+			}
+
+			/// Neighbours of the sorted particle i are neighbours ( ) [ offsets ( ) [i] , offsets ( ) [i + 1] ).
+			const std::vector<unsigned int>& offsets ( ) const
+			{
+				return offsets_;
+			}
+
+			const std::vector<unsigned int>& neighbours ( ) const
+			{
+				return neighbours_;
+			}
+
+			/// Input index of each sorted particle.
+			const std::vector<unsigned int>& permutation ( ) const
+			{
+				return permutation_;
+			}
+
+			/// Positions in the sorted order.
+			const std::vector<Vector3>& sortedPositions ( ) const
+			{
+				return sorted_;
+			}
+
+			/// Cell slots , the box cells or the hash table size.
+			std::size_t cells ( ) const
+			{
+				return cellStart_.empty ( ) ? 0 : cellStart_.size ( ) - 1;
+			}
+
+			/// True when the last build fell back to hashing.
+			bool hashed ( ) const
+			{
+				return hashed_;
+			}
+
+			/// Seconds spent sorting and listing by the last build ( ).
+			double sortElapsed ( ) const
+			{
+				return sortElapsed_;
+			}
+
+			double listElapsed ( ) const
+			{
+				return listElapsed_;
+			}
+
+			double elapsed ( ) const
+			{
+				return sortElapsed_ + listElapsed_;
+			}
+
+		private:
+
+			enum
+			{
+				kBlock = 1024 ,
+				kMinTable = 1 << 12 ,
+				kMortonBits = 10 ,
+				kLoad = 4 	///< Box cells allowed per particle before hashing.
+			};
+
+			/// Truncation corrected towards minus infinity.
+			static int floorToInt ( Real value )
+			{
+				int truncated = static_cast<int> ( value );
+
+				return truncated - ( value < static_cast<Real> ( truncated ) );
+			}
+
+			/// Spreads the low 10 bits of v two bits apart.
+			static unsigned int spread ( unsigned int v )
+			{
+				v &= 0x000003ffu;
+				v = ( v | ( v << 16 ) ) & 0x030000ffu;
+				v = ( v | ( v << 8 ) ) & 0x0300f00fu;
+				v = ( v | ( v << 4 ) ) & 0x030c30c3u;
+				v = ( v | ( v << 2 ) ) & 0x09249249u;
+				return v;
+			}
+
+			/// In place exclusive prefix sum , returns the total.
+			static unsigned int scan ( unsigned int* values , std::size_t count );
+
+			void coordinates ( const Vector3& p , int cell[3] ) const;
+			unsigned int key ( const int cell[3] ) const;
+			void bound ( const Vector3* positions , std::size_t count );
+			void sort ( const Vector3* positions , std::size_t count );
+			void list ( );
+
+			/// Appends the particles of the sorted range [first , last) closer than
+			/// radius to particle i.
+			void gather ( std::size_t i , std::size_t first , std::size_t last , Real radius2 , std::vector<unsigned int>& list ) const;
+
+			Real 						radius_;
+			Ordering 					ordering_;
+
+			Vector3 					origin_;
+			Real 						inverse_;
+			int 						dimensions_[3];
+			bool 						hashed_;
+			unsigned int 				mask_;
+
+			std::vector<unsigned int> 	key_;
+			std::vector<unsigned int> 	cellStart_;
+			std::vector<unsigned int> 	cursor_;
+			std::vector<unsigned int> 	permutation_;
+			std::vector<Vector3> 		sorted_;
+
+			std::vector<unsigned int> 	offsets_;
+			std::vector<unsigned int> 	neighbours_;
+			std::vector<std::vector<unsigned int> > blockLists_;
+
+			double 						sortElapsed_;
+			double 						listElapsed_;
+	};
+
+	template < class Real >
+	SpatialHash<Real>::SpatialHash ( Real radius , Ordering ordering ) :
+		radius_ ( radius ) , ordering_ ( ordering ) , origin_ ( 0 , 0 , 0 ) , inverse_ ( 1 ) , hashed_ ( false ) , mask_ ( 0 ) ,
+		sortElapsed_ ( 0.0 ) , listElapsed_ ( 0.0 )
+	{
+		dimensions_[0] = dimensions_[1] = dimensions_[2] = 0;
+	}
+
+	template < class Real >
+	unsigned int SpatialHash<Real>::scan ( unsigned int* values , std::size_t count )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		std::vector<unsigned int> sums ( blocks + 1 , 0 );
+
+		#pragma omp parallel for schedule(static)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = b * kBlock;
+			std::size_t last = std::min ( first + kBlock , count );
+			unsigned int sum = 0;
+
+			for ( std::size_t i = first; i < last; ++i )
+			{
+				sum += values[i];
+			}
+			sums[b + 1] = sum;
+		}
+
+		for ( long b = 0; b < blocks; ++b )
+		{
+			sums[b + 1] += sums[b];
+		}
+
+		#pragma omp parallel for schedule(static)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = b * kBlock;
+			std::size_t last = std::min ( first + kBlock , count );
+			unsigned int sum = sums[b];
+
+			for ( std::size_t i = first; i < last; ++i )
+			{
+				unsigned int value = values[i];
+				values[i] = sum;
+				sum += value;
+			}
+		}
+
+		return sums[blocks];
+	}
+
+	template < class Real >
+	void SpatialHash<Real>::coordinates ( const Vector3& p , int cell[3] ) const
+	{
+		cell[0] = std::min ( floorToInt ( ( p.x - origin_.x ) * inverse_ ) , dimensions_[0] - 1 );
+		cell[1] = std::min ( floorToInt ( ( p.y - origin_.y ) * inverse_ ) , dimensions_[1] - 1 );
+		cell[2] = std::min ( floorToInt ( ( p.z - origin_.z ) * inverse_ ) , dimensions_[2] - 1 );
+	}
+
+	template < class Real >
+	unsigned int SpatialHash<Real>::key ( const int cell[3] ) const
+	{
+		unsigned int x = static_cast<unsigned int> ( cell[0] );
+		unsigned int y = static_cast<unsigned int> ( cell[1] );
+		unsigned int z = static_cast<unsigned int> ( cell[2] );
+
+		if ( hashed_ )
+		{
+			unsigned int h = ( x * 73856093u ) ^ ( y * 19349663u ) ^ ( z * 83492791u );
+			h ^= h >> 16;
+			h *= 0x85ebca6bu;
+			h ^= h >> 13;
+			return h & mask_;
+		}
+
+		if ( ordering_ == MORTON )
+		{
+			return spread ( x ) | ( spread ( y ) << 1 ) | ( spread ( z ) << 2 );
+		}
+
+		return ( z * dimensions_[1] + y ) * dimensions_[0] + x;
+	}
+
+	template < class Real >
+	void SpatialHash<Real>::bound ( const Vector3* positions , std::size_t count )
+	{
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		std::vector<Vector3> low ( blocks );
+		std::vector<Vector3> high ( blocks );
+
+		#pragma omp parallel for schedule(static)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = b * kBlock;
+			std::size_t last = std::min ( first + kBlock , count );
+			Vector3 l = positions[first];
+			Vector3 h = positions[first];
+
+			for ( std::size_t i = first + 1; i < last; ++i )
+			{
+				const Vector3& p = positions[i];
+				l.x = std::min ( l.x , p.x ); h.x = std::max ( h.x , p.x );
+				l.y = std::min ( l.y , p.y ); h.y = std::max ( h.y , p.y );
+				l.z = std::min ( l.z , p.z ); h.z = std::max ( h.z , p.z );
+			}
+			low[b] = l;
+			high[b] = h;
+		}
+
+		Vector3 l = low[0];
+		Vector3 h = high[0];
+		for ( long b = 1; b < blocks; ++b )
+		{
+			l.x = std::min ( l.x , low[b].x ); h.x = std::max ( h.x , high[b].x );
+			l.y = std::min ( l.y , low[b].y ); h.y = std::max ( h.y , high[b].y );
+			l.z = std::min ( l.z , low[b].z ); h.z = std::max ( h.z , high[b].z );
+		}
+
+		origin_ = l;
+		inverse_ = static_cast<Real> ( 1 ) / radius_;
+
+		/// Cell counts as doubles , a far particle may not fit an int.
+		double extent[3] = { ( h.x - l.x ) * inverse_ , ( h.y - l.y ) * inverse_ , ( h.z - l.z ) * inverse_ };
+		double limit = static_cast<double> ( std::max<std::size_t> ( kLoad * count , kMinTable ) );
+		double boxCells = 1.0;
+		double side = 1.0;
+
+		for ( int k = 0; k < 3; ++k )
+		{
+			double cells = std::min ( extent[k] + 1.0 , static_cast<double> ( std::numeric_limits<int>::max ( ) / 2 ) );
+			dimensions_[k] = static_cast<int> ( cells );
+			boxCells *= dimensions_[k];
+			side = std::max ( side , static_cast<double> ( dimensions_[k] ) );
+		}
+
+		std::size_t slots = 0;
+
+		if ( ordering_ == MORTON )
+		{
+			unsigned int power = 1;
+			while ( power < side && power < ( 1u << kMortonBits ) )
+			{
+				power <<= 1;
+			}
+
+			hashed_ = ( side > power ) || ( static_cast<double> ( power ) * power * power > limit );
+			slots = static_cast<std::size_t> ( power ) * power * power;
+		}
+		else
+		{
+			hashed_ = boxCells > limit;
+			slots = static_cast<std::size_t> ( boxCells );
+		}
+
+		if ( hashed_ )
+		{
+			slots = kMinTable;
+			while ( slots < 2 * count )
+			{
+				slots <<= 1;
+			}
+			mask_ = static_cast<unsigned int> ( slots - 1 );
+		}
+
+		cellStart_.resize ( slots + 1 );
+	}
+
+	template < class Real >
+	void SpatialHash<Real>::sort ( const Vector3* positions , std::size_t count )
+	{
+		long n = static_cast<long> ( count );
+		long slots = static_cast<long> ( cellStart_.size ( ) - 1 );
+
+		key_.resize ( count );
+		permutation_.resize ( count );
+		sorted_.resize ( count );
+
+		#pragma omp parallel for schedule(static)
+		for ( long c = 0; c <= slots; ++c )
+		{
+			cellStart_[c] = 0;
+		}
+
+		/// Histogram of the cell keys.
+		#pragma omp parallel for schedule(static)
+		for ( long i = 0; i < n; ++i )
+		{
+			int cell[3];
+			coordinates ( positions[i] , cell );
+			unsigned int k = key ( cell );
+			key_[i] = k;
+
+			#pragma omp atomic
+			++cellStart_[k];
+		}
+
+		scan ( &cellStart_[0] , cellStart_.size ( ) );
+		cursor_.assign ( cellStart_.begin ( ) , cellStart_.end ( ) - 1 );
+
+		/// Scatter , the order inside a cell depends on the threads.
+		#pragma omp parallel for schedule(static)
+		for ( long i = 0; i < n; ++i )
+		{
+			unsigned int slot;
+
+			#pragma omp atomic capture
+			slot = cursor_[key_[i]]++;
+
+			permutation_[slot] = static_cast<unsigned int> ( i );
+		}
+
+		/// So restore the input order inside each cell , cells hold few particles.
+		#pragma omp parallel for schedule(dynamic, kBlock)
+		for ( long c = 0; c < slots; ++c )
+		{
+			unsigned int* first = &permutation_[0] + cellStart_[c];
+			unsigned int* last = &permutation_[0] + cellStart_[c + 1];
+
+			for ( unsigned int* p = first + 1; p < last; ++p )
+			{
+				unsigned int value = *p;
+				unsigned int* q = p;
+
+				while ( q > first && *( q - 1 ) > value )
+				{
+					*q = *( q - 1 );
+					--q;
+				}
+				*q = value;
+			}
+		}
+
+		#pragma omp parallel for schedule(static)
+		for ( long i = 0; i < n; ++i )
+		{
+			sorted_[i] = positions[permutation_[i]];
+		}
+	}
+
+	template < class Real >
+	void SpatialHash<Real>::gather ( std::size_t i , std::size_t first , std::size_t last , Real radius2 , std::vector<unsigned int>& list ) const
+	{
+		const Vector3& p = sorted_[i];
+
+		for ( std::size_t j = first; j < last; ++j )
+		{
+			Vector3 d = sorted_[j] - p;
+
+			if ( ( d * d < radius2 ) && ( j != i ) )
+			{
+				list.push_back ( static_cast<unsigned int> ( j ) );
+			}
+		}
+	}
+
+	template < >
+	inline void SpatialHash<float>::gather ( std::size_t i , std::size_t first , std::size_t last , float radius2 , std::vector<unsigned int>& list ) const
+	{
+		const SIMD::Float4 px ( sorted_[i].x );
+		const SIMD::Float4 py ( sorted_[i].y );
+		const SIMD::Float4 pz ( sorted_[i].z );
+		const SIMD::Float4 r2 ( radius2 );
+
+		std::size_t j = first;
+
+		for ( ; j + 4 <= last; j += 4 )
+		{
+			SIMD::Float4 x , y , z;
+			SIMD::loadPoints ( &sorted_[j].x , x , y , z );
+
+			x = x - px;
+			y = y - py;
+			z = z - pz;
+
+			int bits = ( x * x + y * y + z * z < r2 ).bits ( );
+
+			for ( int lane = 0; bits; ++lane , bits >>= 1 )
+			{
+				if ( ( bits & 1 ) && ( j + lane != i ) )
+				{
+					list.push_back ( static_cast<unsigned int> ( j + lane ) );
+				}
+			}
+		}
+
+		for ( ; j < last; ++j )
+		{
+			Vector3 d = sorted_[j] - sorted_[i];
+
+			if ( ( d * d < radius2 ) && ( j != i ) )
+			{
+				list.push_back ( static_cast<unsigned int> ( j ) );
+			}
+		}
+	}
+
+	template < class Real >
+	void SpatialHash<Real>::list ( )
+	{
+		std::size_t count = sorted_.size ( );
+		long blocks = static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+		Real radius2 = radius_ * radius_;
+
+		offsets_.resize ( count + 1 );
+		if ( blockLists_.size ( ) < static_cast<std::size_t> ( blocks ) )
+		{
+			blockLists_.resize ( blocks );
+		}
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			std::size_t first = b * kBlock;
+			std::size_t last = std::min ( first + kBlock , count );
+			std::vector<unsigned int>& list = blockLists_[b];
+			list.clear ( );
+
+			/// Ranges of the 27 cells around the current cell.
+			unsigned int rangeFirst[27];
+			unsigned int rangeLast[27];
+			unsigned int keys[27];
+			int ranges = 0;
+			int seen = 0;
+			int current[3] = { -1 , -1 , -1 };
+
+			for ( std::size_t i = first; i < last; ++i )
+			{
+				int cell[3];
+				coordinates ( sorted_[i] , cell );
+
+				if ( cell[0] != current[0] || cell[1] != current[1] || cell[2] != current[2] )
+				{
+					current[0] = cell[0];
+					current[1] = cell[1];
+					current[2] = cell[2];
+					ranges = 0;
+					seen = 0;
+
+					for ( int dz = -1; dz <= 1; ++dz )
+					{
+						for ( int dy = -1; dy <= 1; ++dy )
+						{
+							for ( int dx = -1; dx <= 1; ++dx )
+							{
+								int around[3] = { cell[0] + dx , cell[1] + dy , cell[2] + dz };
+
+								if ( around[0] < 0 || around[1] < 0 || around[2] < 0 ||
+								     around[0] >= dimensions_[0] || around[1] >= dimensions_[1] || around[2] >= dimensions_[2] )
+								{
+									continue;
+								}
+
+								unsigned int k = key ( around );
+
+								if ( cellStart_[k] == cellStart_[k + 1] )
+								{
+									continue;
+								}
+
+								/// Hashed cells may share a slot , list it once.
+								if ( hashed_ && std::find ( keys , keys + seen , k ) != keys + seen )
+								{
+									continue;
+								}
+
+								keys[seen++] = k;
+
+								/// Cells adjacent in the sorted order are one range.
+								if ( ranges > 0 && rangeLast[ranges - 1] == cellStart_[k] )
+								{
+									rangeLast[ranges - 1] = cellStart_[k + 1];
+									continue;
+								}
+
+								rangeFirst[ranges] = cellStart_[k];
+								rangeLast[ranges] = cellStart_[k + 1];
+								++ranges;
+							}
+						}
+					}
+				}
+
+				std::size_t before = list.size ( );
+
+				for ( int r = 0; r < ranges; ++r )
+				{
+					gather ( i , rangeFirst[r] , rangeLast[r] , radius2 , list );
+				}
+
+				offsets_[i] = static_cast<unsigned int> ( list.size ( ) - before );
+			}
+		}
+
+		offsets_[count] = 0;
+		unsigned int total = scan ( &offsets_[0] , offsets_.size ( ) );
+		neighbours_.resize ( std::max ( total , 1u ) );
+
+		#pragma omp parallel for schedule(static)
+		for ( long b = 0; b < blocks; ++b )
+		{
+			const std::vector<unsigned int>& list = blockLists_[b];
+			std::copy ( list.begin ( ) , list.end ( ) , neighbours_.begin ( ) + offsets_[b * kBlock] );
+		}
+	}
+
+	template < class Real >
+	void SpatialHash<Real>::build ( const Vector3* positions , std::size_t count )
+	{
+		Celer::Timer timer;
+
+		if ( count == 0 )
+		{
+			key_.clear ( );
+			permutation_.clear ( );
+			sorted_.clear ( );
+			cellStart_.clear ( );
+			offsets_.assign ( 1 , 0 );
+			neighbours_.assign ( 1 , 0 );
+			sortElapsed_ = listElapsed_ = 0.0;
+			return;
+		}
+
+		bound ( positions , count );
+		sort ( positions , count );
+		sortElapsed_ = timer.elapsed ( );
+
+		list ( );
+		listElapsed_ = timer.elapsed ( ) - sortElapsed_;
+	}
+
+	template < class Real >
+	template < class T >
+	void SpatialHash<Real>::reorder ( T* data ) const
+	{
+		std::vector<T> sorted ( permutation_.size ( ) );
+		long n = static_cast<long> ( permutation_.size ( ) );
+
+		#pragma omp parallel for schedule(static)
+		for ( long i = 0; i < n; ++i )
+		{
+			sorted[i] = data[permutation_[i]];
+		}
+
+		std::copy ( sorted.begin ( ) , sorted.end ( ) , data );
+	}
+
+	template < class Real >
+	template < class T >
+	void SpatialHash<Real>::reorder ( std::vector<T>& data ) const
+	{
+		std::vector<T> sorted ( permutation_.size ( ) );
+		long n = static_cast<long> ( permutation_.size ( ) );
+
+		#pragma omp parallel for schedule(static)
+		for ( long i = 0; i < n; ++i )
+		{
+			sorted[i] = data[permutation_[i]];
+		}
+
+		data.swap ( sorted );
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_SPATIALHASH_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * SupportMapping.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Core/Physics/SupportMapping.hpp>
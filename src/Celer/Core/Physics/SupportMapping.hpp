@@ -0,0 +1,309 @@
+#ifndef CELER_SUPPORTMAPPING_HPP_
+#define CELER_SUPPORTMAPPING_HPP_
+
+//- Celer/Core/Physics/SupportMapping.hpp - Support mappings --------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Physics Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the support mapping functors of the convex
+//        shapes handled by GilbertJohnsonKeerthi and ExpandingPolytope.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstddef>
+#include <cmath>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Vector3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix3x3.hpp>
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@brief Support mappings are plain functors, not a class hierarchy , so the
+	 * narrowphase templates inline them and no virtual call sits in the GJK
+	 * loop. A shape provides:
+	 *
+	 * - Vector3 support ( const Vector3& direction ) const: a point of the core
+	 *   shape furthest along direction , which need not be normalized.
+	 * - Real radius ( ) const: the margin swept around the core, so a sphere is
+	 *   a point core with a radius and a capsule a segment core with a radius.
+	 * - Vector3 center ( ) const: any point inside the core , seeds the search.
+	 *
+	 * GJK and EPA run on the cores and the margins are added afterwards, which
+	 * is exact for convex shapes and keeps round shapes out of EPA.
+	 */
+
+	template < class Real >
+	class SphereSupport
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			SphereSupport ( ) : radius_ ( 0 )
+			{
+			}
+
+			SphereSupport ( const Vector3& center , Real radius ) : center_ ( center ) , radius_ ( radius )
+			{
+			}
+
+			Vector3 support ( const Vector3& ) const
+			{
+				return center_;
+			}
+
+			Real radius ( ) const
+			{
+				return radius_;
+			}
+
+			Vector3 center ( ) const
+			{
+				return center_;
+			}
+
+		private:
+
+			Vector3 center_;
+			Real radius_;
+	};
+
+	template < class Real >
+	class CapsuleSupport
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			CapsuleSupport ( ) : radius_ ( 0 )
+			{
+			}
+
+			/// Segment from first to second , swept by radius.
+			CapsuleSupport ( const Vector3& first , const Vector3& second , Real radius ) : first_ ( first ) , second_ ( second ) , radius_ ( radius )
+			{
+			}
+
+			Vector3 support ( const Vector3& direction ) const
+			{
+				return ( direction * ( second_ - first_ ) > static_cast<Real> ( 0 ) ) ? second_ : first_;
+			}
+
+			Real radius ( ) const
+			{
+				return radius_;
+			}
+
+			Vector3 center ( ) const
+			{
+				return ( first_ + second_ ) * static_cast<Real> ( 0.5 );
+			}
+
+		private:
+
+			Vector3 first_;
+			Vector3 second_;
+			Real radius_;
+	};
+
+	/// Axis aligned box , wraps a BoundingBox3.
+	template < class Real >
+	class BoxSupport
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			BoxSupport ( )
+			{
+			}
+
+			BoxSupport ( const Celer::BoundingBox3<Real>& box ) : min_ ( box.box_min ( ) ) , max_ ( box.box_max ( ) )
+			{
+			}
+
+			Vector3 support ( const Vector3& direction ) const
+			{
+				return Vector3 ( direction.x < static_cast<Real> ( 0 ) ? min_.x : max_.x ,
+				                 direction.y < static_cast<Real> ( 0 ) ? min_.y : max_.y ,
+				                 direction.z < static_cast<Real> ( 0 ) ? min_.z : max_.z );
+			}
+
+			Real radius ( ) const
+			{
+				return static_cast<Real> ( 0 );
+			}
+
+			Vector3 center ( ) const
+			{
+				return ( min_ + max_ ) * static_cast<Real> ( 0.5 );
+			}
+
+		private:
+
+			Vector3 min_;
+			Vector3 max_;
+	};
+
+	template < class Real >
+	class OrientedBoxSupport
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			OrientedBoxSupport ( )
+			{
+			}
+
+			/// The rows of axes are the unit box axes , extents the half sizes along them.
+			OrientedBoxSupport ( const Vector3& center , const Celer::Matrix3x3<Real>& axes , const Vector3& extents ) : center_ ( center ) , extents_ ( extents )
+			{
+				axis_[0] = axes[0];
+				axis_[1] = axes[1];
+				axis_[2] = axes[2];
+			}
+
+			Vector3 support ( const Vector3& direction ) const
+			{
+				Vector3 p = center_;
+				for ( int k = 0; k < 3; ++k )
+				{
+					Real e = ( direction * axis_[k] < static_cast<Real> ( 0 ) ) ? -extents_[k] : extents_[k];
+					p += axis_[k] * e;
+				}
+				return p;
+			}
+
+			Real radius ( ) const
+			{
+				return static_cast<Real> ( 0 );
+			}
+
+			Vector3 center ( ) const
+			{
+				return center_;
+			}
+
+		private:
+
+			Vector3 center_;
+			Vector3 axis_[3];
+			Vector3 extents_;
+	};
+
+	/// Convex hull of a vertex array , for instance ConvexHull::vertices ( ).
+	/// The array is not copied and has to outlive the functor.
+	template < class Real >
+	class HullSupport
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			HullSupport ( ) : vertices_ ( 0 ) , count_ ( 0 )
+			{
+			}
+
+			HullSupport ( const Vector3* vertices , std::size_t count ) : vertices_ ( vertices ) , count_ ( count )
+			{
+				for ( std::size_t i = 0; i < count_; ++i )
+				{
+					center_ += vertices_[i];
+				}
+				if ( count_ > 0 )
+				{
+					center_ /= static_cast<Real> ( count_ );
+				}
+			}
+
+			Vector3 support ( const Vector3& direction ) const
+			{
+				std::size_t best = 0;
+				Real height = direction * vertices_[0];
+
+				for ( std::size_t i = 1; i < count_; ++i )
+				{
+					Real h = direction * vertices_[i];
+					if ( h > height )
+					{
+						height = h;
+						best = i;
+					}
+				}
+				return vertices_[best];
+			}
+
+			Real radius ( ) const
+			{
+				return static_cast<Real> ( 0 );
+			}
+
+			Vector3 center ( ) const
+			{
+				return center_;
+			}
+
+		private:
+
+			const Vector3* vertices_;
+			std::size_t count_;
+			Vector3 center_;
+	};
+
+	/// Any of the shapes above given in local coordinates , placed by a
+	/// rotation and a translation: x_world = rotation * x_local + translation.
+	template < class Shape , class Real >
+	class TransformedSupport
+	{
+		public:
+
+			typedef Celer::Vector3<Real> Vector3;
+
+			TransformedSupport ( )
+			{
+			}
+
+			TransformedSupport ( const Shape& shape , const Celer::Matrix3x3<Real>& rotation , const Vector3& translation ) :
+				shape_ ( shape ) , rotation_ ( rotation ) , translation_ ( translation )
+			{
+			}
+
+			Vector3 support ( const Vector3& direction ) const
+			{
+				/// rotation^T * direction
+				Vector3 local = rotation_[0] * direction.x + rotation_[1] * direction.y + rotation_[2] * direction.z;
+				return rotation_ * shape_.support ( local ) + translation_;
+			}
+
+			Real radius ( ) const
+			{
+				return shape_.radius ( );
+			}
+
+			Vector3 center ( ) const
+			{
+				return rotation_ * shape_.center ( ) + translation_;
+			}
+
+		private:
+
+			Shape shape_;
+			Celer::Matrix3x3<Real> rotation_;
+			Vector3 translation_;
+	};
+
+}
+
+#endif /* CELER_SUPPORTMAPPING_HPP_ */
@@ -75,6 +75,15 @@ namespace Celer
                         glBufferDataARB ( target_ , size , data , usage );
                 }
 
+                void PixelBuffer::setData ( const Celer::MappedFile& file , std::size_t offset , unsigned size , GLenum usage )
+                {
+                        assert ( offset <= file.size ( ) && size <= file.size ( ) - offset );
+
+                        // The driver reads the pages once , ask for all of them up front instead of one fault at a time.
+                        file.prefetch ( offset , size );
+                        glBufferDataARB ( target_ , size , file.data ( ) + offset , usage );
+                }
+
                 void PixelBuffer::setSubData ( unsigned offs , unsigned size , const void * data )
                 {
                         // TODO Tests if the Buffer is bound. Is this really important ?
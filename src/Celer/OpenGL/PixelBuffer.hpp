@@ -28,6 +28,8 @@
 
 /// Base			- This class can't be copied.
 #include "Celer/Base/Base.hpp"
+/// Base			- Zero copy uploads from a mapped file.
+#include "Celer/Base/MappedFile.hpp"
 
 namespace Celer
 {
@@ -52,6 +54,8 @@ namespace Celer
                                 bool 			bind         ( GLenum target );
                                 bool 			unbind       ( );
                                 void 			setData      ( unsigned size , const void * ptr , GLenum usage );
+                                /// Uploads size bytes at offset of file, straight from the mapping.
+                                void 			setData      ( const Celer::MappedFile& file , std::size_t offset , unsigned size , GLenum usage );
                                 void 			setSubData   ( unsigned offs , unsigned size , const void * ptr );
                                 void 			getSubData   ( unsigned offs , unsigned size , void * ptr );
                                 void* 			map          ( GLenum access );
@@ -0,0 +1,7 @@
+/*
+ * EntityRegistry.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Scene/EntityRegistry.hpp>
@@ -0,0 +1,349 @@
+#ifndef CELER_ENTITYREGISTRY_HPP_
+#define CELER_ENTITYREGISTRY_HPP_
+
+//- Celer/Scene/EntityRegistry.hpp - Scene objects as packed components ----//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Scene Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the EntityRegistry class ,
+//        which hands out entity ids and keeps the transforms , bounds and
+//        render handles of the scene objects in sparse sets.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/BoundingBox3.hpp>
+#include <Celer/Core/Geometry/Math/Matrix4x4.hpp>
+#include <Celer/Core/Geometry/Math/Transform.hpp>
+#include <Celer/Scene/SparseSet.hpp>
+
+namespace Celer
+{
+	/// What the renderer draws an entity with , ids into its own tables.
+	struct RenderHandle
+	{
+		uint32_t mesh;
+		uint32_t material;
+		uint32_t flags;
+
+		RenderHandle ( )
+			: mesh ( 0 ) , material ( 0 ) , flags ( 0 )
+		{
+		}
+
+		RenderHandle ( uint32_t mesh , uint32_t material , uint32_t flags = 0 )
+			: mesh ( mesh ) , material ( material ) , flags ( flags )
+		{
+		}
+	};
+
+	/*!
+	 *@class EntityRegistry.
+	 *@brief The objects of a scene as entity ids and packed component arrays.
+	 *@details An entity is only an id: its data lives in one SparseSet per
+	 * component type , the local Transform , the world Matrix4x4 , the
+	 * BoundingBox3 and the RenderHandle. Ids are generational , a destroyed
+	 * entity's handles stop matching anything , and its slot is reused.
+	 *
+	 * forEach ( ) runs a functor over every entity that has all the given
+	 * components , with the entity and a reference to each. It walks the
+	 * smallest set in packed order and looks the entity up in the others ,
+	 * in blocks split across threads , so the functor must only touch its
+	 * own entity's components. SparseSet::alignTo ( ) puts the other sets in
+	 * the same order , after which every set is read front to back.
+	 *
+	 * Nothing may be created , destroyed , added or removed while a pass
+	 * runs. destroyLater ( ) and the sets' insertLater ( ) and eraseLater ( )
+	 * record the change instead , and flush ( ) , the sync point between
+	 * passes , applies it: component changes first , in call order , then
+	 * the destructions. Changes recorded for an entity that is no longer
+	 * alive by then are dropped.
+	 *
+	 * \code
+	 * struct Cull
+	 * {
+	 *     void operator( ) ( Celer::Entity e , Celer::BoundingBox3<float>& box , Celer::RenderHandle& handle ) const { ... }
+	 * };
+	 *
+	 * Celer::EntityRegistry<float> scene;
+	 * Celer::Entity e = scene.create ( );
+	 * scene.bounds ( ).insert ( e , box );
+	 * scene.renderables ( ).insert ( e , Celer::RenderHandle ( mesh , material ) );
+	 * scene.forEach ( scene.bounds ( ) , scene.renderables ( ) , Cull ( ) );
+	 * scene.flush ( );
+	 * \endcode
+	 */
+	template < class Real >
+	class EntityRegistry
+	{
+		public:
+
+			typedef SparseSet< Transform<Real> > 	Transforms;
+			typedef SparseSet< Matrix4x4<Real> > 	Matrices;
+			typedef SparseSet< BoundingBox3<Real> > Bounds;
+			typedef SparseSet< RenderHandle > 	Renderables;
+
+			EntityRegistry ( );
+
+			Entity 			create 			( );
+
+			/// Removes all components of entity. False if it was not alive.
+			bool 			destroy 		( const Entity& entity );
+
+			/// Thread safe , applied by flush ( ).
+			void 			destroyLater 		( const Entity& entity );
+
+			bool 			alive 			( const Entity& entity ) const
+			{
+				return entity.index < generations_.size ( ) && generations_[entity.index] == entity.generation;
+			}
+
+			/// Entities alive.
+			std::size_t 		size 			( ) const
+			{
+				return alive_;
+			}
+
+			/// The sync point: applies the deferred component changes , then the destructions.
+			void 			flush 			( );
+
+			void 			clear 			( );
+
+			Transforms& 		transforms 		( )
+			{
+				return transforms_;
+			}
+
+			Matrices& 		worlds 			( )
+			{
+				return worlds_;
+			}
+
+			Bounds& 		bounds 			( )
+			{
+				return bounds_;
+			}
+
+			Renderables& 		renderables 		( )
+			{
+				return renderables_;
+			}
+
+			/// f ( entity , a ) for every component of a.
+			template < class A , class F >
+			static void 		forEach 		( SparseSet<A>& a , F f );
+
+			/// f ( entity , a , b ) for every entity in both.
+			template < class A , class B , class F >
+			static void 		forEach 		( SparseSet<A>& a , SparseSet<B>& b , F f );
+
+			/// f ( entity , a , b , c ) for every entity in all three.
+			template < class A , class B , class C , class F >
+			static void 		forEach 		( SparseSet<A>& a , SparseSet<B>& b , SparseSet<C>& c , F f );
+
+		private:
+
+			enum
+			{
+				kBlock = 4096 	///< Entities per thread task.
+			};
+
+			static long 		blockCount 		( std::size_t count )
+			{
+				return static_cast<long> ( ( count + kBlock - 1 ) / kBlock );
+			}
+
+			std::vector<uint32_t> 		generations_;
+			std::vector<uint32_t> 		free_;
+			std::vector<Entity> 		doomed_;
+			std::size_t 			alive_;
+
+			Transforms 			transforms_;
+			Matrices 			worlds_;
+			Bounds 				bounds_;
+			Renderables 			renderables_;
+	};
+
+	template < class Real >
+	EntityRegistry<Real>::EntityRegistry ( )
+		: alive_ ( 0 )
+	{
+	}
+
+	template < class Real >
+	Entity EntityRegistry<Real>::create ( )
+	{
+		++alive_;
+
+		if ( !free_.empty ( ) )
+		{
+			uint32_t index = free_.back ( );
+			free_.pop_back ( );
+			return Entity ( index , generations_[index] );
+		}
+
+		generations_.push_back ( 0 );
+		return Entity ( static_cast<uint32_t> ( generations_.size ( ) - 1 ) , 0 );
+	}
+
+	template < class Real >
+	bool EntityRegistry<Real>::destroy ( const Entity& entity )
+	{
+		if ( !alive ( entity ) )
+		{
+			return false;
+		}
+
+		transforms_.erase ( entity );
+		worlds_.erase ( entity );
+		bounds_.erase ( entity );
+		renderables_.erase ( entity );
+
+		++generations_[entity.index];
+		free_.push_back ( entity.index );
+		--alive_;
+
+		return true;
+	}
+
+	template < class Real >
+	void EntityRegistry<Real>::destroyLater ( const Entity& entity )
+	{
+		#pragma omp critical(CelerEntityRegistry)
+		doomed_.push_back ( entity );
+	}
+
+	template < class Real >
+	void EntityRegistry<Real>::flush ( )
+	{
+		// A command for an entity destroyed since it was recorded would land
+		// on whatever entity reused the slot.
+		transforms_.flush ( *this );
+		worlds_.flush ( *this );
+		bounds_.flush ( *this );
+		renderables_.flush ( *this );
+
+		for ( std::size_t i = 0; i < doomed_.size ( ); ++i )
+		{
+			destroy ( doomed_[i] );
+		}
+		doomed_.clear ( );
+	}
+
+	template < class Real >
+	void EntityRegistry<Real>::clear ( )
+	{
+		generations_.clear ( );
+		free_.clear ( );
+		doomed_.clear ( );
+		alive_ = 0;
+
+		transforms_.clear ( );
+		worlds_.clear ( );
+		bounds_.clear ( );
+		renderables_.clear ( );
+	}
+
+	template < class Real >
+	template < class A , class F >
+	void EntityRegistry<Real>::forEach ( SparseSet<A>& a , F f )
+	{
+		const Entity* entities = a.entities ( );
+		std::size_t count = a.size ( );
+		long blocks = blockCount ( count );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long block = 0; block < blocks; ++block )
+		{
+			std::size_t first = static_cast<std::size_t> ( block ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+
+			for ( std::size_t p = first; p < last; ++p )
+			{
+				f ( entities[p] , a[p] );
+			}
+		}
+	}
+
+	template < class Real >
+	template < class A , class B , class F >
+	void EntityRegistry<Real>::forEach ( SparseSet<A>& a , SparseSet<B>& b , F f )
+	{
+		// The smaller set leads , the other is looked up.
+		const Entity* entities = ( a.size ( ) <= b.size ( ) ) ? a.entities ( ) : b.entities ( );
+		std::size_t count = std::min ( a.size ( ) , b.size ( ) );
+		long blocks = blockCount ( count );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long block = 0; block < blocks; ++block )
+		{
+			std::size_t first = static_cast<std::size_t> ( block ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+
+			for ( std::size_t i = first; i < last; ++i )
+			{
+				Entity entity = entities[i];
+				uint32_t pa = a.position ( entity );
+				uint32_t pb = b.position ( entity );
+				if ( pa != SparseSet<A>::kNone && pb != SparseSet<B>::kNone )
+				{
+					f ( entity , a[pa] , b[pb] );
+				}
+			}
+		}
+	}
+
+	template < class Real >
+	template < class A , class B , class C , class F >
+	void EntityRegistry<Real>::forEach ( SparseSet<A>& a , SparseSet<B>& b , SparseSet<C>& c , F f )
+	{
+		const Entity* entities = a.entities ( );
+		std::size_t count = a.size ( );
+		if ( b.size ( ) < count )
+		{
+			entities = b.entities ( );
+			count = b.size ( );
+		}
+		if ( c.size ( ) < count )
+		{
+			entities = c.entities ( );
+			count = c.size ( );
+		}
+		long blocks = blockCount ( count );
+
+		#pragma omp parallel for schedule(static) if(blocks > 1)
+		for ( long block = 0; block < blocks; ++block )
+		{
+			std::size_t first = static_cast<std::size_t> ( block ) * kBlock;
+			std::size_t last = std::min<std::size_t> ( first + kBlock , count );
+
+			for ( std::size_t i = first; i < last; ++i )
+			{
+				Entity entity = entities[i];
+				uint32_t pa = a.position ( entity );
+				uint32_t pb = b.position ( entity );
+				uint32_t pc = c.position ( entity );
+				if ( pa != SparseSet<A>::kNone && pb != SparseSet<B>::kNone && pc != SparseSet<C>::kNone )
+				{
+					f ( entity , a[pa] , b[pb] , c[pc] );
+				}
+			}
+		}
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_ENTITYREGISTRY_HPP_ */
@@ -0,0 +1,7 @@
+/*
+ * SparseSet.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Scene/SparseSet.hpp>
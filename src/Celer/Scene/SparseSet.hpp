@@ -0,0 +1,367 @@
+#ifndef CELER_SPARSESET_HPP_
+#define CELER_SPARSESET_HPP_
+
+//- Celer/Scene/SparseSet.hpp - Packed component storage -------------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Scene Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the Entity handle and the SparseSet class , one
+//        component type of many entities kept in a packed array.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace Celer
+{
+	/*!
+	 *@brief A handle to an entity: a slot index and the generation of the slot.
+	 *@details A destroyed entity's slot is reused with the next generation ,
+	 * so an old handle never finds the new entity's components.
+	 */
+	struct Entity
+	{
+		uint32_t index;
+		uint32_t generation;
+
+		Entity ( )
+			: index ( 0xFFFFFFFFu ) , generation ( 0 )
+		{
+		}
+
+		Entity ( uint32_t index , uint32_t generation )
+			: index ( index ) , generation ( generation )
+		{
+		}
+
+		bool operator== ( const Entity& other ) const
+		{
+			return index == other.index && generation == other.generation;
+		}
+
+		bool operator!= ( const Entity& other ) const
+		{
+			return !( *this == other );
+		}
+	};
+
+	/*!
+	 *@class SparseSet.
+	 *@brief The components of one type , packed , with constant time lookup by entity.
+	 *@details The components sit in one array with no holes , beside the
+	 * array of their entities , so a pass over them reads memory in order.
+	 * A sparse array indexed by entity slot gives the position of each.
+	 * erase ( ) moves the last component into the hole , which changes the
+	 * order but keeps the array packed.
+	 *
+	 * insert ( ) and erase ( ) may move components , so they must not run
+	 * while another thread iterates. insertLater ( ) and eraseLater ( ) can
+	 * be called from anywhere , a parallel pass included , and are applied
+	 * in call order by flush ( ).
+	 *
+	 * alignTo ( ) orders the components as another set orders its own , the
+	 * shared entities first , so a pass that reads both walks them side by
+	 * side.
+	 *
+	 * \code
+	 * Celer::SparseSet<Celer::BoundingBox3<float> > bounds;
+	 * bounds.insert ( entity , box );
+	 * if ( Celer::BoundingBox3<float>* b = bounds.find ( entity ) ) { ... }
+	 * \endcode
+	 */
+	template < class T >
+	class SparseSet
+	{
+		public:
+
+			typedef T Component;
+
+			SparseSet ( )
+			{
+			}
+
+			std::size_t 		size 			( ) const
+			{
+				return components_.size ( );
+			}
+
+			bool 			empty 			( ) const
+			{
+				return components_.empty ( );
+			}
+
+			bool 			contains 		( const Entity& entity ) const
+			{
+				return position ( entity ) != kNone;
+			}
+
+			/// The component of entity , or 0.
+			T* 			find 			( const Entity& entity )
+			{
+				uint32_t p = position ( entity );
+				return ( p == kNone ) ? 0 : &components_[p];
+			}
+
+			const T* 		find 			( const Entity& entity ) const
+			{
+				uint32_t p = position ( entity );
+				return ( p == kNone ) ? 0 : &components_[p];
+			}
+
+			/// The packed position of entity , or kNone.
+			uint32_t 		position 		( const Entity& entity ) const
+			{
+				if ( entity.index >= sparse_.size ( ) )
+				{
+					return kNone;
+				}
+				uint32_t p = sparse_[entity.index];
+				return ( p != kNone && entities_[p] == entity ) ? p : kNone;
+			}
+
+			/// Adds or replaces the component of entity. A component left in the
+			/// slot by an older generation , a dead entity , is replaced too. 0 if
+			/// the slot holds a newer generation , a stale handle must not take it over.
+			T* 			insert 			( const Entity& entity , const T& component );
+
+			/// False if entity had no component.
+			bool 			erase 			( const Entity& entity );
+
+			/// Thread safe , applied by flush ( ).
+			void 			insertLater 		( const Entity& entity , const T& component );
+			void 			eraseLater 		( const Entity& entity );
+
+			/// Applies the deferred inserts and erases , in call order.
+			void 			flush 			( );
+
+			/// As flush ( ) , but drops the commands of the entities for which
+			/// registry.alive ( entity ) is false.
+			template < class Registry >
+			void 			flush 			( const Registry& registry );
+
+			/// The packed arrays , size ( ) long.
+			T* 			data 			( )
+			{
+				return components_.empty ( ) ? 0 : &components_[0];
+			}
+
+			const T* 		data 			( ) const
+			{
+				return components_.empty ( ) ? 0 : &components_[0];
+			}
+
+			const Entity* 		entities 		( ) const
+			{
+				return entities_.empty ( ) ? 0 : &entities_[0];
+			}
+
+			T& 			operator[] 		( std::size_t position )
+			{
+				return components_[position];
+			}
+
+			const T& 		operator[] 		( std::size_t position ) const
+			{
+				return components_[position];
+			}
+
+			/// Moves the entities of other to the front , in the order of other.
+			template < class U >
+			void 			alignTo 		( const SparseSet<U>& other );
+
+			void 			reserve 		( std::size_t count );
+			void 			clear 			( );
+
+			enum { kNone = 0xFFFFFFFFu };
+
+		private:
+
+			struct Command
+			{
+				Entity 	entity;
+				T 	component;
+				bool 	erase;
+			};
+
+			void 			swap 			( uint32_t a , uint32_t b );
+
+			std::vector<T> 			components_;
+			std::vector<Entity> 		entities_;
+			std::vector<uint32_t> 		sparse_;
+			std::vector<Command> 		commands_;
+	};
+
+	template < class T >
+	T* SparseSet<T>::insert ( const Entity& entity , const T& component )
+	{
+		if ( entity.index >= sparse_.size ( ) )
+		{
+			sparse_.resize ( std::max<std::size_t> ( entity.index + 1 , sparse_.size ( ) * 2 ) , static_cast<uint32_t> ( kNone ) );
+		}
+
+		uint32_t p = sparse_[entity.index];
+		if ( p != kNone )
+		{
+			if ( entities_[p].generation > entity.generation )
+			{
+				return 0;
+			}
+			entities_[p] = entity;
+			components_[p] = component;
+			return &components_[p];
+		}
+
+		sparse_[entity.index] = static_cast<uint32_t> ( components_.size ( ) );
+		entities_.push_back ( entity );
+		components_.push_back ( component );
+
+		return &components_.back ( );
+	}
+
+	template < class T >
+	bool SparseSet<T>::erase ( const Entity& entity )
+	{
+		uint32_t p = position ( entity );
+		if ( p == kNone )
+		{
+			return false;
+		}
+
+		uint32_t last = static_cast<uint32_t> ( components_.size ( ) - 1 );
+		if ( p != last )
+		{
+			components_[p] = components_[last];
+			entities_[p] = entities_[last];
+			sparse_[entities_[p].index] = p;
+		}
+		components_.pop_back ( );
+		entities_.pop_back ( );
+		sparse_[entity.index] = kNone;
+
+		return true;
+	}
+
+	template < class T >
+	void SparseSet<T>::insertLater ( const Entity& entity , const T& component )
+	{
+		Command command;
+		command.entity = entity;
+		command.component = component;
+		command.erase = false;
+
+		#pragma omp critical(CelerSparseSet)
+		commands_.push_back ( command );
+	}
+
+	template < class T >
+	void SparseSet<T>::eraseLater ( const Entity& entity )
+	{
+		Command command;
+		command.entity = entity;
+		command.erase = true;
+
+		#pragma omp critical(CelerSparseSet)
+		commands_.push_back ( command );
+	}
+
+	template < class T >
+	void SparseSet<T>::flush ( )
+	{
+		for ( std::size_t i = 0; i < commands_.size ( ); ++i )
+		{
+			if ( commands_[i].erase )
+			{
+				erase ( commands_[i].entity );
+			}
+			else
+			{
+				insert ( commands_[i].entity , commands_[i].component );
+			}
+		}
+		commands_.clear ( );
+	}
+
+	template < class T >
+	template < class Registry >
+	void SparseSet<T>::flush ( const Registry& registry )
+	{
+		for ( std::size_t i = 0; i < commands_.size ( ); ++i )
+		{
+			if ( !registry.alive ( commands_[i].entity ) )
+			{
+				continue;
+			}
+
+			if ( commands_[i].erase )
+			{
+				erase ( commands_[i].entity );
+			}
+			else
+			{
+				insert ( commands_[i].entity , commands_[i].component );
+			}
+		}
+		commands_.clear ( );
+	}
+
+	template < class T >
+	void SparseSet<T>::swap ( uint32_t a , uint32_t b )
+	{
+		std::swap ( components_[a] , components_[b] );
+		std::swap ( entities_[a] , entities_[b] );
+		sparse_[entities_[a].index] = a;
+		sparse_[entities_[b].index] = b;
+	}
+
+	template < class T >
+	template < class U >
+	void SparseSet<T>::alignTo ( const SparseSet<U>& other )
+	{
+		uint32_t next = 0;
+		const Entity* order = other.entities ( );
+
+		for ( std::size_t i = 0; i < other.size ( ); ++i )
+		{
+			uint32_t p = position ( order[i] );
+			if ( p != kNone )
+			{
+				if ( p != next )
+				{
+					swap ( p , next );
+				}
+				++next;
+			}
+		}
+	}
+
+	template < class T >
+	void SparseSet<T>::reserve ( std::size_t count )
+	{
+		components_.reserve ( count );
+		entities_.reserve ( count );
+	}
+
+	template < class T >
+	void SparseSet<T>::clear ( )
+	{
+		components_.clear ( );
+		entities_.clear ( );
+		sparse_.clear ( );
+		commands_.clear ( );
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_SPARSESET_HPP_ */
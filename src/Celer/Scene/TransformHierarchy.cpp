@@ -0,0 +1,7 @@
+/*
+ * TransformHierarchy.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <Celer/Scene/TransformHierarchy.hpp>
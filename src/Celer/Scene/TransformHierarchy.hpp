@@ -0,0 +1,488 @@
+#ifndef CELER_TRANSFORMHIERARCHY_HPP_
+#define CELER_TRANSFORMHIERARCHY_HPP_
+
+//- Celer/Scene/TransformHierarchy.hpp - Local to world propagation ---------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Scene Module
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the declaration of the TransformHierarchy class
+//        , a scene graph of transforms kept as flat arrays in breadth first
+//        order and updated level by level.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/Matrix4x4.hpp>
+#include <Celer/Core/Geometry/Math/SIMD.hpp>
+#include <Celer/Core/Geometry/Math/Transform.hpp>
+
+namespace Celer
+{
+	/*!
+	 *@class TransformHierarchy.
+	 *@brief Parent relative transforms and their world matrices , with no pointers.
+	 *@details A node is an int id , given by add ( ) and kept for good. The
+	 * nodes live in slots sorted breadth first: all roots , then all their
+	 * children , and so on , the children of a node next to each other. Each
+	 * slot has its parent slot , local matrix , world matrix and a dirty flag
+	 * in arrays of their own , and levels ( ) tells where each depth starts.
+	 *
+	 * update ( ) walks the levels in order. A node is recomputed , world =
+	 * parent world * local , when its local matrix changed or its parent was
+	 * recomputed in this update. Every parent is in the level before , done
+	 * already , so the slots of one level are independent and are split in
+	 * blocks across threads. For float the product runs on SIMD::Float4 rows.
+	 *
+	 * Only levels holding a changed node , or right below one , are read at
+	 * all , and a frame with no change returns at once , so static parts of
+	 * the scene cost nothing. add ( ) and setParent ( ) only record the change
+	 * , the next update ( ) sorts the slots again and recomputes every node.
+	 *
+	 * Matrices are Matrix4x4 , translation in the w column , points
+	 * multiplied on the right.
+	 *
+	 * \code
+	 * Celer::TransformHierarchy<float> scene;
+	 * int body = scene.add ( Celer::TransformHierarchy<float>::kNone , bodyMatrix );
+	 * int wheel = scene.add ( body , wheelMatrix );
+	 * scene.setLocal ( body , moved );
+	 * scene.update ( );
+	 * draw ( scene.world ( wheel ) );
+	 * \endcode
+	 */
+	template < class Real >
+	class TransformHierarchy
+	{
+		public:
+
+			typedef Celer::Matrix4x4<Real> Matrix;
+
+			/// The parent of a root.
+			enum { kNone = -1 };
+
+			TransformHierarchy ( );
+
+			/// A new node under parent , kNone for a root. Its id.
+			int 			add 			( int parent , const Matrix& local = Matrix ( ) );
+			int 			add 			( int parent , const Transform<Real>& local );
+
+			/// Moves node and its subtree under parent. False , and nothing done , for a cycle.
+			bool 			setParent 		( int node , int parent );
+
+			void 			setLocal 		( int node , const Matrix& local );
+			void 			setLocal 		( int node , const Transform<Real>& local );
+
+			int 			parent 			( int node ) const
+			{
+				return parentOf_[node];
+			}
+
+			const Matrix& 		local 			( int node ) const
+			{
+				return local_[slotOf_[node]];
+			}
+
+			/// As of the last update ( ).
+			const Matrix& 		world 			( int node ) const
+			{
+				return world_[slotOf_[node]];
+			}
+
+			std::size_t 		size 			( ) const
+			{
+				return parentOf_.size ( );
+			}
+
+			/// Recomputes the world matrices of the changed nodes and their subtrees. How many.
+			std::size_t 		update 			( );
+
+			/// World matrices in slot order , valid after update ( ).
+			const Matrix* 		worlds 			( ) const
+			{
+				return world_.empty ( ) ? 0 : &world_[0];
+			}
+
+			/// The node in a slot , and the slot of a node.
+			int 			node 			( std::size_t slot ) const
+			{
+				return node_[slot];
+			}
+
+			std::size_t 		slot 			( int node ) const
+			{
+				return slotOf_[node];
+			}
+
+			/// levels ( ) [d] .. levels ( ) [d + 1] are the slots of depth d.
+			const std::vector<std::size_t>& levels 	( ) const
+			{
+				return levels_;
+			}
+
+			void 			reserve 		( std::size_t count );
+			void 			clear 			( );
+
+		private:
+
+			enum
+			{
+				kBlock = 4096 	///< Slots per thread task.
+			};
+
+			/// out = a * b.
+			static void 		multiply 		( const Matrix& a , const Matrix& b , Matrix& out );
+
+			/// The level of a slot , after the slots are sorted.
+			std::size_t 		levelOf 		( std::size_t slot ) const;
+
+			void 			markDirty 		( std::size_t slot );
+
+			/// Sorts the slots breadth first and marks them all dirty.
+			void 			sort 			( );
+
+			/// Slots first .. last of one level , returns the count recomputed.
+			std::size_t 		updateRange 		( std::size_t first , std::size_t last );
+
+			// By node id.
+			std::vector<int> 		parentOf_;
+			std::vector<std::size_t> 	slotOf_;
+
+			// By slot.
+			std::vector<int> 		parent_;
+			std::vector<int> 		node_;
+			std::vector<Matrix> 		local_;
+			std::vector<Matrix> 		world_;
+			std::vector<unsigned char> 	dirty_;
+
+			// By level.
+			std::vector<std::size_t> 	levels_;
+			std::vector<unsigned char> 	levelDirty_;
+
+			bool 				sorted_;
+			bool 				changed_;
+	};
+
+	template < class Real >
+	TransformHierarchy<Real>::TransformHierarchy ( )
+		: sorted_ ( true ) , changed_ ( false )
+	{
+		levels_.push_back ( 0 );
+	}
+
+	template < class Real >
+	inline void TransformHierarchy<Real>::multiply ( const Matrix& a , const Matrix& b , Matrix& out )
+	{
+		out = a * b;
+	}
+
+	/// Row i of a * b is the rows of b weighted by row i of a.
+	template < >
+	inline void TransformHierarchy<float>::multiply ( const Matrix& a , const Matrix& b , Matrix& out )
+	{
+		const float* p = a;
+		const float* q = b;
+		float* r = out;
+
+		SIMD::Float4 b0 = SIMD::Float4::load ( q );
+		SIMD::Float4 b1 = SIMD::Float4::load ( q + 4 );
+		SIMD::Float4 b2 = SIMD::Float4::load ( q + 8 );
+		SIMD::Float4 b3 = SIMD::Float4::load ( q + 12 );
+
+		for ( int i = 0; i < 16; i += 4 )
+		{
+			( SIMD::Float4 ( p[i] ) * b0 + SIMD::Float4 ( p[i + 1] ) * b1 + SIMD::Float4 ( p[i + 2] ) * b2 + SIMD::Float4 ( p[i + 3] ) * b3 ).store ( r + i );
+		}
+	}
+
+	template < class Real >
+	int TransformHierarchy<Real>::add ( int parent , const Matrix& local )
+	{
+		int id = static_cast<int> ( parentOf_.size ( ) );
+
+		parentOf_.push_back ( parent );
+		slotOf_.push_back ( local_.size ( ) );
+
+		parent_.push_back ( ( parent == kNone ) ? -1 : static_cast<int> ( slotOf_[parent] ) );
+		node_.push_back ( id );
+		local_.push_back ( local );
+		world_.push_back ( local );
+		dirty_.push_back ( 1 );
+
+		// A root appended to a hierarchy of roots keeps the slots sorted.
+		sorted_ = sorted_ && parent == kNone && levels_.size ( ) <= 2;
+		if ( sorted_ )
+		{
+			levels_.resize ( 2 );
+			levels_[1] = local_.size ( );
+			levelDirty_.assign ( 1 , 1 );
+		}
+		changed_ = true;
+
+		return id;
+	}
+
+	template < class Real >
+	int TransformHierarchy<Real>::add ( int parent , const Transform<Real>& local )
+	{
+		return add ( parent , local.toMatrix ( ) );
+	}
+
+	template < class Real >
+	bool TransformHierarchy<Real>::setParent ( int node , int parent )
+	{
+		for ( int up = parent; up != kNone; up = parentOf_[up] )
+		{
+			if ( up == node )
+			{
+				return false;
+			}
+		}
+
+		parentOf_[node] = parent;
+		dirty_[slotOf_[node]] = 1;
+		sorted_ = false;
+		changed_ = true;
+
+		return true;
+	}
+
+	template < class Real >
+	void TransformHierarchy<Real>::setLocal ( int node , const Matrix& local )
+	{
+		std::size_t slot = slotOf_[node];
+		local_[slot] = local;
+		markDirty ( slot );
+	}
+
+	template < class Real >
+	void TransformHierarchy<Real>::setLocal ( int node , const Transform<Real>& local )
+	{
+		setLocal ( node , local.toMatrix ( ) );
+	}
+
+	template < class Real >
+	std::size_t TransformHierarchy<Real>::levelOf ( std::size_t slot ) const
+	{
+		return static_cast<std::size_t> ( std::upper_bound ( levels_.begin ( ) , levels_.end ( ) , slot ) - levels_.begin ( ) ) - 1;
+	}
+
+	template < class Real >
+	void TransformHierarchy<Real>::markDirty ( std::size_t slot )
+	{
+		dirty_[slot] = 1;
+		if ( sorted_ )
+		{
+			levelDirty_[levelOf ( slot )] = 1;
+		}
+		changed_ = true;
+	}
+
+	template < class Real >
+	void TransformHierarchy<Real>::sort ( )
+	{
+		std::size_t count = parentOf_.size ( );
+
+		// The children of each node , in id order , as offsets into one array.
+		std::vector<std::size_t> firstChild ( count + 1 , 0 );
+		for ( std::size_t id = 0; id < count; ++id )
+		{
+			if ( parentOf_[id] != kNone )
+			{
+				++firstChild[parentOf_[id] + 1];
+			}
+		}
+		for ( std::size_t id = 0; id < count; ++id )
+		{
+			firstChild[id + 1] += firstChild[id];
+		}
+
+		std::vector<int> children ( firstChild[count] );
+		std::vector<std::size_t> fill ( firstChild.begin ( ) , firstChild.end ( ) - 1 );
+		for ( std::size_t id = 0; id < count; ++id )
+		{
+			if ( parentOf_[id] != kNone )
+			{
+				children[fill[parentOf_[id]]++] = static_cast<int> ( id );
+			}
+		}
+
+		// Breadth first from the roots: the new node order is the queue itself.
+		std::vector<int> order;
+		order.reserve ( count );
+		for ( std::size_t id = 0; id < count; ++id )
+		{
+			if ( parentOf_[id] == kNone )
+			{
+				order.push_back ( static_cast<int> ( id ) );
+			}
+		}
+
+		levels_.assign ( 1 , 0 );
+		for ( std::size_t head = 0; head < order.size ( ); )
+		{
+			std::size_t end = order.size ( );
+			levels_.push_back ( end );
+			for ( ; head < end; ++head )
+			{
+				int id = order[head];
+				for ( std::size_t c = firstChild[id]; c < firstChild[id + 1]; ++c )
+				{
+					order.push_back ( children[c] );
+				}
+			}
+		}
+
+		std::vector<std::size_t> slotOf ( count );
+		for ( std::size_t slot = 0; slot < count; ++slot )
+		{
+			slotOf[order[slot]] = slot;
+		}
+
+		// Recomputing every world matrix costs less than moving them to their new slots.
+		std::vector<int> parent ( count );
+		std::vector<Matrix> local;
+		local.reserve ( count );
+		for ( std::size_t slot = 0; slot < count; ++slot )
+		{
+			int id = order[slot];
+			parent[slot] = ( parentOf_[id] == kNone ) ? -1 : static_cast<int> ( slotOf[parentOf_[id]] );
+			local.push_back ( local_[slotOf_[id]] );
+		}
+
+		parent_.swap ( parent );
+		local_.swap ( local );
+		node_.swap ( order );
+		slotOf_.swap ( slotOf );
+
+		dirty_.assign ( count , 1 );
+		levelDirty_.assign ( levels_.size ( ) - 1 , 1 );
+
+		sorted_ = true;
+	}
+
+	template < class Real >
+	std::size_t TransformHierarchy<Real>::updateRange ( std::size_t first , std::size_t last )
+	{
+		std::size_t computed = 0;
+
+		for ( std::size_t slot = first; slot < last; ++slot )
+		{
+			int parent = parent_[slot];
+			if ( parent < 0 )
+			{
+				if ( dirty_[slot] )
+				{
+					world_[slot] = local_[slot];
+					++computed;
+				}
+			}
+			else if ( dirty_[slot] | dirty_[parent] )
+			{
+				dirty_[slot] = 1;
+				multiply ( world_[parent] , local_[slot] , world_[slot] );
+				++computed;
+			}
+		}
+
+		return computed;
+	}
+
+	template < class Real >
+	std::size_t TransformHierarchy<Real>::update ( )
+	{
+		if ( !changed_ )
+		{
+			return 0;
+		}
+		if ( !sorted_ )
+		{
+			sort ( );
+		}
+
+		std::size_t levels = levels_.size ( ) - 1;
+		std::size_t total = 0;
+
+		for ( std::size_t level = 0; level < levels; ++level )
+		{
+			// Nothing in a level changed and nothing above it: no flag there is set.
+			if ( !levelDirty_[level] && ( level == 0 || !levelDirty_[level - 1] ) )
+			{
+				continue;
+			}
+
+			std::size_t begin = levels_[level];
+			std::size_t end = levels_[level + 1];
+			long blocks = static_cast<long> ( ( end - begin + kBlock - 1 ) / kBlock );
+			long computed = 0;
+
+			#pragma omp parallel for schedule(static) reduction(+:computed) if(blocks > 1)
+			for ( long b = 0; b < blocks; ++b )
+			{
+				std::size_t first = begin + static_cast<std::size_t> ( b ) * kBlock;
+				std::size_t last = std::min<std::size_t> ( first + kBlock , end );
+				computed += static_cast<long> ( updateRange ( first , last ) );
+			}
+
+			levelDirty_[level] = ( computed > 0 );
+			total += static_cast<std::size_t> ( computed );
+		}
+
+		// The flags are read by the level below , cleared once all are done.
+		for ( std::size_t level = 0; level < levels; ++level )
+		{
+			if ( levelDirty_[level] )
+			{
+				std::memset ( &dirty_[levels_[level]] , 0 , levels_[level + 1] - levels_[level] );
+				levelDirty_[level] = 0;
+			}
+		}
+
+		changed_ = false;
+
+		return total;
+	}
+
+	template < class Real >
+	void TransformHierarchy<Real>::reserve ( std::size_t count )
+	{
+		parentOf_.reserve ( count );
+		slotOf_.reserve ( count );
+		parent_.reserve ( count );
+		node_.reserve ( count );
+		local_.reserve ( count );
+		world_.reserve ( count );
+		dirty_.reserve ( count );
+	}
+
+	template < class Real >
+	void TransformHierarchy<Real>::clear ( )
+	{
+		parentOf_.clear ( );
+		slotOf_.clear ( );
+		parent_.clear ( );
+		node_.clear ( );
+		local_.clear ( );
+		world_.clear ( );
+		dirty_.clear ( );
+		levels_.assign ( 1 , 0 );
+		levelDirty_.clear ( );
+		sorted_ = true;
+		changed_ = false;
+	}
+
+}/* Celer :: NAMESPACE */
+
+#endif /* CELER_TRANSFORMHIERARCHY_HPP_ */
@@ -0,0 +1,191 @@
+//- Celer/Tools/EntityRegistryTest.cpp - EntityRegistry checks -------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerEntityRegistryTest program , which checks
+//        that stale entity handles never reach the components of a live
+//        entity , immediately or through the deferred commands.
+//
+//  Usage: CelerEntityRegistryTest
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstdio>
+/// Celer Library
+#include <Celer/Scene/EntityRegistry.hpp>
+
+namespace
+{
+	typedef Celer::EntityRegistry<float> Registry;
+
+	int failures = 0;
+
+	void check ( bool condition , const char* what )
+	{
+		if ( !condition )
+		{
+			std::printf ( "FAILED: %s\n" , what );
+			++failures;
+		}
+	}
+
+	struct Count
+	{
+		Registry* registry;
+		int* visits;
+		int* dead;
+
+		void operator( ) ( Celer::Entity entity , Celer::RenderHandle& ) const
+		{
+			#pragma omp atomic
+			++*visits;
+			if ( !registry->alive ( entity ) )
+			{
+				#pragma omp atomic
+				++*dead;
+			}
+		}
+	};
+
+	int visit ( Registry& registry , int* dead )
+	{
+		int visits = 0;
+		*dead = 0;
+		Count count = { &registry , &visits , dead };
+		Registry::forEach ( registry.renderables ( ) , count );
+		return visits;
+	}
+
+	void generations ( )
+	{
+		Registry registry;
+		Celer::Entity first = registry.create ( );
+		registry.bounds ( ).insert ( first , Celer::BoundingBox3<float> ( 0 , 0 , 0 , 1 , 1 , 1 ) );
+		check ( registry.destroy ( first ) , "destroy a live entity" );
+		check ( !registry.destroy ( first ) , "destroy a dead entity" );
+
+		Celer::Entity second = registry.create ( );
+		check ( second.index == first.index && second.generation == first.generation + 1 , "slot reused with the next generation" );
+		check ( !registry.bounds ( ).contains ( first ) && !registry.bounds ( ).contains ( second ) , "components die with the entity" );
+	}
+
+	void staleInsert ( )
+	{
+		Registry registry;
+		Celer::Entity first = registry.create ( );
+		registry.destroy ( first );
+		Celer::Entity second = registry.create ( );
+		registry.renderables ( ).insert ( second , Celer::RenderHandle ( 2 , 2 ) );
+
+		check ( registry.renderables ( ).insert ( first , Celer::RenderHandle ( 1 , 1 ) ) == 0 , "insert refuses a stale handle" );
+		check ( registry.renderables ( ).size ( ) == 1 , "stale insert adds nothing" );
+		check ( registry.renderables ( ).find ( second ) && registry.renderables ( ).find ( second )->mesh == 2 , "stale insert keeps the live component" );
+	}
+
+	void insertAfterDestroy ( )
+	{
+		// A dead handle takes the empty slot , the live entity must still get its component.
+		Registry registry;
+		Celer::Entity first = registry.create ( );
+		registry.destroy ( first );
+		registry.renderables ( ).insert ( first , Celer::RenderHandle ( 1 , 1 ) );
+		Celer::Entity second = registry.create ( );
+
+		check ( registry.renderables ( ).insert ( second , Celer::RenderHandle ( 2 , 2 ) ) != 0 , "insert replaces a dead entity's component" );
+		check ( registry.renderables ( ).size ( ) == 1 , "the dead component is gone" );
+		check ( registry.renderables ( ).find ( second ) && registry.renderables ( ).find ( second )->mesh == 2 , "the live entity has its component" );
+		check ( !registry.renderables ( ).contains ( first ) , "the dead handle finds nothing" );
+		check ( registry.renderables ( ).insert ( first , Celer::RenderHandle ( 1 , 1 ) ) == 0 , "the dead handle can't take the slot back" );
+	}
+
+	void staleDeferred ( )
+	{
+		// insertLater , destroy , create in the same slot , flush.
+		Registry registry;
+		Celer::Entity first = registry.create ( );
+		registry.renderables ( ).insertLater ( first , Celer::RenderHandle ( 1 , 1 ) );
+		registry.destroy ( first );
+		Celer::Entity second = registry.create ( );
+		registry.renderables ( ).insert ( second , Celer::RenderHandle ( 2 , 2 ) );
+		registry.flush ( );
+
+		int dead = 0;
+		check ( registry.renderables ( ).size ( ) == 1 , "deferred stale insert adds nothing" );
+		check ( registry.renderables ( ).find ( second ) && registry.renderables ( ).find ( second )->mesh == 2 , "deferred stale insert keeps the live component" );
+		check ( visit ( registry , &dead ) == 1 && dead == 0 , "forEach sees only live entities" );
+
+		// The same without the live component: the slot is free in the set.
+		Registry other;
+		first = other.create ( );
+		other.bounds ( ).insertLater ( first , Celer::BoundingBox3<float> ( ) );
+		other.renderables ( ).eraseLater ( first );
+		other.destroy ( first );
+		second = other.create ( );
+		other.flush ( );
+		check ( other.bounds ( ).size ( ) == 0 , "deferred insert for a dead entity is dropped" );
+	}
+
+	struct Doom
+	{
+		Registry* registry;
+
+		void operator( ) ( Celer::Entity entity , Celer::RenderHandle& ) const
+		{
+			if ( entity.index % 3 == 0 )
+			{
+				registry->destroyLater ( entity );
+			}
+			if ( entity.index % 3 == 1 )
+			{
+				registry->bounds ( ).eraseLater ( entity );
+			}
+		}
+	};
+
+	void deferred ( )
+	{
+		const int count = 100000;
+		Registry registry;
+		for ( int i = 0; i < count; ++i )
+		{
+			Celer::Entity entity = registry.create ( );
+			registry.bounds ( ).insert ( entity , Celer::BoundingBox3<float> ( ) );
+			registry.renderables ( ).insert ( entity , Celer::RenderHandle ( i , i ) );
+		}
+
+		Doom doom = { &registry };
+		Registry::forEach ( registry.renderables ( ) , doom );
+		check ( registry.size ( ) == static_cast<std::size_t> ( count ) , "nothing changes before flush" );
+		registry.flush ( );
+
+		bool right = true;
+		for ( int i = 0; i < count; ++i )
+		{
+			Celer::Entity entity ( i , 0 );
+			right = right && registry.alive ( entity ) == ( i % 3 != 0 ) && registry.bounds ( ).contains ( entity ) == ( i % 3 == 2 );
+		}
+		check ( right , "deferred destroys and erases from a parallel pass" );
+	}
+
+}
+
+int main ( )
+{
+	generations ( );
+	staleInsert ( );
+	insertAfterDestroy ( );
+	staleDeferred ( );
+	deferred ( );
+
+	std::printf ( "%s\n" , failures ? "FAILED" : "passed" );
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,148 @@
+//- Celer/Tools/IterativeClosestPointBenchmark.cpp - ICP iteration rates ---//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerIterativeClosestPointBenchmark program ,
+//        which registers two samplings of a curved surface , one moved by a
+//        known rigid motion , with the point-to-point and the point-to-plane
+//        metrics and reports the iterations per second and how far the
+//        motion found is from the true one.
+//
+//  Usage: CelerIterativeClosestPointBenchmark [points] [iterations]
+//
+//  The default is 1M points per set and 30 iterations , run to the end. The
+//  float runs take the SSE sums , the double runs the scalar ones.
+//  OMP_NUM_THREADS sets the threads.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/PointCloud/IterativeClosestPoint.hpp>
+
+namespace
+{
+	typedef Celer::Matrix3x3<double> Matrix3x3d;
+	typedef Celer::Vector3<double> Vector3d;
+
+	unsigned int state = 1;
+
+	double uniform ( )
+	{
+		state = state * 1664525u + 1013904223u;
+		return ( state >> 8 ) * ( 1.0 / 16777216.0 );
+	}
+
+	/// A jittered side x side sampling of z = 0.3 sin ( 3 x ) cos ( 2 y ) + 0.1 x^2 over [-1 , 1]^2.
+	void surface ( int side , std::vector<Vector3d>& points , std::vector<Vector3d>& normals )
+	{
+		points.clear ( );
+		normals.clear ( );
+
+		for ( int i = 0; i < side; ++i )
+		{
+			for ( int j = 0; j < side; ++j )
+			{
+				double x = -1.0 + 2.0 * ( i + uniform ( ) ) / side;
+				double y = -1.0 + 2.0 * ( j + uniform ( ) ) / side;
+				double dx = 0.9 * std::cos ( 3.0 * x ) * std::cos ( 2.0 * y ) + 0.2 * x;
+				double dy = -0.6 * std::sin ( 3.0 * x ) * std::sin ( 2.0 * y );
+
+				points.push_back ( Vector3d ( x , y , 0.3 * std::sin ( 3.0 * x ) * std::cos ( 2.0 * y ) + 0.1 * x * x ) );
+				normals.push_back ( Vector3d ( -dx , -dy , 1.0 ) / std::sqrt ( dx * dx + dy * dy + 1.0 ) );
+			}
+		}
+	}
+
+	template < class Real >
+	void run ( const char* type , const std::vector<Vector3d>& target , const std::vector<Vector3d>& normals ,
+	           const std::vector<Vector3d>& source , const Matrix3x3d& rotation , const Vector3d& translation , unsigned int iterations )
+	{
+		typedef Celer::IterativeClosestPoint<Real> ICP;
+		typedef Celer::Vector3<Real> Vector3;
+
+		std::vector<Vector3> points ( target.begin ( ) , target.end ( ) );
+		std::vector<Vector3> directions ( normals.begin ( ) , normals.end ( ) );
+		std::vector<Vector3> moving ( source.begin ( ) , source.end ( ) );
+
+		Celer::Timer timer;
+		ICP icp;
+		icp.setTarget ( points , directions );
+		double build = timer.elapsed ( );
+
+		icp.setMaxCorrespondenceDistance ( static_cast<Real> ( 0.1 ) );
+		icp.setMaxIterations ( iterations );
+		icp.setTransformTolerance ( 0 , 0 );
+		icp.setErrorTolerance ( -1 );
+
+		std::printf ( "%s , KdTree %.1f ms\n" , type , build * 1e3 );
+
+		const char* names[2] = { "point to point" , "point to plane" };
+		for ( int metric = ICP::POINT_TO_POINT; metric <= ICP::POINT_TO_PLANE; ++metric )
+		{
+			icp.setMetric ( static_cast<typename ICP::Metric> ( metric ) );
+
+			Celer::Matrix3x3<Real> r;
+			Vector3 t;
+			icp.align ( moving , r , t );
+
+			// Angle of the rotation left between the motion found and the true one.
+			Matrix3x3d found ( r[0][0] , r[0][1] , r[0][2] , r[1][0] , r[1][1] , r[1][2] , r[2][0] , r[2][1] , r[2][2] );
+			Matrix3x3d left = found * ( ~rotation );
+			double cosine = std::max ( -1.0 , std::min ( 1.0 , ( left[0][0] + left[1][1] + left[2][2] - 1.0 ) * 0.5 ) );
+			Vector3d offset = Vector3d ( t ) - translation;
+
+			std::printf ( "  %s: %u iterations , %7.1f ms , %6.2f it/s , rms %.2e , rotation error %.2e rad , translation error %.2e\n" ,
+			              names[metric] , icp.iterations ( ) , icp.elapsed ( ) * 1e3 , icp.iterationsPerSecond ( ) , static_cast<double> ( icp.rms ( ) ) ,
+			              std::acos ( cosine ) , offset.length ( ) );
+		}
+	}
+}
+
+int main ( int argc , char** argv )
+{
+	long count = ( argc > 1 ) ? std::atol ( argv[1] ) : 1000000;
+	unsigned int iterations = ( argc > 2 ) ? static_cast<unsigned int> ( std::atoi ( argv[2] ) ) : 30;
+	int side = static_cast<int> ( std::floor ( std::sqrt ( static_cast<double> ( count ) ) + 0.5 ) );
+
+	std::vector<Vector3d> target , normals , sampled , unused;
+	surface ( side , target , normals );
+	surface ( side , sampled , unused );
+
+	// The true motion maps the source onto the target: 3 degrees and 0.04 units.
+	Vector3d axis = Vector3d ( 1.0 , 2.0 , 3.0 ) / std::sqrt ( 14.0 );
+	double angle = 3.0 * 3.14159265358979323846 / 180.0;
+	double s = std::sin ( angle * 0.5 );
+	Matrix3x3d rotation = Celer::Quaternion<double> ( std::cos ( angle * 0.5 ) , axis.x * s , axis.y * s , axis.z * s ).to3x3Matrix ( );
+	Vector3d translation ( 0.02 , -0.01 , 0.03 );
+
+	// source = R^T ( q - t ) , a different sampling than the target.
+	std::vector<Vector3d> source ( sampled.size ( ) );
+	Matrix3x3d inverse = ~rotation;
+	for ( std::size_t i = 0; i < sampled.size ( ); ++i )
+	{
+		source[i] = inverse * ( sampled[i] - translation );
+	}
+
+	std::printf ( "%lu target and %lu source points , %u iterations\n" , static_cast<unsigned long> ( target.size ( ) ) ,
+	              static_cast<unsigned long> ( source.size ( ) ) , iterations );
+
+	run<float> ( "float" , target , normals , source , rotation , translation , iterations );
+	run<double> ( "double" , target , normals , source , rotation , translation , iterations );
+
+	return 0;
+}
@@ -0,0 +1,188 @@
+//- Celer/Tools/MeshConvert.cpp - Mesh to MeshFile converter ----------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerMeshConvert tool , which writes an OBJ
+//        or PLY mesh , optimized and with its levels of detail , as a
+//        MeshFile , and reports how long a MeshFile takes to load.
+//
+//  Usage: CelerMeshConvert [-optimize] [-normals] [-lods n] input.{obj,ply} output.cmsh
+//         CelerMeshConvert -info file.cmsh
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Mesh/Mesh.hpp>
+#include <Celer/Core/Geometry/Mesh/MeshFile.hpp>
+#include <Celer/Core/Geometry/Mesh/MeshImporter.hpp>
+#include <Celer/Core/Geometry/Mesh/Simplifier.hpp>
+
+namespace
+{
+	const char* kindName ( unsigned int kind )
+	{
+		static const char* names[] = { "?" , "positions" , "normals" , "tangents" , "texcoords" , "indices" , "bounds" , "transform" };
+		return names[kind < 8 ? kind : 0];
+	}
+
+	int info ( const char* path )
+	{
+		Celer::Timer timer;
+
+		Celer::MeshFile file;
+		if ( !file.open ( path ) )
+		{
+			std::fprintf ( stderr , "%s: not a MeshFile\n" , path );
+			return 1;
+		}
+
+		double opened = timer.lap ( );
+
+		std::printf ( "%s: %lu meshes , %lu sections , %lu bytes\n" , path , static_cast<unsigned long> ( file.meshCount ( ) ) ,
+		              static_cast<unsigned long> ( file.sectionCount ( ) ) , static_cast<unsigned long> ( file.mapping ( ).size ( ) ) );
+
+		for ( std::size_t i = 0; i < file.sectionCount ( ); ++i )
+		{
+			const Celer::MeshFile::Section& section = file.section ( i );
+			std::printf ( "  mesh %u %-9s lod %u : %10lu x %2u bytes at %10lu , error %g\n" , section.mesh , kindName ( section.kind ) , section.lod ,
+			              static_cast<unsigned long> ( section.count ) , section.stride , static_cast<unsigned long> ( section.offset ) , section.error );
+		}
+
+		// What a renderer drawing only level 0 pays: one read of its positions and indices.
+		timer.start ( );
+		unsigned int sum = 0;
+		for ( std::size_t mesh = 0; mesh < file.meshCount ( ); ++mesh )
+		{
+			const Celer::MeshFile::Kind kinds[2] = { Celer::MeshFile::POSITIONS , Celer::MeshFile::INDICES };
+			for ( int k = 0; k < 2; ++k )
+			{
+				const Celer::MeshFile::Section* section = file.find ( kinds[k] , mesh );
+				if ( section == 0 )
+				{
+					continue;
+				}
+
+				const unsigned char* bytes = static_cast<const unsigned char*> ( file.data ( *section ) );
+				for ( std::size_t b = 0; b < file.bytes ( *section ); b += 64 )
+				{
+					sum += bytes[b];
+				}
+			}
+		}
+		double touched = timer.lap ( );
+
+		Celer::Mesh<float> mesh;
+		bool copied = file.meshCount ( ) > 0 && file.read ( 0 , 0 , mesh );
+		double read = timer.lap ( );
+
+		std::printf ( "open %.3f ms , touch level 0 %.3f ms (%u) , read mesh 0 into a Mesh %.3f ms%s\n" , opened * 1e3 , touched * 1e3 , sum & 1u ,
+		              read * 1e3 , copied ? "" : " (failed)" );
+
+		return 0;
+	}
+}
+
+int main ( int argc , char** argv )
+{
+	if ( argc == 3 && std::strcmp ( argv[1] , "-info" ) == 0 )
+	{
+		return info ( argv[2] );
+	}
+
+	bool optimize = false;
+	bool normals = false;
+	std::size_t lods = 0;
+	std::vector<const char*> paths;
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if ( std::strcmp ( argv[i] , "-optimize" ) == 0 )
+		{
+			optimize = true;
+		}
+		else if ( std::strcmp ( argv[i] , "-normals" ) == 0 )
+		{
+			normals = true;
+		}
+		else if ( std::strcmp ( argv[i] , "-lods" ) == 0 && i + 1 < argc )
+		{
+			lods = static_cast<std::size_t> ( std::strtoul ( argv[++i] , 0 , 10 ) );
+		}
+		else
+		{
+			paths.push_back ( argv[i] );
+		}
+	}
+
+	if ( paths.size ( ) != 2 )
+	{
+		std::fprintf ( stderr , "usage: %s [-optimize] [-normals] [-lods n] input.{obj,ply} output.cmsh\n"
+		                        "       %s -info file.cmsh\n" , argv[0] , argv[0] );
+		return 1;
+	}
+
+	Celer::Timer timer;
+
+	Celer::Mesh<float> mesh;
+	if ( !Celer::MeshImporter<float>::read ( paths[0] , mesh ) || !mesh.valid ( ) )
+	{
+		std::fprintf ( stderr , "%s: can't read the mesh\n" , paths[0] );
+		return 1;
+	}
+
+	double parsed = timer.lap ( );
+
+	if ( optimize )
+	{
+		mesh.optimize ( );
+	}
+	if ( normals )
+	{
+		mesh.computeNormals ( );
+	}
+
+	Celer::MeshFile::Writer writer;
+	std::size_t id = writer.add ( mesh );
+
+	if ( lods > 0 && !mesh.indices ( ).empty ( ) )
+	{
+		std::vector<Celer::Simplifier<float>::Level> levels;
+		Celer::Simplifier<float>::chain ( &mesh.indices ( )[0] , mesh.indices ( ).size ( ) , &mesh.positions ( )[0] , mesh.positions ( ).size ( ) , levels );
+
+		for ( std::size_t i = 0; i < levels.size ( ) && i < lods; ++i )
+		{
+			writer.addLevel ( id , levels[i].indices , levels[i].error );
+		}
+	}
+
+	double processed = timer.lap ( );
+
+	if ( !writer.write ( paths[1] ) )
+	{
+		std::fprintf ( stderr , "%s: can't write\n" , paths[1] );
+		return 1;
+	}
+
+	double written = timer.lap ( );
+
+	std::printf ( "%lu vertices , %lu triangles: parse %.1f ms , process %.1f ms , write %.1f ms\n" ,
+	              static_cast<unsigned long> ( mesh.vertexCount ( ) ) , static_cast<unsigned long> ( mesh.triangleCount ( ) ) ,
+	              parsed * 1e3 , processed * 1e3 , written * 1e3 );
+
+	return 0;
+}
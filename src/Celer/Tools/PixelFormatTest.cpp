@@ -0,0 +1,392 @@
+//- Celer/Tools/PixelFormatTest.cpp - PixelFormat kernel checks ------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerPixelFormatTest program , which forces
+//        every kernel path the CPU runs and compares each array conversion ,
+//        bit for bit , against the scalar reference of its format.
+//
+//  Usage: CelerPixelFormatTest [-exhaustive]
+//
+//  By default the float inputs are every 251st bit pattern , the special
+//  values and both sides of every rounding boundary of the byte formats.
+//  -exhaustive runs all 2^32 patterns , which takes minutes.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/PixelFormat.hpp>
+
+namespace
+{
+	namespace PixelFormat = Celer::PixelFormat;
+
+	const std::size_t kChunk = 1 << 20;
+
+	int failures = 0;
+
+	void check ( std::size_t mismatches , const char* what )
+	{
+		if ( mismatches )
+		{
+			std::printf ( "FAILED: %s %s: %lu mismatches\n" , PixelFormat::name ( PixelFormat::path ( ) ) , what , static_cast<unsigned long> ( mismatches ) );
+			++failures;
+		}
+	}
+
+	float floatOf ( uint32_t bits )
+	{
+		float value;
+		std::memcpy ( &value , &bits , sizeof ( value ) );
+		return value;
+	}
+
+	uint32_t bitsOf ( float value )
+	{
+		uint32_t bits;
+		std::memcpy ( &bits , &value , sizeof ( bits ) );
+		return bits;
+	}
+
+	/// The specials and the floats on both sides of the first float that
+	/// rounds to each byte and word of the unorm and sRGB formats.
+	std::vector<float> boundaries ( )
+	{
+		std::vector<float> values;
+		const float specials[] = { 0.0f , -0.0f , 1.0f , -1.0f , 2.0f , 0.5f , 1e-30f , -1e-30f , 1e30f , 65504.0f , 65520.0f , 6.1e-5f , 5.96e-8f ,
+		                           std::numeric_limits<float>::infinity ( ) , -std::numeric_limits<float>::infinity ( ) ,
+		                           std::numeric_limits<float>::quiet_NaN ( ) , -std::numeric_limits<float>::quiet_NaN ( ) ,
+		                           std::numeric_limits<float>::denorm_min ( ) , std::numeric_limits<float>::min ( ) };
+		values.assign ( specials , specials + sizeof ( specials ) / sizeof ( specials[0] ) );
+
+		for ( int format = 0; format < 3; ++format )
+		{
+			int top = ( format == 1 ) ? 65535 : 255;
+			for ( int k = 1; k <= top; ++k )
+			{
+				// Bisection over the bits of [0 , 1] for the first float giving k.
+				uint32_t low = 0;
+				uint32_t high = bitsOf ( 1.0f );
+				while ( low < high )
+				{
+					uint32_t middle = low + ( high - low ) / 2;
+					float value = floatOf ( middle );
+					int q = ( format == 0 ) ? PixelFormat::toUnorm8 ( value ) : ( format == 1 ) ? PixelFormat::toUnorm16 ( value ) : PixelFormat::toSrgb8 ( value );
+					if ( q >= k )
+					{
+						high = middle;
+					}
+					else
+					{
+						low = middle + 1;
+					}
+				}
+				for ( uint32_t bits = low - 2; bits <= low + 2; ++bits )
+				{
+					values.push_back ( floatOf ( bits ) );
+				}
+			}
+		}
+
+		return values;
+	}
+
+	/// Every float to packed conversion of the current path on values.
+	void toPacked ( const std::vector<float>& values )
+	{
+		std::size_t count = values.size ( ) / 4 * 4;
+		std::size_t texels = count / 4;
+		const float* in = &values[0];
+
+		std::vector<uint16_t> words ( count );
+		std::vector<uint8_t> bytes ( count );
+		std::size_t bad;
+
+		PixelFormat::toHalf ( in , count , &words[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += words[i] != PixelFormat::toHalf ( in[i] );
+		}
+		check ( bad , "toHalf" );
+
+		PixelFormat::toUnorm16 ( in , count , &words[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += words[i] != PixelFormat::toUnorm16 ( in[i] );
+		}
+		check ( bad , "toUnorm16" );
+
+		PixelFormat::toUnorm8 ( in , count , &bytes[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += bytes[i] != PixelFormat::toUnorm8 ( in[i] );
+		}
+		check ( bad , "toUnorm8" );
+
+		PixelFormat::toSrgb8 ( in , count , &bytes[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += bytes[i] != PixelFormat::toSrgb8 ( in[i] );
+		}
+		check ( bad , "toSrgb8" );
+
+		PixelFormat::toSrgba8 ( in , texels , &bytes[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += bytes[i] != ( ( i % 4 == 3 ) ? PixelFormat::toUnorm8 ( in[i] ) : PixelFormat::toSrgb8 ( in[i] ) );
+		}
+		check ( bad , "toSrgba8" );
+
+		std::vector< Celer::Vector4<float> > vectors ( texels );
+		std::vector<Celer::Color> colors ( texels );
+		for ( std::size_t t = 0; t < texels; ++t )
+		{
+			vectors[t] = Celer::Vector4<float> ( in[4 * t] , in[4 * t + 1] , in[4 * t + 2] , in[4 * t + 3] );
+			colors[t] = Celer::Color ( in[4 * t] , in[4 * t + 1] , in[4 * t + 2] , in[4 * t + 3] );
+		}
+
+		PixelFormat::toHalf ( &vectors[0] , texels , &words[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += words[i] != PixelFormat::toHalf ( in[i] );
+		}
+		PixelFormat::toHalf ( &colors[0] , texels , &words[0] );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += words[i] != PixelFormat::toHalf ( in[i] );
+		}
+		check ( bad , "toHalf Vector4 / Color" );
+
+		PixelFormat::toUnorm8 ( &vectors[0] , texels , &bytes[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += bytes[i] != PixelFormat::toUnorm8 ( in[i] );
+		}
+		PixelFormat::toUnorm8 ( &colors[0] , texels , &bytes[0] );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += bytes[i] != PixelFormat::toUnorm8 ( in[i] );
+		}
+		check ( bad , "toUnorm8 Vector4 / Color" );
+
+		PixelFormat::toSrgba8 ( &vectors[0] , texels , &bytes[0] );
+		bad = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += bytes[i] != ( ( i % 4 == 3 ) ? PixelFormat::toUnorm8 ( in[i] ) : PixelFormat::toSrgb8 ( in[i] ) );
+		}
+		PixelFormat::toSrgba8 ( &colors[0] , texels , &bytes[0] );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			bad += bytes[i] != ( ( i % 4 == 3 ) ? PixelFormat::toUnorm8 ( in[i] ) : PixelFormat::toSrgb8 ( in[i] ) );
+		}
+		check ( bad , "toSrgba8 Vector4 / Color" );
+	}
+
+	std::size_t differ ( const std::vector<float>& values , const std::vector<float>& reference )
+	{
+		std::size_t bad = 0;
+		for ( std::size_t i = 0; i < values.size ( ); ++i )
+		{
+			bad += bitsOf ( values[i] ) != bitsOf ( reference[i] );
+		}
+		return bad;
+	}
+
+	/// Every packed to float conversion of the current path , on all inputs.
+	void fromPacked ( )
+	{
+		std::vector<uint16_t> words ( 65536 );
+		std::vector<uint8_t> bytes ( 256 * 4 );
+		for ( std::size_t i = 0; i < words.size ( ); ++i )
+		{
+			words[i] = static_cast<uint16_t> ( i );
+		}
+		for ( std::size_t i = 0; i < bytes.size ( ); ++i )
+		{
+			// Each byte in every channel.
+			bytes[i] = static_cast<uint8_t> ( i / 4 + 64 * ( i % 4 ) );
+		}
+
+		std::vector<float> values ( words.size ( ) );
+		std::vector<float> reference ( words.size ( ) );
+
+		PixelFormat::fromHalf ( &words[0] , words.size ( ) , &values[0] );
+		for ( std::size_t i = 0; i < words.size ( ); ++i )
+		{
+			reference[i] = PixelFormat::fromHalf ( words[i] );
+		}
+		check ( differ ( values , reference ) , "fromHalf" );
+
+		std::vector< Celer::Vector4<float> > vectors ( words.size ( ) / 4 );
+		std::vector<Celer::Color> colors ( words.size ( ) / 4 );
+		PixelFormat::fromHalf ( &words[0] , vectors.size ( ) , &vectors[0] );
+		PixelFormat::fromHalf ( &words[0] , colors.size ( ) , &colors[0] );
+		std::size_t bad = 0;
+		for ( std::size_t t = 0; t < vectors.size ( ); ++t )
+		{
+			const float* r = &reference[4 * t];
+			bad += bitsOf ( vectors[t].x ) != bitsOf ( r[0] ) || bitsOf ( vectors[t].y ) != bitsOf ( r[1] ) ||
+			       bitsOf ( vectors[t].z ) != bitsOf ( r[2] ) || bitsOf ( vectors[t].w ) != bitsOf ( r[3] );
+			bad += bitsOf ( colors[t].Red ( ) ) != bitsOf ( r[0] ) || bitsOf ( colors[t].Green ( ) ) != bitsOf ( r[1] ) ||
+			       bitsOf ( colors[t].Blue ( ) ) != bitsOf ( r[2] ) || bitsOf ( colors[t].Alfa ( ) ) != bitsOf ( r[3] );
+		}
+		check ( bad , "fromHalf Vector4 / Color" );
+
+		PixelFormat::fromUnorm16 ( &words[0] , words.size ( ) , &values[0] );
+		for ( std::size_t i = 0; i < words.size ( ); ++i )
+		{
+			reference[i] = PixelFormat::fromUnorm16 ( words[i] );
+		}
+		check ( differ ( values , reference ) , "fromUnorm16" );
+
+		values.resize ( bytes.size ( ) );
+		reference.resize ( bytes.size ( ) );
+
+		PixelFormat::fromUnorm8 ( &bytes[0] , bytes.size ( ) , &values[0] );
+		for ( std::size_t i = 0; i < bytes.size ( ); ++i )
+		{
+			reference[i] = PixelFormat::fromUnorm8 ( bytes[i] );
+		}
+		check ( differ ( values , reference ) , "fromUnorm8" );
+
+		vectors.resize ( bytes.size ( ) / 4 );
+		colors.resize ( bytes.size ( ) / 4 );
+		PixelFormat::fromUnorm8 ( &bytes[0] , vectors.size ( ) , &vectors[0] );
+		PixelFormat::fromUnorm8 ( &bytes[0] , colors.size ( ) , &colors[0] );
+		bad = 0;
+		for ( std::size_t t = 0; t < vectors.size ( ); ++t )
+		{
+			const float* r = &reference[4 * t];
+			bad += vectors[t].x != r[0] || vectors[t].y != r[1] || vectors[t].z != r[2] || vectors[t].w != r[3];
+			bad += colors[t].Red ( ) != r[0] || colors[t].Green ( ) != r[1] || colors[t].Blue ( ) != r[2] || colors[t].Alfa ( ) != r[3];
+		}
+		check ( bad , "fromUnorm8 Vector4 / Color" );
+
+		PixelFormat::fromSrgb8 ( &bytes[0] , bytes.size ( ) , &values[0] );
+		for ( std::size_t i = 0; i < bytes.size ( ); ++i )
+		{
+			reference[i] = PixelFormat::fromSrgb8 ( bytes[i] );
+		}
+		check ( differ ( values , reference ) , "fromSrgb8" );
+
+		PixelFormat::fromSrgba8 ( &bytes[0] , bytes.size ( ) / 4 , &values[0] );
+		for ( std::size_t i = 0; i < bytes.size ( ); ++i )
+		{
+			reference[i] = ( i % 4 == 3 ) ? PixelFormat::fromUnorm8 ( bytes[i] ) : PixelFormat::fromSrgb8 ( bytes[i] );
+		}
+		check ( differ ( values , reference ) , "fromSrgba8" );
+
+		PixelFormat::fromSrgba8 ( &bytes[0] , vectors.size ( ) , &vectors[0] );
+		PixelFormat::fromSrgba8 ( &bytes[0] , colors.size ( ) , &colors[0] );
+		bad = 0;
+		for ( std::size_t t = 0; t < vectors.size ( ); ++t )
+		{
+			const float* r = &reference[4 * t];
+			bad += vectors[t].x != r[0] || vectors[t].y != r[1] || vectors[t].z != r[2] || vectors[t].w != r[3];
+			bad += colors[t].Red ( ) != r[0] || colors[t].Green ( ) != r[1] || colors[t].Blue ( ) != r[2] || colors[t].Alfa ( ) != r[3];
+		}
+		check ( bad , "fromSrgba8 Vector4 / Color" );
+	}
+
+	/// The references against the definitions of the formats.
+	void references ( )
+	{
+		std::size_t bad = 0;
+		for ( uint32_t h = 0; h < 65536; ++h )
+		{
+			// Every half that is not NaN comes back with the same bits.
+			bool nan = ( h & 0x7C00u ) == 0x7C00u && ( h & 0x03FFu ) != 0;
+			uint16_t back = PixelFormat::toHalf ( PixelFormat::fromHalf ( static_cast<uint16_t> ( h ) ) );
+			bad += nan ? ( ( back & 0x7C00u ) != 0x7C00u || ( back & 0x03FFu ) == 0 ) : back != h;
+		}
+		check ( bad , "half round trip" );
+
+		bad = 0;
+		for ( int q = 0; q < 65536; ++q )
+		{
+			bad += PixelFormat::toUnorm16 ( PixelFormat::fromUnorm16 ( static_cast<uint16_t> ( q ) ) ) != q;
+			bad += PixelFormat::fromUnorm16 ( static_cast<uint16_t> ( q ) ) != static_cast<float> ( q / 65535.0 );
+		}
+		for ( int q = 0; q < 256; ++q )
+		{
+			bad += PixelFormat::toUnorm8 ( PixelFormat::fromUnorm8 ( static_cast<uint8_t> ( q ) ) ) != q;
+			bad += PixelFormat::fromUnorm8 ( static_cast<uint8_t> ( q ) ) != static_cast<float> ( q / 255.0 );
+			bad += PixelFormat::toSrgb8 ( PixelFormat::fromSrgb8 ( static_cast<uint8_t> ( q ) ) ) != q;
+		}
+		check ( bad , "unorm and sRGB round trips" );
+
+		// The IEC 61966-2-1 curve at the byte centres.
+		bad = 0;
+		for ( int q = 0; q < 256; ++q )
+		{
+			double c = q / 255.0;
+			double linear = ( c <= 0.04045 ) ? c / 12.92 : std::pow ( ( c + 0.055 ) / 1.055 , 2.4 );
+			bad += PixelFormat::fromSrgb8 ( static_cast<uint8_t> ( q ) ) != static_cast<float> ( linear );
+		}
+		check ( bad , "sRGB curve" );
+	}
+}
+
+int main ( int argc , char** argv )
+{
+	bool exhaustive = argc > 1 && std::strcmp ( argv[1] , "-exhaustive" ) == 0;
+	uint64_t stride = exhaustive ? 1 : 251;
+
+	references ( );
+
+	std::vector<float> edges = boundaries ( );
+	PixelFormat::Path best = PixelFormat::best ( );
+
+	for ( int p = PixelFormat::SCALAR; p <= PixelFormat::AVX2; ++p )
+	{
+		if ( p > best )
+		{
+			std::printf ( "%s: not run by this CPU or build , skipped\n" , PixelFormat::name ( static_cast<PixelFormat::Path> ( p ) ) );
+			continue;
+		}
+
+		PixelFormat::force ( static_cast<PixelFormat::Path> ( p ) );
+
+		toPacked ( edges );
+		fromPacked ( );
+
+		std::vector<float> values ( kChunk );
+		for ( uint64_t bits = 0; bits < ( uint64_t ( 1 ) << 32 ); )
+		{
+			std::size_t count = 0;
+			for ( ; count < kChunk && bits < ( uint64_t ( 1 ) << 32 ); ++count , bits += stride )
+			{
+				values[count] = floatOf ( static_cast<uint32_t> ( bits ) );
+			}
+			values.resize ( count );
+			toPacked ( values );
+		}
+
+		std::printf ( "%s: checked\n" , PixelFormat::name ( PixelFormat::path ( ) ) );
+	}
+
+	std::printf ( "%s\n" , failures ? "FAILED" : "passed" );
+	return failures ? 1 : 0;
+}
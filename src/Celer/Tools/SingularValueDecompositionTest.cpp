@@ -0,0 +1,228 @@
+//- Celer/Tools/SingularValueDecompositionTest.cpp - SVD accuracy checks ---//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerSingularValueDecompositionTest program ,
+//        which decomposes 100k random and a set of degenerate matrices in
+//        float and double , one at a time and in batches , and checks the
+//        residual , the orthogonality of U and V , the order of the singular
+//        values and the polar decomposition , reflections included.
+//
+//  Usage: CelerSingularValueDecompositionTest
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+/// Celer Library
+#include <Celer/Core/Geometry/Math/SingularValueDecomposition.hpp>
+
+namespace
+{
+	int failures = 0;
+
+	void check ( bool condition , const char* type , const char* what , double value , double bound )
+	{
+		std::printf ( "%-6s %-28s %.3g (bound %.3g)\n" , type , what , value , bound );
+		if ( !condition )
+		{
+			std::printf ( "FAILED: %s %s\n" , type , what );
+			++failures;
+		}
+	}
+
+	/// Uniform in [-1 , 1] , the same sequence everywhere.
+	double uniform ( unsigned int& state )
+	{
+		state = state * 1664525u + 1013904223u;
+		return ( state >> 8 ) * ( 2.0 / 16777215.0 ) - 1.0;
+	}
+
+	template < class Real >
+	double det ( const Celer::Matrix3x3<Real>& m )
+	{
+		return double ( m[0][0] ) * ( double ( m[1][1] ) * m[2][2] - double ( m[1][2] ) * m[2][1] )
+		     - double ( m[0][1] ) * ( double ( m[1][0] ) * m[2][2] - double ( m[1][2] ) * m[2][0] )
+		     + double ( m[0][2] ) * ( double ( m[1][0] ) * m[2][1] - double ( m[1][1] ) * m[2][0] );
+	}
+
+	template < class Real >
+	double largest ( const Celer::Matrix3x3<Real>& m )
+	{
+		double value = 0.0;
+		for ( int r = 0; r < 3; ++r )
+		{
+			for ( int c = 0; c < 3; ++c )
+			{
+				value = std::max ( value , double ( std::fabs ( m[r][c] ) ) );
+			}
+		}
+		return value;
+	}
+
+	template < class Real >
+	struct Errors
+	{
+		double residual;
+		double orthogonality;
+		double order;
+		double polar;
+		double determinant;
+		double symmetry;
+		int reflections;
+
+		Errors ( )
+			: residual ( 0 ) , orthogonality ( 0 ) , order ( 0 ) , polar ( 0 ) , determinant ( 0 ) , symmetry ( 0 ) , reflections ( 0 )
+		{
+		}
+
+		/// The errors of one decomposition , relative to the largest entry of a.
+		void add ( const Celer::Matrix3x3<Real>& a , const Celer::Matrix3x3<Real>& u , const Celer::Vector3<Real>& sigma ,
+		           const Celer::Matrix3x3<Real>& v , const Celer::Matrix3x3<Real>& rotation , const Celer::Matrix3x3<Real>& stretch )
+		{
+			double scale = std::max ( largest ( a ) , 1e-30 );
+
+			for ( int r = 0; r < 3; ++r )
+			{
+				for ( int c = 0; c < 3; ++c )
+				{
+					double product = 0.0;
+					double uu = 0.0;
+					double vv = 0.0;
+					double rs = 0.0;
+					for ( int k = 0; k < 3; ++k )
+					{
+						product += double ( u[r][k] ) * sigma[k] * v[c][k];
+						uu += double ( u[k][r] ) * u[k][c];
+						vv += double ( v[k][r] ) * v[k][c];
+						rs += double ( rotation[r][k] ) * stretch[k][c];
+					}
+					double identity = ( r == c ) ? 1.0 : 0.0;
+					residual = std::max ( residual , std::fabs ( product - a[r][c] ) / scale );
+					orthogonality = std::max ( orthogonality , std::max ( std::fabs ( uu - identity ) , std::fabs ( vv - identity ) ) );
+					polar = std::max ( polar , std::fabs ( rs - a[r][c] ) / scale );
+					symmetry = std::max ( symmetry , double ( std::fabs ( stretch[r][c] - stretch[c][r] ) ) / scale );
+				}
+			}
+
+			// Decreasing , the sign on the last one only.
+			order = std::max ( order , std::max ( double ( sigma[1] - sigma[0] ) , double ( std::fabs ( sigma[2] ) - sigma[1] ) ) / scale );
+			order = std::max ( order , -double ( sigma[1] ) / scale );
+
+			determinant = std::max ( determinant , std::fabs ( det ( rotation ) - 1.0 ) );
+			determinant = std::max ( determinant , std::max ( std::fabs ( det ( u ) - 1.0 ) , std::fabs ( det ( v ) - 1.0 ) ) );
+
+			// A reflection must leave its sign on the smallest singular value.
+			if ( det ( a ) < -1e-3 * scale * scale * scale )
+			{
+				++reflections;
+				order = std::max ( order , double ( sigma[2] ) / scale );
+			}
+		}
+	};
+
+	template < class Real >
+	std::vector< Celer::Matrix3x3<Real> > matrices ( )
+	{
+		typedef Celer::Matrix3x3<Real> Matrix3x3;
+
+		std::vector<Matrix3x3> a;
+		// Identity , zero , rank one , reflections , repeated and tiny values.
+		a.push_back ( Matrix3x3 ( 1 , 0 , 0 , 0 , 1 , 0 , 0 , 0 , 1 ) );
+		a.push_back ( Matrix3x3 ( 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 ) );
+		a.push_back ( Matrix3x3 ( 1 , 2 , 3 , 2 , 4 , 6 , 3 , 6 , 9 ) );
+		a.push_back ( Matrix3x3 ( -1 , 0 , 0 , 0 , 1 , 0 , 0 , 0 , 1 ) );
+		a.push_back ( Matrix3x3 ( 2 , 0 , 0 , 0 , 2 , 0 , 0 , 0 , -3 ) );
+		a.push_back ( Matrix3x3 ( 0 , 1 , 0 , 1 , 0 , 0 , 0 , 0 , 1 ) );
+		a.push_back ( Matrix3x3 ( -1 , 0 , 0 , 0 , -1 , 0 , 0 , 0 , -1 ) );
+		a.push_back ( Matrix3x3 ( 1 , 1 , 0 , 0 , 1 , 1 , 0 , 0 , 1 ) );
+		a.push_back ( Matrix3x3 ( 1e-3 , 0 , 0 , 0 , 1 , 0 , 0 , 0 , 1e3 ) );
+
+		unsigned int state = 1;
+		for ( int i = 0; i < 100000; ++i )
+		{
+			Matrix3x3 m;
+			for ( int r = 0; r < 3; ++r )
+			{
+				for ( int c = 0; c < 3; ++c )
+				{
+					m[r][c] = static_cast<Real> ( uniform ( state ) );
+				}
+			}
+			a.push_back ( m );
+		}
+
+		return a;
+	}
+
+	template < class Real >
+	void run ( const char* type , double residualBound , double orthogonalityBound )
+	{
+		typedef Celer::Matrix3x3<Real> Matrix3x3;
+		typedef Celer::Vector3<Real> Vector3;
+		typedef Celer::SingularValueDecomposition<Real> SVD;
+
+		std::vector<Matrix3x3> a = matrices<Real> ( );
+		std::size_t count = a.size ( );
+
+		std::vector<Matrix3x3> u ( count ) , v ( count ) , rotation ( count ) , stretch ( count );
+		std::vector<Vector3> sigma ( count );
+
+		SVD::decompose ( &a[0] , count , &u[0] , &sigma[0] , &v[0] );
+		SVD::polar ( &a[0] , count , &rotation[0] , &stretch[0] );
+
+		Errors<Real> batch;
+		Errors<Real> single;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			batch.add ( a[i] , u[i] , sigma[i] , v[i] , rotation[i] , stretch[i] );
+
+			SVD one ( a[i] );
+			single.add ( a[i] , one.u ( ) , one.sigma ( ) , one.v ( ) , one.rotation ( ) , one.stretch ( ) );
+		}
+
+		const Errors<Real>* errors[2] = { &batch , &single };
+		const char* names[2] = { "batch" , "single" };
+		char what[64];
+		for ( int k = 0; k < 2; ++k )
+		{
+			const Errors<Real>& e = *errors[k];
+			std::sprintf ( what , "%s residual" , names[k] );
+			check ( e.residual <= residualBound , type , what , e.residual , residualBound );
+			std::sprintf ( what , "%s orthogonality" , names[k] );
+			check ( e.orthogonality <= orthogonalityBound , type , what , e.orthogonality , orthogonalityBound );
+			std::sprintf ( what , "%s |det - 1| of U , V , R" , names[k] );
+			check ( e.determinant <= orthogonalityBound * 2 , type , what , e.determinant , orthogonalityBound * 2 );
+			std::sprintf ( what , "%s singular value order" , names[k] );
+			check ( e.order <= residualBound , type , what , e.order , residualBound );
+			std::sprintf ( what , "%s polar residual" , names[k] );
+			check ( e.polar <= residualBound , type , what , e.polar , residualBound );
+			std::sprintf ( what , "%s stretch asymmetry" , names[k] );
+			check ( e.symmetry <= residualBound , type , what , e.symmetry , residualBound );
+		}
+
+		check ( batch.reflections > 1000 , type , "det < 0 matrices" , batch.reflections , 1000 );
+	}
+}
+
+int main ( )
+{
+	// Measured: float residual 3e-6 and orthogonality 2.5e-6 , double
+	// 5e-15 , the residual relative to the largest entry.
+	run<float> ( "float" , 5e-6 , 5e-6 );
+	run<double> ( "double" , 1e-14 , 1e-14 );
+
+	std::printf ( "%s\n" , failures ? "FAILED" : "passed" );
+	return failures ? 1 : 0;
+}
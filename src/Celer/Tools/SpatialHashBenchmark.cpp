@@ -0,0 +1,105 @@
+//- Celer/Tools/SpatialHashBenchmark.cpp - SpatialHash timings -------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerSpatialHashBenchmark program , which
+//        times the sort and the neighbour lists of SpatialHash on a jittered
+//        lattice of particles , shuffled first and then as a solver sees it
+//        step after step , with both cell orderings.
+//
+//  Usage: CelerSpatialHashBenchmark [particles] [steps]
+//
+//  The default is 1M particles ( a 100^3 lattice ) and 3 steps. The radius
+//  is two lattice spacings , about 29 neighbours per particle. OMP_NUM_THREADS
+//  sets the threads.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+/// Celer Library
+#include <Celer/Core/Physics/SpatialHash.hpp>
+
+namespace
+{
+	typedef Celer::Vector3<float> Vector3;
+
+	unsigned int state = 1;
+
+	float uniform ( )
+	{
+		state = state * 1664525u + 1013904223u;
+		return ( state >> 8 ) * ( 1.0f / 16777216.0f );
+	}
+
+	/// side^3 particles , jittered by up to 0.3 spacings , in random order.
+	std::vector<Vector3> lattice ( int side )
+	{
+		std::vector<Vector3> positions;
+		positions.reserve ( static_cast<std::size_t> ( side ) * side * side );
+
+		for ( int z = 0; z < side; ++z )
+		{
+			for ( int y = 0; y < side; ++y )
+			{
+				for ( int x = 0; x < side; ++x )
+				{
+					positions.push_back ( Vector3 ( x + 0.3f * uniform ( ) , y + 0.3f * uniform ( ) , z + 0.3f * uniform ( ) ) );
+				}
+			}
+		}
+
+		for ( std::size_t i = positions.size ( ) - 1; i > 0; --i )
+		{
+			std::swap ( positions[i] , positions[static_cast<std::size_t> ( uniform ( ) * ( i + 1 ) ) % ( i + 1 )] );
+		}
+
+		return positions;
+	}
+}
+
+int main ( int argc , char** argv )
+{
+	long particles = ( argc > 1 ) ? std::atol ( argv[1] ) : 1000000;
+	int steps = ( argc > 2 ) ? std::atoi ( argv[2] ) : 3;
+	int side = static_cast<int> ( std::floor ( std::cbrt ( static_cast<double> ( particles ) ) + 0.5 ) );
+
+	std::vector<Vector3> shuffled = lattice ( side );
+	std::printf ( "%lu particles , radius 2 spacings , %d steps\n" , static_cast<unsigned long> ( shuffled.size ( ) ) , steps );
+
+	const char* names[2] = { "linear" , "morton" };
+	for ( int ordering = Celer::SpatialHash<float>::LINEAR; ordering <= Celer::SpatialHash<float>::MORTON; ++ordering )
+	{
+		Celer::SpatialHash<float> grid ( 2.0f , static_cast<Celer::SpatialHash<float>::Ordering> ( ordering ) );
+		std::vector<Vector3> positions = shuffled;
+
+		for ( int step = 0; step < steps; ++step )
+		{
+			// The first step sorts a shuffled set , the next ones the sorted one.
+			grid.build ( positions );
+			grid.reorder ( positions );
+
+			double neighbours = 0;
+			for ( std::size_t i = 0; i < grid.size ( ); ++i )
+			{
+				neighbours += grid.neighbourCount ( i );
+			}
+
+			std::printf ( "%s step %d: sort %7.1f ms , lists %7.1f ms , %.1f neighbours each\n" , names[ordering] , step ,
+			              grid.sortElapsed ( ) * 1e3 , grid.listElapsed ( ) * 1e3 , neighbours / grid.size ( ) );
+		}
+	}
+
+	return 0;
+}
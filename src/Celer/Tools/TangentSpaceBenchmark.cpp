@@ -0,0 +1,197 @@
+//- Celer/Tools/TangentSpaceBenchmark.cpp - TangentSpace timings -----------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerTangentSpaceBenchmark program , which
+//        times the adjacency build , the angle and area weighted normals and
+//        the tangents of TangentSpace on a 5M triangle sphere , against the
+//        usual serial scatter of face normals , and reports how far the
+//        results are from the analytic normal and tangent of the sphere.
+//
+//  Usage: CelerTangentSpaceBenchmark [n]
+//
+//  The sphere has n + 1 rings of 2 n + 1 vertices and 4 n^2 triangles , n is
+//  1118 by default. Times are the best of 3 runs. OMP_NUM_THREADS sets the
+//  threads.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Core/Geometry/Mesh/TangentSpace.hpp>
+
+namespace
+{
+	typedef Celer::Vector2<float> Vector2;
+	typedef Celer::Vector3<float> Vector3;
+	typedef Celer::Vector4<float> Vector4;
+
+	const int kRuns = 3;
+	const double kPi = 3.14159265358979323846;
+
+	struct Sphere
+	{
+		int n;
+		std::vector<Vector3> positions;
+		std::vector<Vector2> texCoords;
+		std::vector<unsigned int> indices;
+
+		explicit Sphere ( int n )
+			: n ( n )
+		{
+			for ( int i = 0; i <= n; ++i )
+			{
+				for ( int j = 0; j <= 2 * n; ++j )
+				{
+					double theta = kPi * ( i + 0.5 ) / ( n + 1 );
+					double phi = 2.0 * kPi * j / ( 2 * n );
+					positions.push_back ( Vector3 ( static_cast<float> ( std::sin ( theta ) * std::cos ( phi ) ) ,
+					                                static_cast<float> ( std::sin ( theta ) * std::sin ( phi ) ) ,
+					                                static_cast<float> ( std::cos ( theta ) ) ) );
+					texCoords.push_back ( Vector2 ( static_cast<float> ( j ) / ( 2 * n ) , static_cast<float> ( i ) / n ) );
+				}
+			}
+
+			for ( int i = 0; i < n; ++i )
+			{
+				for ( int j = 0; j < 2 * n; ++j )
+				{
+					unsigned int a = i * ( 2 * n + 1 ) + j;
+					unsigned int c = a + 2 * n + 1;
+					unsigned int quad[6] = { a , c , a + 1 , a + 1 , c , c + 1 };
+					indices.insert ( indices.end ( ) , quad , quad + 6 );
+				}
+			}
+		}
+
+		/// Away from the seam and the poles , where vertices are not shared.
+		bool interior ( std::size_t v ) const
+		{
+			std::size_t i = v / ( 2 * n + 1 );
+			std::size_t j = v % ( 2 * n + 1 );
+			return i > 0 && i < static_cast<std::size_t> ( n ) && j > 0 && j < static_cast<std::size_t> ( 2 * n );
+		}
+
+		Vector3 tangent ( std::size_t v ) const
+		{
+			double phi = 2.0 * kPi * ( v % ( 2 * n + 1 ) ) / ( 2 * n );
+			return Vector3 ( static_cast<float> ( -std::sin ( phi ) ) , static_cast<float> ( std::cos ( phi ) ) , 0.0f );
+		}
+	};
+
+	/// The baseline: each face adds its area weighted normal to its vertices.
+	void scatterNormals ( const Sphere& sphere , std::vector<Vector3>& normals )
+	{
+		std::fill ( normals.begin ( ) , normals.end ( ) , Vector3 ( 0.0f , 0.0f , 0.0f ) );
+
+		for ( std::size_t t = 0; t < sphere.indices.size ( ); t += 3 )
+		{
+			const unsigned int* corner = &sphere.indices[t];
+			Vector3 normal = ( sphere.positions[corner[1]] - sphere.positions[corner[0]] ) ^ ( sphere.positions[corner[2]] - sphere.positions[corner[0]] );
+			normals[corner[0]] += normal;
+			normals[corner[1]] += normal;
+			normals[corner[2]] += normal;
+		}
+
+		for ( std::size_t v = 0; v < normals.size ( ); ++v )
+		{
+			float length = std::sqrt ( normals[v] * normals[v] );
+			if ( length > 0.0f )
+			{
+				normals[v] = normals[v] / length;
+			}
+		}
+	}
+
+	double normalError ( const Sphere& sphere , const std::vector<Vector3>& normals )
+	{
+		double error = 0.0;
+		for ( std::size_t v = 0; v < normals.size ( ); ++v )
+		{
+			if ( sphere.interior ( v ) )
+			{
+				Vector3 d = normals[v] - sphere.positions[v];
+				error = std::max ( error , static_cast<double> ( std::sqrt ( d * d ) ) / std::sqrt ( sphere.positions[v] * sphere.positions[v] ) );
+			}
+		}
+		return error;
+	}
+}
+
+int main ( int argc , char** argv )
+{
+	int n = ( argc > 1 ) ? std::atoi ( argv[1] ) : 1118;
+
+	Sphere sphere ( n );
+	std::size_t vertexCount = sphere.positions.size ( );
+	std::printf ( "%lu triangles , %lu vertices\n" , static_cast<unsigned long> ( sphere.indices.size ( ) / 3 ) , static_cast<unsigned long> ( vertexCount ) );
+
+	std::vector<Vector3> normals ( vertexCount );
+	std::vector<Vector4> tangents ( vertexCount );
+
+	Celer::Timer timer;
+	double build = 1e30;
+	double angle = 1e30;
+	double area = 1e30;
+	double tangent = 1e30;
+	double scatter = 1e30;
+
+	Celer::TangentSpace<float> frames;
+	for ( int run = 0; run < kRuns; ++run )
+	{
+		timer.start ( );
+		frames.build ( &sphere.indices[0] , sphere.indices.size ( ) , vertexCount );
+		build = std::min ( build , timer.lap ( ) );
+		frames.normals ( &sphere.positions[0] , &normals[0] , Celer::TangentSpace<float>::AREA );
+		area = std::min ( area , timer.lap ( ) );
+		frames.normals ( &sphere.positions[0] , &normals[0] , Celer::TangentSpace<float>::ANGLE );
+		angle = std::min ( angle , timer.lap ( ) );
+		frames.tangents ( &sphere.positions[0] , &normals[0] , &sphere.texCoords[0] , &tangents[0] );
+		tangent = std::min ( tangent , timer.lap ( ) );
+	}
+
+	double angleError = normalError ( sphere , normals );
+	double tangentError = 0.0;
+	for ( std::size_t v = 0; v < vertexCount; ++v )
+	{
+		if ( sphere.interior ( v ) )
+		{
+			Vector3 d = Vector3 ( tangents[v].x , tangents[v].y , tangents[v].z ) - sphere.tangent ( v );
+			tangentError = std::max ( tangentError , static_cast<double> ( std::sqrt ( d * d ) ) );
+		}
+	}
+
+	frames.normals ( &sphere.positions[0] , &normals[0] , Celer::TangentSpace<float>::AREA );
+	double areaError = normalError ( sphere , normals );
+
+	std::vector<Vector3> scattered ( vertexCount );
+	for ( int run = 0; run < kRuns; ++run )
+	{
+		timer.start ( );
+		scatterNormals ( sphere , scattered );
+		scatter = std::min ( scatter , timer.elapsed ( ) );
+	}
+	double scatterError = normalError ( sphere , scattered );
+
+	std::printf ( "adjacency build:          %8.1f ms\n" , build * 1e3 );
+	std::printf ( "normals , angle weighted: %8.1f ms , error %.2e\n" , angle * 1e3 , angleError );
+	std::printf ( "normals , area weighted:  %8.1f ms , error %.2e\n" , area * 1e3 , areaError );
+	std::printf ( "tangents:                 %8.1f ms , error %.2e\n" , tangent * 1e3 , tangentError );
+	std::printf ( "serial scatter normals:   %8.1f ms , error %.2e\n" , scatter * 1e3 , scatterError );
+
+	return 0;
+}
@@ -0,0 +1,198 @@
+//- Celer/Tools/TextTest.cpp - Text number parser checks --------------------//
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerTextTest program , which checks that
+//        Text::parse rounds float and double as strtof and strtod do , bit
+//        for bit , stops where they stop and never reads past the end of
+//        its range.
+//
+//  Usage: CelerTextTest
+//
+//  The numbers are random decimals of up to 24 digits with and without an
+//  exponent , the float halfway points and their neighbours at 16 to 19
+//  digits , and a list of edge cases.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+/// Celer Library
+#include <Celer/Base/Text.hpp>
+
+namespace
+{
+	int failures = 0;
+	unsigned int state = 1;
+
+	unsigned int next ( )
+	{
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	}
+
+	template < class Real >
+	bool same ( Real a , Real b )
+	{
+		return ( a != a && b != b ) || std::memcmp ( &a , &b , sizeof ( Real ) ) == 0;
+	}
+
+	double reference ( const char* text , char** end , double )
+	{
+		return std::strtod ( text , end );
+	}
+
+	float reference ( const char* text , char** end , float )
+	{
+		return std::strtof ( text , end );
+	}
+
+	/// text is parsed as the range it spans inside a buffer that goes on with
+	/// digits , which must not be read.
+	template < class Real >
+	void check ( const std::string& text )
+	{
+		char buffer[160];
+		std::memcpy ( buffer , text.c_str ( ) , text.size ( ) + 1 );
+
+		char* stop = 0;
+		Real expected = reference ( buffer , &stop , Real ( ) );
+		const char* expectedEnd = ( stop == buffer ) ? 0 : stop;
+
+		std::memset ( buffer + text.size ( ) , '7' , sizeof ( buffer ) - text.size ( ) );
+
+		Real value = Real ( );
+		const char* end = Celer::Text::parse ( buffer , buffer + text.size ( ) , value );
+
+		if ( end != expectedEnd || ( end != 0 && !same ( value , expected ) ) )
+		{
+			if ( failures < 20 )
+			{
+				std::printf ( "FAILED: %s \"%s\" gives %.17g , end %ld , expected %.17g , end %ld\n" , sizeof ( Real ) == 4 ? "float" : "double" ,
+				              text.c_str ( ) , double ( value ) , end ? long ( end - buffer ) : -1L , double ( expected ) ,
+				              expectedEnd ? long ( expectedEnd - buffer ) : -1L );
+			}
+			++failures;
+		}
+	}
+
+	/// Random digits , a decimal point somewhere and an exponent half the time.
+	std::string randomDecimal ( int exponentRange )
+	{
+		std::string text;
+		if ( next ( ) % 4 == 0 )
+		{
+			text += '-';
+		}
+
+		int digits = 1 + static_cast<int> ( next ( ) % 24 );
+		int point = static_cast<int> ( next ( ) % ( digits + 1 ) );
+		for ( int i = 0; i < digits; ++i )
+		{
+			if ( i == point )
+			{
+				text += '.';
+			}
+			text += static_cast<char> ( '0' + ( ( i == 0 && next ( ) % 2 ) ? 0 : next ( ) % 10 ) );
+		}
+
+		if ( next ( ) % 2 )
+		{
+			char exponent[16];
+			std::sprintf ( exponent , "e%d" , static_cast<int> ( next ( ) % ( 2 * exponentRange + 1 ) ) - exponentRange );
+			text += exponent;
+		}
+
+		return text;
+	}
+
+	void checkLong ( const char* text , bool number , long expected , std::size_t length )
+	{
+		long value = 0;
+		const char* end = Celer::Text::parse ( text , text + std::strlen ( text ) , value );
+
+		if ( number ? ( end != text + length || value != expected ) : end != 0 )
+		{
+			std::printf ( "FAILED: long \"%s\"\n" , text );
+			++failures;
+		}
+	}
+}
+
+int main ( )
+{
+	const char* edges[] = { "0" , "-0" , "+1" , "0.1" , ".5" , "5." , "." , "-" , "e5" , "1e" , "1e+" , "1.5e-" , "3.14159 2" , "1,5" ,
+	                        "9007199254740992" , "9007199254740993" , "9007199254740995" , "18446744073709551615" , "18446744073709551616" ,
+	                        "0.30000000000000004" , "1e22" , "1e23" , "123456789012345678901234567890" , "0.000000000000000000000000000001" ,
+	                        "2.2250738585072011e-308" , "2.2250738585072014e-308" , "4.9e-324" , "2.4703282292062327e-324" , "1e-400" ,
+	                        "1.7976931348623157e308" , "1.7976931348623159e308" , "1e400" , "-1e400" , "inf" , "-Infinity" , "nan" ,
+	                        "1.17549435e-38" , "1.4e-45" , "7.0064923216240854e-46" , "3.4028235e38" , "3.4028236e38" , "16777217" ,
+	                        "1.00000005960464477539" , "1.0000000596046448" , "00000000000000000000000000000001.5" , "1e100000" };
+
+	for ( std::size_t i = 0; i < sizeof ( edges ) / sizeof ( edges[0] ); ++i )
+	{
+		check<double> ( edges[i] );
+		check<float> ( edges[i] );
+	}
+
+	for ( int i = 0; i < 1000000; ++i )
+	{
+		check<double> ( randomDecimal ( 330 ) );
+		check<float> ( randomDecimal ( 50 ) );
+	}
+
+	// The halfway points between floats , where rounding the double once more
+	// can go wrong , cut to 16 to 19 digits and moved by one in the last one.
+	for ( int i = 0; i < 200000; ++i )
+	{
+		unsigned int bits = ( next ( ) << 8 ) ^ next ( );
+		bits = ( bits & 0x807FFFFFu ) | ( ( 1u + next ( ) % 253u ) << 23 );
+		unsigned int above = bits + 1;
+		float low , high;
+		std::memcpy ( &low , &bits , 4 );
+		std::memcpy ( &high , &above , 4 );
+		double halfway = ( double ( low ) + double ( high ) ) * 0.5;
+
+		for ( int digits = 16; digits <= 19; ++digits )
+		{
+			char text[64];
+			std::sprintf ( text , "%.*e" , digits - 1 , halfway );
+			check<float> ( text );
+
+			char* e = std::strchr ( text , 'e' );
+			for ( int step = -1; step <= 1; step += 2 )
+			{
+				std::string moved ( text );
+				std::size_t last = static_cast<std::size_t> ( e - text ) - 1;
+				char digit = static_cast<char> ( moved[last] + step );
+				if ( digit >= '0' && digit <= '9' )
+				{
+					moved[last] = digit;
+					check<float> ( moved );
+				}
+			}
+		}
+	}
+
+	checkLong ( "-123" , true , -123 , 4 );
+	checkLong ( "+7 8" , true , 7 , 2 );
+	checkLong ( "42abc" , true , 42 , 2 );
+	checkLong ( "0" , true , 0 , 1 );
+	checkLong ( "" , false , 0 , 0 );
+	checkLong ( "-" , false , 0 , 0 );
+	checkLong ( "x1" , false , 0 , 0 );
+
+	std::printf ( "%s\n" , failures ? "FAILED" : "passed" );
+	return failures ? 1 : 0;
+}
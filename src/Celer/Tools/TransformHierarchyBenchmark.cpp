@@ -0,0 +1,259 @@
+//- Celer/Tools/TransformHierarchyBenchmark.cpp - TransformHierarchy timings //
+//- Celer Graphics
+//  Copyrights (c) 2008-2013 - Felipe de Carvalho
+//
+//                     The Celer Tools
+//
+// This file is distributed under GNU General Public License as published by
+// the Free Software Foundation. See LICENSE.TXT for details.
+//
+// @file
+// @created on: Oct 19, 2026
+// @version   : 0.1.0 Initial Release
+// @brief This file contains the CelerTransformHierarchyBenchmark program ,
+//        which times TransformHierarchy::update ( ) on a random forest of
+//        nodes with all , some , one level or none of them dirty , against
+//        the recursive walk over heap nodes with child pointers it replaces ,
+//        and checks both give the same world matrices.
+//
+//  Usage: CelerTransformHierarchyBenchmark [nodes]
+//
+//  The default is 2^20 nodes under 16 roots , each node the child of a
+//  random earlier one. Times are the best of 5 runs. OMP_NUM_THREADS sets
+//  the threads.
+//
+//---------------------------------------------------------------------------//
+
+/// Standard C++ library
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+/// Celer Library
+#include <Celer/Base/Timer.hpp>
+#include <Celer/Scene/TransformHierarchy.hpp>
+
+namespace
+{
+	typedef Celer::Matrix4x4<float> Matrix4x4;
+
+	const int kRuns = 5;
+
+	unsigned int state = 3;
+
+	unsigned int next ( )
+	{
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	}
+
+	float uniform ( )
+	{
+		return next ( ) * ( 2.0f / 16777216.0f ) - 1.0f;
+	}
+
+	/// A small random rotation and a translation in [-1 , 1].
+	Matrix4x4 randomLocal ( )
+	{
+		float w = 1.0f;
+		float x = 0.1f * uniform ( );
+		float y = 0.1f * uniform ( );
+		float z = 0.1f * uniform ( );
+		float length = std::sqrt ( w * w + x * x + y * y + z * z );
+
+		Celer::Transform<float> local ( Celer::Quaternion<float> ( w / length , x / length , y / length , z / length ) ,
+		                                Celer::Vector3<float> ( uniform ( ) , uniform ( ) , uniform ( ) ) , 1.0f );
+		return local.toMatrix ( );
+	}
+
+	/// The baseline: a node on the heap with pointers to its children.
+	struct Node
+	{
+		Matrix4x4 local;
+		Matrix4x4 world;
+		std::vector<Node*> children;
+	};
+
+	void walk ( Node* node , const Matrix4x4& parent )
+	{
+		node->world = parent * node->local;
+		for ( std::size_t i = 0; i < node->children.size ( ); ++i )
+		{
+			walk ( node->children[i] , node->world );
+		}
+	}
+
+	/// Largest difference , relative to the translation.
+	double difference ( const Matrix4x4& a , const Matrix4x4& b )
+	{
+		double value = 0.0;
+		for ( int i = 0; i < 4; ++i )
+		{
+			for ( int j = 0; j < 4; ++j )
+			{
+				value = std::max ( value , static_cast<double> ( std::fabs ( a ( i , j ) - b ( i , j ) ) ) );
+			}
+		}
+		return value / ( 1.0 + std::fabs ( b ( 0 , 3 ) ) );
+	}
+}
+
+int main ( int argc , char** argv )
+{
+	int count = ( argc > 1 ) ? std::atoi ( argv[1] ) : ( 1 << 20 );
+
+	std::vector<int> parents ( count );
+	std::vector<Matrix4x4> locals ( count );
+	for ( int i = 0; i < count; ++i )
+	{
+		parents[i] = ( i < 16 ) ? Celer::TransformHierarchy<float>::kNone : static_cast<int> ( next ( ) % i );
+		locals[i] = randomLocal ( );
+	}
+
+	Celer::Timer timer;
+	double seconds;
+
+	Celer::TransformHierarchy<float> hierarchy;
+	hierarchy.reserve ( count );
+	for ( int i = 0; i < count; ++i )
+	{
+		hierarchy.add ( parents[i] , locals[i] );
+	}
+	double added = timer.lap ( );
+	std::size_t computed = hierarchy.update ( );
+	seconds = timer.lap ( );
+	std::printf ( "%d nodes , %lu levels: add %.1f ms , first update ( sort and %lu nodes ) %.1f ms\n" , count ,
+	              static_cast<unsigned long> ( hierarchy.levels ( ).size ( ) - 1 ) , added * 1e3 , static_cast<unsigned long> ( computed ) , seconds * 1e3 );
+
+	// The baseline , nodes allocated in id order.
+	std::vector<Node*> nodes ( count );
+	std::vector<Node*> roots;
+	for ( int i = 0; i < count; ++i )
+	{
+		nodes[i] = new Node;
+		nodes[i]->local = locals[i];
+	}
+	for ( int i = 0; i < count; ++i )
+	{
+		if ( parents[i] < 0 )
+		{
+			roots.push_back ( nodes[i] );
+		}
+		else
+		{
+			nodes[parents[i]]->children.push_back ( nodes[i] );
+		}
+	}
+
+	Matrix4x4 identity;
+	double best = 1e30;
+	for ( int run = 0; run < kRuns; ++run )
+	{
+		timer.start ( );
+		for ( std::size_t r = 0; r < roots.size ( ); ++r )
+		{
+			walk ( roots[r] , identity );
+		}
+		best = std::min ( best , timer.elapsed ( ) );
+	}
+	std::printf ( "recursive pointer walk , all nodes:     %9.3f ms\n" , best * 1e3 );
+
+	// All dirty: a root change reaches every node.
+	best = 1e30;
+	for ( int run = 0; run < kRuns; ++run )
+	{
+		for ( int i = 0; i < 16 && i < count; ++i )
+		{
+			hierarchy.setLocal ( i , locals[i] );
+		}
+		timer.start ( );
+		computed = hierarchy.update ( );
+		best = std::min ( best , timer.elapsed ( ) );
+	}
+	std::printf ( "update , all nodes dirty:               %9.3f ms , %lu nodes\n" , best * 1e3 , static_cast<unsigned long> ( computed ) );
+
+	double error = 0.0;
+	for ( int i = 0; i < count; ++i )
+	{
+		error = std::max ( error , difference ( hierarchy.world ( i ) , nodes[i]->world ) );
+	}
+
+	// 1% of the nodes , at random.
+	best = 1e30;
+	for ( int run = 0; run < kRuns; ++run )
+	{
+		for ( int k = 0; k < count / 100; ++k )
+		{
+			int i = static_cast<int> ( next ( ) % count );
+			hierarchy.setLocal ( i , locals[i] );
+		}
+		timer.start ( );
+		computed = hierarchy.update ( );
+		best = std::min ( best , timer.elapsed ( ) );
+	}
+	std::printf ( "update , 1%% of the nodes dirty:         %9.3f ms , %lu nodes\n" , best * 1e3 , static_cast<unsigned long> ( computed ) );
+
+	// The deepest level only.
+	const std::vector<std::size_t>& levels = hierarchy.levels ( );
+	std::size_t deepest = levels.size ( ) - 2;
+	best = 1e30;
+	for ( int run = 0; run < kRuns; ++run )
+	{
+		for ( std::size_t slot = levels[deepest]; slot < levels[deepest + 1]; ++slot )
+		{
+			int node = hierarchy.node ( slot );
+			hierarchy.setLocal ( node , locals[node] );
+		}
+		timer.start ( );
+		computed = hierarchy.update ( );
+		best = std::min ( best , timer.elapsed ( ) );
+	}
+	std::printf ( "update , deepest level dirty:           %9.3f ms , %lu nodes\n" , best * 1e3 , static_cast<unsigned long> ( computed ) );
+
+	best = 1e30;
+	for ( int run = 0; run < kRuns; ++run )
+	{
+		timer.start ( );
+		computed = hierarchy.update ( );
+		best = std::min ( best , timer.elapsed ( ) );
+	}
+	std::printf ( "update , nothing dirty:                 %9.3f ms , %lu nodes\n" , best * 1e3 , static_cast<unsigned long> ( computed ) );
+
+	// Reparenting forces a new breadth first order.
+	int moved = 0;
+	for ( int k = 0; k < 100; ++k )
+	{
+		int node = static_cast<int> ( next ( ) % count );
+		int parent = static_cast<int> ( next ( ) % count );
+		if ( hierarchy.setParent ( node , parent ) )
+		{
+			std::vector<Node*>& siblings = ( parents[node] < 0 ) ? roots : nodes[parents[node]]->children;
+			siblings.erase ( std::find ( siblings.begin ( ) , siblings.end ( ) , nodes[node] ) );
+			nodes[parent]->children.push_back ( nodes[node] );
+			parents[node] = parent;
+			++moved;
+		}
+	}
+	timer.start ( );
+	computed = hierarchy.update ( );
+	seconds = timer.elapsed ( );
+	std::printf ( "update after %d reparents ( sort ):     %9.3f ms , %lu nodes\n" , moved , seconds * 1e3 , static_cast<unsigned long> ( computed ) );
+
+	for ( std::size_t r = 0; r < roots.size ( ); ++r )
+	{
+		walk ( roots[r] , identity );
+	}
+	for ( int i = 0; i < count; ++i )
+	{
+		error = std::max ( error , difference ( hierarchy.world ( i ) , nodes[i]->world ) );
+	}
+	std::printf ( "largest difference to the walk: %g\n" , error );
+
+	for ( int i = 0; i < count; ++i )
+	{
+		delete nodes[i];
+	}
+
+	return 0;
+}